@@ -8,6 +8,7 @@
  * - PNTR_PIXELFORMAT_RGBA: Use the RGBA format
  * - PNTR_PIXELFORMAT_ARGB: Use the ARGB pixel format
  * - PNTR_NO_ALPHABLEND: Skips alpha blending when rendering images
+ * - PNTR_NO_SIMD: Disables the SSE2, AVX2 and NEON code paths, using only portable C
  * - PNTR_ENABLE_DEFAULT_FONT: Enables the default font
  * - PNTR_ENABLE_JPEG: When available, support JPEG image loading
  * - PNTR_ENABLE_MATH: When enabled, will use C's math.h library, rather than internal implementations
@@ -217,6 +218,26 @@
      */
     #define PNTR_NO_ALPHABLEND
 
+    /**
+     * Disables the SSE2, AVX2 and NEON code paths, and uses only the portable C implementations.
+     *
+     * @details By default, SIMD instructions are used when the compiler targets them, such as with `-msse2` or `-mavx2`.
+     */
+    #define PNTR_NO_SIMD
+
+    /**
+     * When defined, aligns the pixel data of new images to the given amount of bytes, and pads the pitch of each row to a multiple of it.
+     *
+     * @details This lets each row start on a vector boundary. Must be a power of two of at least 4, such as 64.
+     *
+     * @code
+     * #define PNTR_IMAGE_ALIGNMENT 64
+     * @endcode
+     *
+     * @see pntr_new_image()
+     */
+    #define PNTR_IMAGE_ALIGNMENT
+
     /**
      * Will disable the default use of `stdio.h` for file saving/loading with `PNTR_LOAD_FILE` and `PNTR_SAVE_FILE`.
      *
@@ -369,6 +390,18 @@ typedef struct pntr_rectangle {
     int height; /** The height of the rectangle. */
 } pntr_rectangle;
 
+/**
+ * How much of an image is covered by visible pixels.
+ *
+ * @see pntr_image_get_opacity()
+ */
+typedef enum pntr_opacity {
+    PNTR_OPACITY_UNKNOWN = 0, /** The opacity has not been determined yet. */
+    PNTR_OPACITY_OPAQUE, /** Every pixel is fully opaque. */
+    PNTR_OPACITY_TRANSPARENT, /** Every pixel is fully transparent. */
+    PNTR_OPACITY_MIXED /** The image has translucent pixels, or both opaque and transparent pixels. */
+} pntr_opacity;
+
 /**
  * An image, represented by pixel data.
  *
@@ -388,6 +421,60 @@ typedef struct pntr_image {
      */
     bool subimage;
 
+    /**
+     * Whether or not the image owns its pixel data, and will free it with pntr_unload_image().
+     *
+     * @see pntr_image_from_pixels()
+     */
+    bool owned;
+
+    /**
+     * Whether or not the pixel data was allocated with the padding of PNTR_IMAGE_ALIGNMENT.
+     *
+     * @internal
+     */
+    bool aligned;
+
+    /**
+     * Whether or not the color channels of the image data are premultiplied by their alpha.
+     *
+     * Premultiplied images blend without any division. They are converted back to straight alpha when saved, or when
+     * converted with pntr_image_to_pixelformat().
+     *
+     * @see pntr_image_alpha_premultiply()
+     * @see pntr_image_alpha_unpremultiply()
+     */
+    bool premultiplied;
+
+    /**
+     * The cached opacity of the image, which allows drawing opaque images with a plain copy, and skipping transparent ones.
+     *
+     * Drawing into the image resets it to PNTR_OPACITY_UNKNOWN. When changing the pixel data directly, reset it yourself.
+     * Subimages do not cache their opacity, and neither do images wrapping pixel data they don't own, as that data may
+     * change without pntr knowing.
+     *
+     * @see pntr_image_get_opacity()
+     */
+    pntr_opacity opacity;
+
+    /**
+     * The image that owns the pixel data of a subimage, or NULL.
+     *
+     * @see pntr_image_subimage()
+     */
+    struct pntr_image* parent;
+
+    /**
+     * The next level of the image's mipmap chain, half its size, or NULL.
+     *
+     * Each level holds the level after it, down to a single pixel. Drawing into the image unloads the chain, as it
+     * would be out of date.
+     *
+     * @see pntr_image_gen_mipmaps()
+     * @see pntr_image_unload_mipmaps()
+     */
+    struct pntr_image* mipmap;
+
     /**
      * A rectangle representing the region of the image that can be changed.
      *
@@ -424,23 +511,204 @@ typedef struct pntr_font {
     void* user_data; /** General extra user data that can be referenced to by the font. */
 } pntr_font;
 
+/**
+ * A horizontal run of visible pixels within a row of a pntr_sprite_rle.
+ */
+typedef struct pntr_sprite_rle_run {
+    int x; /** Where the run starts on the row. */
+    int length; /** The number of pixels in the run. */
+    int offset; /** The index of the first pixel of the run in the sprite's pixels. */
+    bool opaque; /** Whether the pixels are fully opaque, and can be copied rather than blended. */
+} pntr_sprite_rle_run;
+
+/**
+ * A sprite compiled from an image into runs of opaque and translucent pixels.
+ *
+ * Transparent pixels are not stored at all, so mostly transparent sprites take less memory and draw faster.
+ *
+ * @see pntr_load_sprite_rle()
+ * @see pntr_draw_sprite_rle()
+ * @see pntr_unload_sprite_rle()
+ */
+typedef struct pntr_sprite_rle {
+    int width; /** The width of the sprite. */
+    int height; /** The height of the sprite. */
+    int* rows; /** The index of the first run of each row, with one extra entry marking the end of the last row. */
+    pntr_sprite_rle_run* runs; /** The runs of visible pixels. */
+    pntr_color* pixels; /** The colors of all the visible pixels. */
+    bool premultiplied; /** Whether the colors are premultiplied by their alpha. */
+} pntr_sprite_rle;
+
+/**
+ * A single step of a pntr_color_pipeline.
+ *
+ * Adjustments that change each channel on its own are folded into lookup tables. Adjustments that mix the channels,
+ * like saturation and hue, are folded into a matrix.
+ */
+typedef struct pntr_color_pipeline_stage {
+    bool matrix; /** Whether the stage uses the matrix, rather than the lookup tables. */
+    unsigned char r[256]; /** The lookup table for the red channel. */
+    unsigned char g[256]; /** The lookup table for the green channel. */
+    unsigned char b[256]; /** The lookup table for the blue channel. */
+    unsigned char a[256]; /** The lookup table for the alpha channel. */
+    float factors[9]; /** A 3x3 matrix applied to the red, green and blue channels, row by row. */
+    int fixed[9]; /** The matrix factors in 16.16 fixed point. */
+} pntr_color_pipeline_stage;
+
+/**
+ * A chain of color adjustments that are applied to an image in a single pass.
+ *
+ * @see pntr_new_color_pipeline()
+ * @see pntr_image_color_pipeline()
+ * @see pntr_unload_color_pipeline()
+ */
+typedef struct pntr_color_pipeline {
+    pntr_color_pipeline_stage* stages; /** The stages of the pipeline, applied in order. */
+    int stagesCount; /** The number of stages in use. */
+    int stagesCapacity; /** The number of stages that are allocated. */
+} pntr_color_pipeline;
+
 /**
  * Pixel format.
  */
 typedef enum pntr_pixelformat {
     PNTR_PIXELFORMAT_RGBA8888 = 0, /** RGBA, with 8 bytes for each component. */
     PNTR_PIXELFORMAT_ARGB8888, /** ARGB, with 8 bytes for each component. */
-    PNTR_PIXELFORMAT_GRAYSCALE /** Grayscale, with one byte for each pixel, 0 - 255. 0 being disabled, 255 being enabled. */
+    PNTR_PIXELFORMAT_GRAYSCALE, /** Grayscale, with one byte for each pixel, 0 - 255. 0 being disabled, 255 being enabled. */
+    PNTR_PIXELFORMAT_RGB565, /** RGB, packed into 16 little-endian bits with 5 bits for red, 6 for green, and 5 for blue. */
+    PNTR_PIXELFORMAT_RGB888, /** RGB, with one byte for each component and no alpha. */
+    PNTR_PIXELFORMAT_BGRA8888, /** BGRA, with one byte for each component. */
+    PNTR_PIXELFORMAT_A8 /** Alpha only, with one byte for each pixel. Loads as white, with the byte as its alpha. */
 } pntr_pixelformat;
 
 /**
  * Possible image filters to apply.
+ *
+ * The filters after PNTR_FILTER_BILINEAR are used by pntr_image_resize(). Everywhere else, they sample like
+ * PNTR_FILTER_BILINEAR.
  */
 typedef enum pntr_filter {
     PNTR_FILTER_NEARESTNEIGHBOR = 0, /** Nearest-neighbor interpolation for fast processing. Good for a pixel art look. */
-    PNTR_FILTER_BILINEAR /** Bilinear interpolation will combine multiple pixels together when processing for smoother scaling. */
+    PNTR_FILTER_BILINEAR, /** Bilinear interpolation will combine multiple pixels together when processing for smoother scaling. */
+    PNTR_FILTER_BOX, /** Averages the pixels that each new pixel covers. Sharp, and good for shrinking by whole amounts. Resizing only. */
+    PNTR_FILTER_TRIANGLE, /** The same as bilinear, but also averages every pixel covered when shrinking. Resizing only. */
+    PNTR_FILTER_MITCHELL, /** A smooth cubic filter with little ringing. Good for most photos. Resizing only. */
+    PNTR_FILTER_LANCZOS3 /** The sharpest filter, which may ring around hard edges. Resizing only. */
 } pntr_filter;
 
+/**
+ * How the ends of thick lines are drawn.
+ *
+ * @see pntr_draw_line_thick_cap()
+ */
+typedef enum pntr_line_cap {
+    PNTR_LINE_CAP_BUTT = 0, /** The line ends squarely at its end points. */
+    PNTR_LINE_CAP_SQUARE, /** The line ends squarely, half of its thickness past its end points. */
+    PNTR_LINE_CAP_ROUND /** The line ends with a half circle around each of its end points. */
+} pntr_line_cap;
+
+/**
+ * How the corners between the segments of thick polylines and polygons are drawn.
+ *
+ * @see pntr_draw_polyline_thick_ex()
+ * @see pntr_draw_polygon_thick_ex()
+ */
+typedef enum pntr_line_join {
+    PNTR_LINE_JOIN_MITER = 0, /** The outer edges meet in a sharp point, or are beveled when it would reach past four times half of the thickness. */
+    PNTR_LINE_JOIN_BEVEL, /** The outer edges are joined by a straight line. */
+    PNTR_LINE_JOIN_ROUND /** The outer edges are joined by a circular arc. */
+} pntr_line_join;
+
+/**
+ * The shape of a pntr_gradient.
+ *
+ * @see pntr_new_gradient_linear()
+ * @see pntr_new_gradient_radial()
+ * @see pntr_new_gradient_conic()
+ */
+typedef enum pntr_gradient_type {
+    PNTR_GRADIENT_LINEAR = 0, /** The colors change along the line from the start point to the end point. */
+    PNTR_GRADIENT_RADIAL, /** The colors change with the distance from the center, out to the radius. */
+    PNTR_GRADIENT_CONIC /** The colors change with the angle around the center, clockwise from the start angle. */
+} pntr_gradient_type;
+
+/**
+ * A gradient through any number of color stops, used to fill shapes.
+ *
+ * The colors between the stops are computed once into a ramp, so that filling only needs to find where each pixel
+ * lies along the gradient.
+ *
+ * @see pntr_new_gradient_linear()
+ * @see pntr_draw_rectangle_fill_gradient()
+ * @see pntr_draw_polygon_fill_gradient()
+ * @see pntr_unload_gradient()
+ */
+typedef struct pntr_gradient {
+    pntr_gradient_type type; /** The shape of the gradient. */
+    float x; /** The X coordinate of the start point, or of the center. */
+    float y; /** The Y coordinate of the start point, or of the center. */
+    float endX; /** The X coordinate of the end point of a linear gradient. */
+    float endY; /** The Y coordinate of the end point of a linear gradient. */
+    float radius; /** The radius of a radial gradient. */
+    float angle; /** The start angle of a conic gradient, in degrees. */
+    bool opaque; /** Whether every color of the ramp is opaque. */
+    pntr_color ramp[256]; /** The colors of the gradient, from its start to its end. */
+    pntr_color premultipliedRamp[256]; /** The ramp with premultiplied alpha, for drawing onto premultiplied images. */
+} pntr_gradient;
+
+/**
+ * Which pixels are inside of a shape whose outline crosses itself, or that has several contours.
+ *
+ * @see pntr_draw_path_fill()
+ */
+typedef enum pntr_fill_rule {
+    PNTR_FILL_RULE_NON_ZERO = 0, /** Fill wherever the outline winds around a pixel, unless it winds around it both ways equally. */
+    PNTR_FILL_RULE_EVEN_ODD /** Fill only where the outline winds around a pixel an odd number of times. */
+} pntr_fill_rule;
+
+/**
+ * How a color is combined with the pixel it is drawn onto.
+ *
+ * @see pntr_draw_particles()
+ */
+typedef enum pntr_blend_mode {
+    PNTR_BLEND_ALPHA = 0, /** The color is blended over the pixel by its alpha, like pntr_blend_color(). */
+    PNTR_BLEND_ADD /** The color, scaled by its alpha, is added to the pixel, so overlapping colors brighten. */
+} pntr_blend_mode;
+
+/**
+ * A run of connected points in a pntr_path.
+ *
+ * @see pntr_path
+ */
+typedef struct pntr_path_contour {
+    int start; /** The index of the contour's first point. */
+    int count; /** How many points the contour has. */
+    bool closed; /** Whether the contour was closed with pntr_path_close(). */
+} pntr_path_contour;
+
+/**
+ * An outline made of lines and curves, which can be filled or stroked many times.
+ *
+ * Curves are flattened into lines as they are added, so drawing the path does no curve math.
+ *
+ * @see pntr_new_path()
+ * @see pntr_draw_path_fill()
+ * @see pntr_draw_path_thick()
+ * @see pntr_unload_path()
+ */
+typedef struct pntr_path {
+    float* points; /** The x and y coordinates of the flattened points, one contour after another. */
+    int pointsCount; /** How many points there are. */
+    int pointsCapacity; /** How many points fit before the points need to grow. */
+    pntr_path_contour* contours; /** The contours of the path. */
+    int contoursCount; /** How many contours there are. */
+    int contoursCapacity; /** How many contours fit before the contours need to grow. */
+    float x; /** The x coordinate of the current point. */
+    float y; /** The y coordinate of the current point. */
+    bool open; /** Whether new lines and curves are added to the last contour. */
+} pntr_path;
+
 /**
  * Error states definitions.
  *
@@ -476,16 +744,22 @@ PNTR_API pntr_image* pntr_gen_image_color(int width, int height, pntr_color colo
 PNTR_API pntr_image* pntr_image_copy(pntr_image* image);
 PNTR_API pntr_image* pntr_image_from_image(pntr_image* image, int x, int y, int width, int height);
 PNTR_API pntr_image* pntr_image_subimage(pntr_image* image, int x, int y, int width, int height);
+PNTR_API pntr_image* pntr_image_from_pixels(pntr_color* data, int width, int height, int pitch, bool owned);
+PNTR_API pntr_opacity pntr_image_get_opacity(pntr_image* image);
 PNTR_API pntr_rectangle pntr_image_get_clip(pntr_image* image);
 PNTR_API void pntr_image_set_clip(pntr_image* image, int x, int y, int width, int height);
 PNTR_API void pntr_image_set_clip_rec(pntr_image* image, pntr_rectangle clip);
 PNTR_API void pntr_image_reset_clip(pntr_image* image);
 PNTR_API void pntr_unload_image(pntr_image* image);
+PNTR_API bool pntr_image_gen_mipmaps(pntr_image* image);
+PNTR_API void pntr_image_unload_mipmaps(pntr_image* image);
 PNTR_API void pntr_clear_background(pntr_image* image, pntr_color color);
 PNTR_API void pntr_draw_point(pntr_image* dst, int x, int y, pntr_color color);
 PNTR_API void pntr_draw_point_vec(pntr_image* dst, pntr_vector* point, pntr_color color);
 PNTR_API void pntr_draw_points(pntr_image* dst, pntr_vector* points, int pointsCount, pntr_color color);
+PNTR_API void pntr_draw_particles(pntr_image* dst, int* x, int* y, pntr_color* colors, int* sizes, int count, pntr_blend_mode mode);
 PNTR_API void pntr_draw_line(pntr_image* dst, int startPosX, int startPosY, int endPosX, int endPosY, pntr_color color);
+PNTR_API void pntr_draw_lines(pntr_image* dst, pntr_vector* segments, int count, pntr_color color);
 PNTR_API void pntr_draw_line_curve(pntr_image* dst, pntr_vector point1, pntr_vector point2, pntr_vector point3, pntr_vector point4, int segments, pntr_color color);
 PNTR_API void pntr_draw_line_vec(pntr_image* dst, pntr_vector start, pntr_vector end, pntr_color color);
 PNTR_API void pntr_draw_line_vertical(pntr_image* dst, int posX, int posY, int height, pntr_color color);
@@ -496,10 +770,16 @@ PNTR_API void pntr_draw_rectangle_fill(pntr_image* dst, int posX, int posY, int
 PNTR_API void pntr_draw_rectangle_fill_rec(pntr_image* dst, pntr_rectangle rect, pntr_color color);
 PNTR_API void pntr_draw_rectangle_gradient(pntr_image* dst, int x, int y, int width, int height, pntr_color topLeft, pntr_color topRight, pntr_color bottomLeft, pntr_color bottomRight);
 PNTR_API void pntr_draw_rectangle_gradient_rec(pntr_image* dst, pntr_rectangle rect, pntr_color topLeft, pntr_color topRight, pntr_color bottomLeft, pntr_color bottomRight);
+PNTR_API void pntr_draw_rectangle_fill_gradient(pntr_image* dst, int x, int y, int width, int height, pntr_gradient* gradient);
 PNTR_API void pntr_draw_triangle(pntr_image* dst, int x1, int y1, int x2, int y2, int x3, int y3, pntr_color color);
 PNTR_API void pntr_draw_triangle_vec(pntr_image* dst, pntr_vector point1, pntr_vector point2, pntr_vector point3, pntr_color color);
 PNTR_API void pntr_draw_triangle_fill(pntr_image* dst, int x1, int y1, int x2, int y2, int x3, int y3, pntr_color color);
 PNTR_API void pntr_draw_triangle_fill_vec(pntr_image* dst, pntr_vector point1, pntr_vector point2, pntr_vector point3, pntr_color color);
+PNTR_API void pntr_draw_triangle_gradient(pntr_image* dst, int x1, int y1, int x2, int y2, int x3, int y3, pntr_color color1, pntr_color color2, pntr_color color3);
+PNTR_API void pntr_draw_triangle_gradient_vec(pntr_image* dst, pntr_vector point1, pntr_vector point2, pntr_vector point3, pntr_color color1, pntr_color color2, pntr_color color3);
+PNTR_API void pntr_draw_triangles(pntr_image* dst, pntr_vector* vertices, int* indices, int count, pntr_color* colors, pntr_color color);
+PNTR_API void pntr_draw_triangle_textured(pntr_image* dst, pntr_image* texture, pntr_vector point1, pntr_vector point2, pntr_vector point3, pntr_vector uv1, pntr_vector uv2, pntr_vector uv3, pntr_color tint, pntr_filter filter);
+PNTR_API void pntr_draw_quad_textured(pntr_image* dst, pntr_image* texture, pntr_rectangle srcRect, pntr_vector point1, pntr_vector point2, pntr_vector point3, pntr_vector point4, pntr_color tint, pntr_filter filter);
 PNTR_API void pntr_draw_ellipse(pntr_image* dst, int centerX, int centerY, int radiusX, int radiusY, pntr_color color);
 PNTR_API void pntr_draw_ellipse_fill(pntr_image* dst, int centerX, int centerY, int radiusX, int radiusY, pntr_color color);
 PNTR_API void pntr_draw_circle(pntr_image* dst, int centerX, int centerY, int radius, pntr_color color);
@@ -511,11 +791,15 @@ PNTR_API void pntr_draw_arc(pntr_image* dst, int centerX, int centerY, float rad
 PNTR_API void pntr_draw_arc_fill(pntr_image* dst, int centerX, int centerY, float radius, float startAngle, float endAngle, int segments, pntr_color color);
 PNTR_API void pntr_draw_rectangle_rounded(pntr_image* dst, int x, int y, int width, int height, int topLeftRadius, int topRightRadius, int bottomLeftRadius, int bottomRightRadius, pntr_color color);
 PNTR_API void pntr_draw_rectangle_rounded_fill(pntr_image* dst, int x, int y, int width, int height, int cornerRadius, pntr_color color);
+PNTR_API void pntr_draw_rectangle_rounded_fill_ex(pntr_image* dst, int x, int y, int width, int height, int topLeftRadius, int topRightRadius, int bottomLeftRadius, int bottomRightRadius, pntr_color color);
 PNTR_API void pntr_draw_image(pntr_image* dst, pntr_image* src, int posX, int posY);
 PNTR_API void pntr_draw_image_rec(pntr_image* dst, pntr_image* src, pntr_rectangle srcRect, int posX, int posY);
 PNTR_API void pntr_draw_image_tint(pntr_image* dst, pntr_image* src, int posX, int posY, pntr_color tint);
 PNTR_API void pntr_draw_image_tint_rec(pntr_image* dst, pntr_image* src, pntr_rectangle srcRect, int posX, int posY, pntr_color tint);
 PNTR_API void pntr_draw_image_rotated(pntr_image* dst, pntr_image* src, int posX, int posY, float degrees, float offsetX, float offsetY, pntr_filter filter);
+PNTR_API pntr_sprite_rle* pntr_load_sprite_rle(pntr_image* image);
+PNTR_API void pntr_unload_sprite_rle(pntr_sprite_rle* sprite);
+PNTR_API void pntr_draw_sprite_rle(pntr_image* dst, pntr_sprite_rle* sprite, int posX, int posY);
 PNTR_API void pntr_draw_image_rotated_rec(pntr_image* dst, pntr_image* src, pntr_rectangle srcRect, int posX, int posY, float degrees, float offsetX, float offsetY, pntr_filter filter);
 PNTR_API void pntr_draw_image_flipped(pntr_image* dst, pntr_image* src, int posX, int posY, bool flipHorizontal, bool flipVertical, bool flipDiagonal);
 PNTR_API void pntr_draw_image_flipped_rec(pntr_image* dst, pntr_image* src, pntr_rectangle srcRec, int posX, int posY, bool flipHorizontal, bool flipVertical, bool flipDiagonal);
@@ -540,12 +824,16 @@ PNTR_API void pntr_color_set_a(pntr_color* color, unsigned char a);
 PNTR_API pntr_color pntr_image_get_color(pntr_image* image, int x, int y);
 PNTR_API bool pntr_save_file(const char *fileName, const void *data, unsigned int bytesToWrite);
 PNTR_API void* pntr_image_to_pixelformat(pntr_image* image, unsigned int* dataSize, pntr_pixelformat pixelFormat);
+PNTR_API bool pntr_image_to_pixelformat_buffer(pntr_image* image, void* buffer, int stride, pntr_pixelformat pixelFormat);
 PNTR_API bool pntr_save_image(pntr_image* image, const char* fileName);
 PNTR_API unsigned char* pntr_save_image_to_memory(pntr_image* image, pntr_image_type type, unsigned int* dataSize);
 PNTR_API int pntr_get_pixel_data_size(int width, int height, pntr_pixelformat pixelFormat);
 PNTR_API pntr_image* pntr_load_image(const char* fileName);
 PNTR_API pntr_image* pntr_load_image_from_memory(pntr_image_type type, const unsigned char* fileData, unsigned int dataSize);
 PNTR_API pntr_image* pntr_image_from_pixelformat(const void* data, int width, int height, pntr_pixelformat pixelFormat);
+PNTR_API pntr_image* pntr_image_from_pixelformat_premultiplied(const void* data, int width, int height, pntr_pixelformat pixelFormat);
+PNTR_API bool pntr_image_from_pixelformat_buffer(pntr_image* image, const void* buffer, int stride, pntr_pixelformat pixelFormat);
+PNTR_API pntr_image* pntr_load_image_from_memory_premultiplied(pntr_image_type type, const unsigned char* fileData, unsigned int dataSize);
 PNTR_API void* pntr_set_error(pntr_error error);
 PNTR_API const char* pntr_get_error(void);
 PNTR_API pntr_error pntr_get_error_code(void);
@@ -581,6 +869,11 @@ PNTR_API pntr_font* pntr_load_font_ttf_from_memory(const unsigned char* fileData
 PNTR_API pntr_color pntr_color_invert(pntr_color color);
 PNTR_API void pntr_image_color_invert(pntr_image* image);
 PNTR_API pntr_color pntr_color_alpha_blend(pntr_color dst, pntr_color src);
+PNTR_API void pntr_blend_color_premultiplied(pntr_color* dst, pntr_color src);
+PNTR_API pntr_color pntr_color_alpha_premultiply(pntr_color color);
+PNTR_API pntr_color pntr_color_alpha_unpremultiply(pntr_color color);
+PNTR_API void pntr_image_alpha_premultiply(pntr_image* image);
+PNTR_API void pntr_image_alpha_unpremultiply(pntr_image* image);
 PNTR_API pntr_rectangle pntr_image_alpha_border(pntr_image* image, float threshold);
 PNTR_API bool pntr_image_crop(pntr_image* image, int x, int y, int width, int height);
 PNTR_API void pntr_image_alpha_crop(pntr_image* image, float threshold);
@@ -588,6 +881,21 @@ PNTR_API void pntr_image_color_brightness(pntr_image* image, float factor);
 PNTR_API void pntr_image_flip(pntr_image* image, bool horizontal, bool vertical);
 PNTR_API pntr_color pntr_color_contrast(pntr_color color, float contrast);
 PNTR_API void pntr_image_color_contrast(pntr_image* image, float contrast);
+PNTR_API pntr_color_pipeline* pntr_new_color_pipeline(void);
+PNTR_API void pntr_unload_color_pipeline(pntr_color_pipeline* pipeline);
+PNTR_API void pntr_color_pipeline_brightness(pntr_color_pipeline* pipeline, float factor);
+PNTR_API void pntr_color_pipeline_contrast(pntr_color_pipeline* pipeline, float contrast);
+PNTR_API void pntr_color_pipeline_fade(pntr_color_pipeline* pipeline, float factor);
+PNTR_API void pntr_color_pipeline_tint(pntr_color_pipeline* pipeline, pntr_color tint);
+PNTR_API void pntr_color_pipeline_invert(pntr_color_pipeline* pipeline);
+PNTR_API void pntr_color_pipeline_saturation(pntr_color_pipeline* pipeline, float factor);
+PNTR_API void pntr_color_pipeline_hue(pntr_color_pipeline* pipeline, float degrees);
+PNTR_API pntr_color pntr_color_pipeline_apply(pntr_color_pipeline* pipeline, pntr_color color);
+PNTR_API void pntr_image_color_pipeline(pntr_image* image, pntr_color_pipeline* pipeline);
+PNTR_API pntr_gradient* pntr_new_gradient_linear(float startX, float startY, float endX, float endY, pntr_color* colors, float* stops, int count);
+PNTR_API pntr_gradient* pntr_new_gradient_radial(float centerX, float centerY, float radius, pntr_color* colors, float* stops, int count);
+PNTR_API pntr_gradient* pntr_new_gradient_conic(float centerX, float centerY, float angle, pntr_color* colors, float* stops, int count);
+PNTR_API void pntr_unload_gradient(pntr_gradient* gradient);
 PNTR_API void pntr_image_alpha_mask(pntr_image* image, pntr_image* alphaMask, int posX, int posY);
 PNTR_API bool pntr_image_resize_canvas(pntr_image* image, int newWidth, int newHeight, int offsetX, int offsetY, pntr_color fill);
 PNTR_API pntr_image* pntr_image_rotate(pntr_image* image, float degrees, pntr_filter filter);
@@ -600,6 +908,8 @@ PNTR_API pntr_image_type pntr_get_file_image_type(const char* filePath);
 
 PNTR_API void pntr_draw_line_thick(pntr_image* dst, int startPosX, int startPosY, int endPosX, int endPosY, int thickness, pntr_color color);
 PNTR_API void pntr_draw_line_thick_vec(pntr_image* dst, pntr_vector start, pntr_vector end, int thickness, pntr_color color);
+PNTR_API void pntr_draw_line_thick_cap(pntr_image* dst, int startPosX, int startPosY, int endPosX, int endPosY, int thickness, pntr_line_cap cap, pntr_color color);
+PNTR_API void pntr_draw_line_thick_cap_vec(pntr_image* dst, pntr_vector start, pntr_vector end, int thickness, pntr_line_cap cap, pntr_color color);
 PNTR_API void pntr_draw_rectangle_thick(pntr_image* dst, int posX, int posY, int width, int height, int thickness, pntr_color color);
 PNTR_API void pntr_draw_rectangle_thick_rec(pntr_image* dst, pntr_rectangle rect, int thickness, pntr_color color);
 PNTR_API void pntr_draw_triangle_thick(pntr_image* dst, int x1, int y1, int x2, int y2, int x3, int y3, int thickness, pntr_color color);
@@ -607,12 +917,31 @@ PNTR_API void pntr_draw_triangle_thick_vec(pntr_image* dst, pntr_vector point1,
 PNTR_API void pntr_draw_ellipse_thick(pntr_image* dst, int centerX, int centerY, int radiusX, int radiusY, int thickness, pntr_color color);
 PNTR_API void pntr_draw_circle_thick(pntr_image* dst, int centerX, int centerY, int radius, int thickness, pntr_color color);
 PNTR_API void pntr_draw_polygon_thick(pntr_image* dst, pntr_vector* points, int numPoints, int thickness, pntr_color color);
+PNTR_API void pntr_draw_polygon_thick_ex(pntr_image* dst, pntr_vector* points, int numPoints, int thickness, pntr_line_join join, pntr_color color);
 PNTR_API void pntr_draw_polyline_thick(pntr_image* dst, pntr_vector* points, int numPoints, int thickness, pntr_color color);
+PNTR_API void pntr_draw_polyline_thick_ex(pntr_image* dst, pntr_vector* points, int numPoints, int thickness, pntr_line_join join, pntr_line_cap cap, pntr_color color);
 PNTR_API void pntr_draw_arc_thick(pntr_image* dst, int centerX, int centerY, float radius, float startAngle, float endAngle, int segments, int thickness, pntr_color color);
 PNTR_API void pntr_draw_rectangle_thick_rounded(pntr_image* dst, int x, int y, int width, int height, int topLeftRadius, int topRightRadius, int bottomLeftRadius, int bottomRightRadius, int thickness, pntr_color color);
 PNTR_API void pntr_draw_line_vertical_thick(pntr_image* dst, int posX, int posY, int height, int thickness, pntr_color color);
 PNTR_API void pntr_draw_line_horizontal_thick(pntr_image* dst, int posX, int posY, int width, int thickness, pntr_color color);
 PNTR_API void pntr_draw_line_curve_thick(pntr_image* dst, pntr_vector point1, pntr_vector point2, pntr_vector point3, pntr_vector point4, int segments, int thickness, pntr_color color);
+PNTR_API void pntr_draw_line_aa(pntr_image* dst, int startPosX, int startPosY, int endPosX, int endPosY, pntr_color color);
+PNTR_API void pntr_draw_line_aa_vec(pntr_image* dst, pntr_vector start, pntr_vector end, pntr_color color);
+PNTR_API void pntr_draw_circle_aa(pntr_image* dst, int centerX, int centerY, int radius, pntr_color color);
+PNTR_API void pntr_draw_circle_fill_aa(pntr_image* dst, int centerX, int centerY, int radius, pntr_color color);
+PNTR_API void pntr_draw_ellipse_aa(pntr_image* dst, int centerX, int centerY, int radiusX, int radiusY, pntr_color color);
+PNTR_API void pntr_draw_ellipse_fill_aa(pntr_image* dst, int centerX, int centerY, int radiusX, int radiusY, pntr_color color);
+PNTR_API void pntr_draw_polygon_fill_aa(pntr_image* dst, pntr_vector* points, int numPoints, pntr_color color);
+PNTR_API void pntr_draw_polygon_fill_gradient(pntr_image* dst, pntr_vector* points, int numPoints, pntr_gradient* gradient);
+PNTR_API pntr_path* pntr_new_path(void);
+PNTR_API void pntr_unload_path(pntr_path* path);
+PNTR_API void pntr_path_move_to(pntr_path* path, float x, float y);
+PNTR_API void pntr_path_line_to(pntr_path* path, float x, float y);
+PNTR_API void pntr_path_quad_to(pntr_path* path, float controlX, float controlY, float x, float y);
+PNTR_API void pntr_path_cubic_to(pntr_path* path, float control1X, float control1Y, float control2X, float control2Y, float x, float y);
+PNTR_API void pntr_path_close(pntr_path* path);
+PNTR_API void pntr_draw_path_fill(pntr_image* dst, pntr_path* path, pntr_fill_rule rule, pntr_color color);
+PNTR_API void pntr_draw_path_thick(pntr_image* dst, pntr_path* path, int thickness, pntr_line_join join, pntr_line_cap cap, pntr_color color);
 
 // Internal
 PNTR_API void pntr_put_horizontal_line_unsafe(pntr_image* dst, int posX, int posY, int width, pntr_color color);
@@ -826,6 +1155,21 @@ PNTR_API void pntr_draw_point_unsafe(pntr_image* dst, int x, int y, pntr_color c
     typedef char pntr_codepoint_t;
 #endif
 
+// SIMD instruction sets, detected from what the compiler is targeting.
+#if !defined(PNTR_NO_SIMD) && !defined(_DOXYGEN_)
+    #if defined(__AVX2__)
+        #include <immintrin.h>
+        #define PNTR_SIMD_AVX2
+        #define PNTR_SIMD_SSE2
+    #elif defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #include <emmintrin.h>
+        #define PNTR_SIMD_SSE2
+    #elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+        #include <arm_neon.h>
+        #define PNTR_SIMD_NEON
+    #endif
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -1181,6 +1525,41 @@ extern "C" {
         #define PNTR_FLOORF(x) (float)(((int)(x)) - (((x) < 0.0f) ? 1 : 0))
     #endif  // PNTR_FLOORF
 
+    #ifndef PNTR_SQRTF
+        /**
+         * @internal
+         *
+         * @see PNTR_SQRTF
+         */
+        float _pntr_sqrtf(float x) {
+            if (!(x > 0.0f)) {
+                return 0.0f;
+            }
+
+            // Newton's method, starting above the root so that each guess is smaller until it settles.
+            float guess = (x > 1.0f) ? x : 1.0f;
+            for (int i = 0; i < 128; i++) {
+                float next = 0.5f * (guess + x / guess);
+                if (next >= guess) {
+                    break;
+                }
+                guess = next;
+            }
+            return guess;
+        }
+
+        /**
+         * Computes the square root of a floating point value.
+         *
+         * @param x Floating point value.
+         *
+         * @return The square root of the given value, or 0 for negative values.
+         *
+         * @see https://en.cppreference.com/w/c/numeric/math/sqrt
+         */
+        #define PNTR_SQRTF(x) _pntr_sqrtf(x)
+    #endif  // PNTR_SQRTF
+
     #ifndef PNTR_FMODF
         /**
          * Computes the floating-point remainder of the division operation x/y.
@@ -1288,19 +1667,8 @@ extern "C" {
 
         #ifndef PNTR_ENABLE_MATH
             #ifndef STBTT_sqrt
-                float _pntr_sqrtf(float number) {
-                    float guess = number / 2.0f;
-                    float epsilon = 1e-6f;
-                    while (true) {
-                        float next_guess = 0.5f * (guess + number / guess);
-                        if (PNTR_FABSF(next_guess - guess) < epsilon) {
-                            return next_guess;
-                        }
-                        guess = next_guess;
-                    }
-                }
-                #define STBTT_sqrt(x) _pntr_sqrtf(x)
-            #endif  // PNTR_SQRTF
+                #define STBTT_sqrt(x) PNTR_SQRTF((float)(x))
+            #endif  // STBTT_sqrt
 
             #ifndef STBTT_pow
                 float _pntr_pow(float base, float exponent) {
@@ -1490,10 +1858,56 @@ PNTR_API void* pntr_set_error(pntr_error error) {
     return NULL;
 }
 
+/**
+ * Allocates the pixel data for an image, aligned to PNTR_IMAGE_ALIGNMENT when it is defined.
+ *
+ * The original allocation is kept just before the aligned pixel data, so that it can be freed later.
+ *
+ * @see _pntr_image_free_data()
+ * @internal
+ */
+static pntr_color* _pntr_image_alloc_data(size_t size, bool* aligned) {
+    #ifdef PNTR_IMAGE_ALIGNMENT
+        unsigned char* allocation = (unsigned char*)PNTR_MALLOC(size + sizeof(void*) + PNTR_IMAGE_ALIGNMENT - 1);
+        if (allocation == NULL) {
+            return NULL;
+        }
+
+        uintptr_t address = ((uintptr_t)(allocation + sizeof(void*)) + (PNTR_IMAGE_ALIGNMENT - 1)) & ~(uintptr_t)(PNTR_IMAGE_ALIGNMENT - 1);
+        void** data = (void**)address;
+        data[-1] = allocation;
+        *aligned = true;
+        return (pntr_color*)data;
+    #else
+        *aligned = false;
+        return (pntr_color*)PNTR_MALLOC(size);
+    #endif
+}
+
+/**
+ * Frees the pixel data of an image, if the image owns it.
+ *
+ * @see _pntr_image_alloc_data()
+ * @internal
+ */
+static void _pntr_image_free_data(pntr_image* image) {
+    if (!image->owned || image->data == NULL) {
+        return;
+    }
+
+    if (image->aligned) {
+        PNTR_FREE(((void**)image->data)[-1]);
+    }
+    else {
+        PNTR_FREE(image->data);
+    }
+}
+
 /**
  * Create a new image at the given width and height.
  *
- * This method will not clear the image upon instantiation.
+ * This method will not clear the image upon instantiation. When PNTR_IMAGE_ALIGNMENT is defined, the pitch of the
+ * image may be larger than its width.
  *
  * @param width The width of the new image.
  * @param height The height of the new image.
@@ -1513,11 +1927,19 @@ PNTR_API pntr_image* pntr_new_image(int width, int height) {
     }
 
     image->pitch = width * (int)sizeof(pntr_color);
+    #ifdef PNTR_IMAGE_ALIGNMENT
+    image->pitch = (image->pitch + (PNTR_IMAGE_ALIGNMENT - 1)) & ~(PNTR_IMAGE_ALIGNMENT - 1);
+    #endif
     image->width = width;
     image->height = height;
     pntr_image_reset_clip(image);
     image->subimage = false;
-    image->data = (pntr_color*)PNTR_MALLOC((size_t)(image->pitch * height));
+    image->owned = true;
+    image->premultiplied = false;
+    image->opacity = PNTR_OPACITY_UNKNOWN;
+    image->parent = NULL;
+    image->mipmap = NULL;
+    image->data = _pntr_image_alloc_data((size_t)image->pitch * (size_t)height, &image->aligned);
     if (image->data == NULL) {
         PNTR_FREE(image);
         return (pntr_image*)pntr_set_error(PNTR_ERROR_NO_MEMORY);
@@ -1559,6 +1981,7 @@ PNTR_API pntr_image* pntr_image_copy(pntr_image* image) {
         return NULL;
     }
 
+    newImage->premultiplied = image->premultiplied;
     pntr_draw_image(newImage, image, 0, 0);
     newImage->clip = image->clip;
 
@@ -1600,1848 +2023,6619 @@ void pntr_blend_color(pntr_color* dst, pntr_color src) {
     #endif
 }
 
+#if !defined(PNTR_NO_ALPHABLEND) && defined(PNTR_SIMD_SSE2)
 /**
- * Get a new rectangle representing the intersection of the two given rectangles.
- *
- * @code
- * pntr_rectangle dstRect;
- * if (!_pntr_rectangle_intersect(10, 10, 20, 20, image->clip.x, image->clip.y, image->clip.width, image>clip.height, dstRect)) {
- *     return;
- * }
- * @endcode
- *
- * @param x The input rectangle's x coordinate.
- * @param y The input rectangle's y coordinate.
- * @param width The input rectangle's width.
- * @param height The input rectangle's height.
- * @param destX The destination x coordinate.
- * @param destY The destination y coordinate.
- * @param destWidth The destination rectangle's width.
- * @param destHeight The destination rectangle's height.
- * @param out The normalized rectangle.
+ * Blends four translucent source pixels over four opaque destination pixels.
  *
- * @return True if the intersect of the rectangle has a width and height greater than 0, false otherwise.
+ * When the destination alpha is 255, the result alpha of pntr_blend_color() is always 255, and its division reduces to
+ * a division by 255 * 256. That is done here with 16-bit multiplies and shifts, matching pntr_blend_color() exactly.
  *
  * @internal
  */
-PNTR_API bool _pntr_rectangle_intersect(int x, int y, int width, int height, int destX, int destY, int destWidth, int destHeight, pntr_rectangle *out) {
-    if (width <= 0 || height <= 0) {
-        return false;
-    }
+static __m128i _pntr_blend_opaque_sse2(__m128i src, __m128i dst, __m128i alphaMask) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one = _mm_set1_epi16(1);
+    const __m128i max = _mm_set1_epi16(255);
+    const __m128i full = _mm_set1_epi16(256);
+    __m128i result[2];
 
-    out->x = PNTR_MAX(x, destX);
-    out->width = PNTR_MIN(x + width, destX + destWidth) - out->x;
-    if (out->width <= 0) {
-        return false;
-    }
+    for (int half = 0; half < 2; half++) {
+        __m128i srcChannels = half ? _mm_unpackhi_epi8(src, zero) : _mm_unpacklo_epi8(src, zero);
+        __m128i dstChannels = half ? _mm_unpackhi_epi8(dst, zero) : _mm_unpacklo_epi8(dst, zero);
 
-    out->y = PNTR_MAX(y, destY);
-    out->height = PNTR_MIN(y + height, destY + destHeight) - out->y;
-    if (out->height <= 0) {
-        return false;
+        // alpha + 1, spread across each channel of the pixel.
+        __m128i alpha = _mm_add_epi16(_mm_shufflehi_epi16(_mm_shufflelo_epi16(srcChannels, 0xFF), 0xFF), one);
+        __m128i srcPart = _mm_mullo_epi16(srcChannels, alpha);
+        __m128i dstPart = _mm_mullo_epi16(dstChannels, _mm_sub_epi16(full, alpha));
+
+        // (srcPart * 256 + dstPart * 255) / 256, then divided by 255.
+        __m128i sum = _mm_add_epi16(srcPart, _mm_sub_epi16(dstPart, _mm_srli_epi16(_mm_add_epi16(dstPart, max), 8)));
+        result[half] = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(sum, one), _mm_srli_epi16(sum, 8)), 8);
     }
 
-    return true;
+    return _mm_or_si128(_mm_packus_epi16(result[0], result[1]), alphaMask);
 }
+#endif
 
+#if !defined(PNTR_NO_ALPHABLEND) && defined(PNTR_SIMD_AVX2)
 /**
- * Creates a new image from a section of the original image.
- *
- * The new image must be cleared with pntr_unload_image().
- *
- * @param image The original image to build the new image from.
- * @param x The x coordinate to build the new image from.
- * @param y The y coordinate to build the new image from.
- * @param width The width of the new image.
- * @param height The height of the new image.
- *
- * @return A new image that is based off of the section of the original image.
+ * Blends eight translucent source pixels over eight opaque destination pixels.
  *
- * @see pntr_image_subimage()
- * @see pntr_unload_image()
+ * @see _pntr_blend_opaque_sse2()
+ * @internal
  */
-PNTR_API pntr_image* pntr_image_from_image(pntr_image* image, int x, int y, int width, int height) {
-    if (image == NULL) {
-        return (pntr_image*)pntr_set_error(PNTR_ERROR_INVALID_ARGS);
-    }
-
-    pntr_rectangle dstRect;
-    if (!_pntr_rectangle_intersect(x, y, width, height, 0, 0, image->width, image->height, &dstRect)) {
-        return NULL;
-    }
-
-    pntr_image* result = pntr_new_image(dstRect.width, dstRect.height);
-    if (result == NULL) {
-        return NULL;
-    }
+static __m256i _pntr_blend_opaque_avx2(__m256i src, __m256i dst, __m256i alphaMask) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i one = _mm256_set1_epi16(1);
+    const __m256i max = _mm256_set1_epi16(255);
+    const __m256i full = _mm256_set1_epi16(256);
+    __m256i result[2];
 
-    for (int destY = 0; destY < dstRect.height; destY++) {
-        PNTR_MEMCPY(&PNTR_PIXEL(result, 0, destY),
-            &PNTR_PIXEL(image, dstRect.x, dstRect.y + destY),
-            (size_t)result->pitch);
+    for (int half = 0; half < 2; half++) {
+        __m256i srcChannels = half ? _mm256_unpackhi_epi8(src, zero) : _mm256_unpacklo_epi8(src, zero);
+        __m256i dstChannels = half ? _mm256_unpackhi_epi8(dst, zero) : _mm256_unpacklo_epi8(dst, zero);
+        __m256i alpha = _mm256_add_epi16(_mm256_shufflehi_epi16(_mm256_shufflelo_epi16(srcChannels, 0xFF), 0xFF), one);
+        __m256i srcPart = _mm256_mullo_epi16(srcChannels, alpha);
+        __m256i dstPart = _mm256_mullo_epi16(dstChannels, _mm256_sub_epi16(full, alpha));
+        __m256i sum = _mm256_add_epi16(srcPart, _mm256_sub_epi16(dstPart, _mm256_srli_epi16(_mm256_add_epi16(dstPart, max), 8)));
+        result[half] = _mm256_srli_epi16(_mm256_add_epi16(_mm256_add_epi16(sum, one), _mm256_srli_epi16(sum, 8)), 8);
     }
 
-    return result;
+    return _mm256_or_si256(_mm256_packus_epi16(result[0], result[1]), alphaMask);
 }
+#endif
 
+#if !defined(PNTR_NO_ALPHABLEND) && defined(PNTR_SIMD_NEON)
 /**
- * Creates an image that references a section of another image.
- *
- * This is useful to have images reference a sprite in a tileset. Sub-images still need to be cleared with pntr_unload_image().
- *
- * @param image The original image to reference for the new portion of the image.
- * @param x The X coorindate of the subimage.
- * @param y The Y coordinate of the subimage.
- * @param width The width of the subimage.
- * @param height The height of the subimage.
+ * Checks whether every lane of the given NEON mask is set.
  *
- * @return The pntr_image referencing the section of the given image.
- *
- * @see pntr_image_from_image()
- * @see pntr_unload_image()
+ * @internal
  */
-PNTR_API pntr_image* pntr_image_subimage(pntr_image* image, int x, int y, int width, int height) {
-    if (image == NULL) {
-        return (pntr_image*)pntr_set_error(PNTR_ERROR_INVALID_ARGS);
-    }
+static bool _pntr_neon_all(uint8x16_t mask) {
+    uint64x2_t lanes = vreinterpretq_u64_u8(mask);
+    return (vgetq_lane_u64(lanes, 0) & vgetq_lane_u64(lanes, 1)) == UINT64_MAX;
+}
 
-    // Ensure we are referencing an actual portion of the image.
-    pntr_rectangle dstRect;
-    if (!_pntr_rectangle_intersect(x, y, width, height, 0, 0, image->width, image->height, &dstRect)) {
-        return NULL;
-    }
+/**
+ * Blends one channel of sixteen translucent source pixels over sixteen opaque destination pixels.
+ *
+ * @see _pntr_blend_opaque_sse2()
+ * @internal
+ */
+static uint8x16_t _pntr_blend_opaque_neon(uint8x16_t src, uint8x16_t dst, uint8x16_t alpha) {
+    const uint16x8_t one = vdupq_n_u16(1);
+    const uint16x8_t max = vdupq_n_u16(255);
+    uint8x16_t inverse = vmvnq_u8(alpha);
+    uint16x8_t result[2];
 
-    // Build the subimage.
-    pntr_image* subimage = (pntr_image*)PNTR_MALLOC(sizeof(pntr_image));
-    if (subimage == NULL) {
-        return (pntr_image*)pntr_set_error(PNTR_ERROR_NO_MEMORY);
+    for (int half = 0; half < 2; half++) {
+        uint8x8_t srcChannel = half ? vget_high_u8(src) : vget_low_u8(src);
+        uint8x8_t dstChannel = half ? vget_high_u8(dst) : vget_low_u8(dst);
+        uint16x8_t srcPart = vmulq_u16(vmovl_u8(srcChannel), vaddl_u8(half ? vget_high_u8(alpha) : vget_low_u8(alpha), vdup_n_u8(1)));
+        uint16x8_t dstPart = vmull_u8(dstChannel, half ? vget_high_u8(inverse) : vget_low_u8(inverse));
+        uint16x8_t sum = vaddq_u16(srcPart, vsubq_u16(dstPart, vshrq_n_u16(vaddq_u16(dstPart, max), 8)));
+        result[half] = vshrq_n_u16(vaddq_u16(vaddq_u16(sum, one), vshrq_n_u16(sum, 8)), 8);
     }
 
-    subimage->pitch = image->pitch;
-    subimage->width = dstRect.width;
-    subimage->height = dstRect.height;
-    subimage->subimage = true;
-    pntr_image_reset_clip(subimage);
-    subimage->data = &PNTR_PIXEL(image, dstRect.x, dstRect.y);
-
-    return subimage;
+    return vcombine_u8(vmovn_u16(result[0]), vmovn_u16(result[1]));
 }
+#endif
 
 /**
- * Unloads the given image from memory.
+ * Alpha blends a row of source pixels into a row of destination pixels.
  *
- * @param image The image to unload from memory.
+ * The result is the same as calling pntr_blend_color() on each pixel. With SIMD, groups of fully opaque source pixels
+ * are copied, fully transparent groups are skipped, and translucent groups over an opaque destination are blended
+ * together. Anything else falls back to pntr_blend_color().
+ *
+ * @param dst The first destination pixel.
+ * @param src The first source pixel.
+ * @param width The number of pixels to blend.
+ *
+ * @see pntr_blend_color()
+ * @see PNTR_NO_SIMD
+ * @internal
  */
-PNTR_API void pntr_unload_image(pntr_image* image) {
-    if (image == NULL) {
-        return;
-    }
+static void _pntr_blend_row(pntr_color* dst, const pntr_color* src, int width) {
+    int x = 0;
 
-    // Only clear full image data.
-    if (!image->subimage && image->data != NULL) {
-        PNTR_FREE(image->data);
-    }
+    #ifndef PNTR_NO_ALPHABLEND
+        #if defined(PNTR_SIMD_SSE2) || defined(PNTR_SIMD_AVX2)
+            pntr_color alphaColor = PNTR_NEW_COLOR(0, 0, 0, 255);
+        #endif
 
-    PNTR_FREE(image);
+        #ifdef PNTR_SIMD_AVX2
+        {
+            const __m256i alphaMask = _mm256_set1_epi32((int)alphaColor.value);
+            const __m256i zero = _mm256_setzero_si256();
+            for (; x + 8 <= width; x += 8) {
+                __m256i srcPixels = _mm256_loadu_si256((const __m256i*)(src + x));
+                __m256i srcAlpha = _mm256_and_si256(srcPixels, alphaMask);
+                __m256i opaque = _mm256_cmpeq_epi32(srcAlpha, alphaMask);
+                __m256i clear = _mm256_cmpeq_epi32(srcAlpha, zero);
+                if (_mm256_movemask_ps(_mm256_castsi256_ps(opaque)) == 0xFF) {
+                    _mm256_storeu_si256((__m256i*)(dst + x), srcPixels);
+                    continue;
+                }
+                if (_mm256_movemask_ps(_mm256_castsi256_ps(clear)) == 0xFF) {
+                    continue;
+                }
+
+                __m256i dstPixels = _mm256_loadu_si256((const __m256i*)(dst + x));
+                if (_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(dstPixels, alphaMask), alphaMask))) != 0xFF) {
+                    for (int i = x; i < x + 8; i++) {
+                        pntr_blend_color(dst + i, src[i]);
+                    }
+                    continue;
+                }
+
+                __m256i blended = _pntr_blend_opaque_avx2(srcPixels, dstPixels, alphaMask);
+                blended = _mm256_blendv_epi8(blended, srcPixels, opaque);
+                blended = _mm256_blendv_epi8(blended, dstPixels, clear);
+                _mm256_storeu_si256((__m256i*)(dst + x), blended);
+            }
+        }
+        #endif
+
+        #ifdef PNTR_SIMD_SSE2
+        {
+            const __m128i alphaMask = _mm_set1_epi32((int)alphaColor.value);
+            const __m128i zero = _mm_setzero_si128();
+            for (; x + 4 <= width; x += 4) {
+                __m128i srcPixels = _mm_loadu_si128((const __m128i*)(src + x));
+                __m128i srcAlpha = _mm_and_si128(srcPixels, alphaMask);
+                __m128i opaque = _mm_cmpeq_epi32(srcAlpha, alphaMask);
+                __m128i clear = _mm_cmpeq_epi32(srcAlpha, zero);
+                if (_mm_movemask_ps(_mm_castsi128_ps(opaque)) == 0xF) {
+                    _mm_storeu_si128((__m128i*)(dst + x), srcPixels);
+                    continue;
+                }
+                if (_mm_movemask_ps(_mm_castsi128_ps(clear)) == 0xF) {
+                    continue;
+                }
+
+                __m128i dstPixels = _mm_loadu_si128((const __m128i*)(dst + x));
+                if (_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(dstPixels, alphaMask), alphaMask))) != 0xF) {
+                    for (int i = x; i < x + 4; i++) {
+                        pntr_blend_color(dst + i, src[i]);
+                    }
+                    continue;
+                }
+
+                __m128i blended = _pntr_blend_opaque_sse2(srcPixels, dstPixels, alphaMask);
+                blended = _mm_or_si128(_mm_and_si128(opaque, srcPixels), _mm_andnot_si128(opaque, blended));
+                blended = _mm_or_si128(_mm_and_si128(clear, dstPixels), _mm_andnot_si128(clear, blended));
+                _mm_storeu_si128((__m128i*)(dst + x), blended);
+            }
+        }
+        #endif
+
+        #ifdef PNTR_SIMD_NEON
+        {
+            const uint8x16_t max = vdupq_n_u8(255);
+            const uint8x16_t zero = vdupq_n_u8(0);
+            for (; x + 16 <= width; x += 16) {
+                // The alpha channel is the fourth byte in both the RGBA and ARGB layouts.
+                uint8x16x4_t srcPixels = vld4q_u8((const uint8_t*)(src + x));
+                uint8x16_t opaque = vceqq_u8(srcPixels.val[3], max);
+                uint8x16_t clear = vceqq_u8(srcPixels.val[3], zero);
+                if (_pntr_neon_all(opaque)) {
+                    vst4q_u8((uint8_t*)(dst + x), srcPixels);
+                    continue;
+                }
+                if (_pntr_neon_all(clear)) {
+                    continue;
+                }
+
+                uint8x16x4_t dstPixels = vld4q_u8((const uint8_t*)(dst + x));
+                if (!_pntr_neon_all(vceqq_u8(dstPixels.val[3], max))) {
+                    for (int i = x; i < x + 16; i++) {
+                        pntr_blend_color(dst + i, src[i]);
+                    }
+                    continue;
+                }
+
+                for (int channel = 0; channel < 3; channel++) {
+                    uint8x16_t blended = _pntr_blend_opaque_neon(srcPixels.val[channel], dstPixels.val[channel], srcPixels.val[3]);
+                    blended = vbslq_u8(opaque, srcPixels.val[channel], blended);
+                    dstPixels.val[channel] = vbslq_u8(clear, dstPixels.val[channel], blended);
+                }
+                vst4q_u8((uint8_t*)(dst + x), dstPixels);
+            }
+        }
+        #endif
+    #endif
+
+    for (; x < width; x++) {
+        pntr_blend_color(dst + x, src[x]);
+    }
 }
 
 /**
- * Draws a line on the destination image, ignoring clipping and bounds.
+ * Multiplies two 8-bit values, as if they were each between 0.0f and 1.0f.
+ *
+ * @return The rounded result of `value * factor / 255`.
+ *
+ * @internal
  */
-PNTR_API void pntr_put_horizontal_line_unsafe(pntr_image* dst, int posX, int posY, int width, pntr_color color) {
-    pntr_color *row = &PNTR_PIXEL(dst, posX, posY);
-    while (--width >= 0) {
-        row[width] = color;
-    }
+static unsigned char _pntr_multiply_255(unsigned int value, unsigned int factor) {
+    unsigned int product = value * factor + 128;
+    return (unsigned char)((product + (product >> 8)) >> 8);
 }
 
 /**
- * Clears an image with the given color.
+ * Alpha blend a premultiplied source color into a premultiplied destination color.
  *
- * @details Clearing the background ignores clipping.
+ * Each channel becomes `src + dst * (1 - src.a)`, which needs no division.
  *
- * @param image The image to clear.
- * @param color The color to fill the image with.
+ * @param dst The destination color, with premultiplied alpha.
+ * @param src The source color, with premultiplied alpha.
+ *
+ * @see pntr_blend_color()
+ * @see pntr_color_alpha_premultiply()
  */
-PNTR_API void pntr_clear_background(pntr_image* image, pntr_color color) {
-    if (image == NULL) {
+PNTR_API void pntr_blend_color_premultiplied(pntr_color* dst, pntr_color src) {
+    if (src.rgba.a == 255) {
+        *dst = src;
         return;
     }
-
-    // Blank or white can have some performance optimization.
-    if (!image->subimage) {
-        // White
-        if (color.value == PNTR_WHITE_VALUE) {
-            PNTR_MEMSET((void*)image->data, 255, (size_t)(image->height * image->pitch));
-            return;
-        }
-
-        // Blank
-        if (color.rgba.a == 0) {
-            PNTR_MEMSET((void*)image->data, 0, (size_t)(image->height * image->pitch));
+    #ifndef PNTR_NO_ALPHABLEND
+        if (src.value == 0) {
             return;
         }
-    }
 
-    // Draw the first line
-    pntr_put_horizontal_line_unsafe(image, 0, 0, image->width, color);
+        unsigned int inverse = 255 - (unsigned int)src.rgba.a;
+        dst->rgba.r = (unsigned char)PNTR_MIN(255, src.rgba.r + _pntr_multiply_255(dst->rgba.r, inverse));
+        dst->rgba.g = (unsigned char)PNTR_MIN(255, src.rgba.g + _pntr_multiply_255(dst->rgba.g, inverse));
+        dst->rgba.b = (unsigned char)PNTR_MIN(255, src.rgba.b + _pntr_multiply_255(dst->rgba.b, inverse));
+        dst->rgba.a = (unsigned char)PNTR_MIN(255, src.rgba.a + _pntr_multiply_255(dst->rgba.a, inverse));
+    #endif
+}
 
-    // Copy the line for the rest of the background
-    for (int y = 1; y < image->height; y++) {
-        PNTR_MEMCPY(&PNTR_PIXEL(image, 0, y), image->data, (size_t)image->pitch);
+/**
+ * Multiplies the color channels of the given color by its alpha.
+ *
+ * @param color The color, with straight alpha.
+ *
+ * @return The color with premultiplied alpha.
+ *
+ * @see pntr_color_alpha_unpremultiply()
+ * @see pntr_image_alpha_premultiply()
+ */
+PNTR_API pntr_color pntr_color_alpha_premultiply(pntr_color color) {
+    if (color.rgba.a == 255) {
+        return color;
     }
+
+    color.rgba.r = _pntr_multiply_255(color.rgba.r, color.rgba.a);
+    color.rgba.g = _pntr_multiply_255(color.rgba.g, color.rgba.a);
+    color.rgba.b = _pntr_multiply_255(color.rgba.b, color.rgba.a);
+    return color;
 }
 
 /**
- * Creates a new color, provided the given red, green, blue, and alpha colors.
+ * Divides the color channels of the given premultiplied color by its alpha.
  *
- * @param red The red channel.
- * @param green The green channel.
- * @param blue The blue channel.
- * @param alpha The alpha channel.
+ * @param color The color, with premultiplied alpha.
  *
- * @return The color with the given red, green, blue, and alpha components.
+ * @return The color with straight alpha.
+ *
+ * @see pntr_color_alpha_premultiply()
+ * @see pntr_image_alpha_unpremultiply()
  */
-PNTR_API pntr_color pntr_new_color(unsigned char red, unsigned char green, unsigned char blue, unsigned char alpha) {
-    return PNTR_NEW_COLOR(red, green, blue, alpha);
+PNTR_API pntr_color pntr_color_alpha_unpremultiply(pntr_color color) {
+    if (color.rgba.a == 255) {
+        return color;
+    }
+
+    if (color.rgba.a == 0) {
+        return PNTR_NEW_COLOR(0, 0, 0, 0);
+    }
+
+    unsigned int alpha = color.rgba.a;
+    color.rgba.r = (unsigned char)PNTR_MIN(255, ((unsigned int)color.rgba.r * 255 + alpha / 2) / alpha);
+    color.rgba.g = (unsigned char)PNTR_MIN(255, ((unsigned int)color.rgba.g * 255 + alpha / 2) / alpha);
+    color.rgba.b = (unsigned char)PNTR_MIN(255, ((unsigned int)color.rgba.b * 255 + alpha / 2) / alpha);
+    return color;
 }
 
 /**
- * Get a pntr_color from a RGBA hexadecimal value
+ * Alpha blends a row of premultiplied source pixels into a row of premultiplied destination pixels.
  *
- * @param hexValue The RGBA hexadecimal value representing the color. For example: 0x052c46ff.
+ * The result is the same as calling pntr_blend_color_premultiplied() on each pixel.
  *
- * @return The color representing the given hex value.
+ * @param dst The first destination pixel.
+ * @param src The first source pixel.
+ * @param width The number of pixels to blend.
+ *
+ * @see pntr_blend_color_premultiplied()
+ * @internal
  */
-PNTR_API pntr_color pntr_get_color(unsigned int hexValue) {
-    return PNTR_NEW_COLOR(
-        (unsigned char)((hexValue >> 24U) & (unsigned int)0xFF),
-        (unsigned char)((hexValue >> 16U) & (unsigned int)0xFF),
-        (unsigned char)((hexValue >> 8U) & (unsigned int)0xFF),
-        (unsigned char)(hexValue & (unsigned int)0xFF)
-    );
-}
+static void _pntr_blend_row_premultiplied(pntr_color* dst, const pntr_color* src, int width) {
+    int x = 0;
 
-PNTR_API unsigned char pntr_color_r(pntr_color color) {
-    return color.rgba.r;
-}
+    #ifndef PNTR_NO_ALPHABLEND
+        #if defined(PNTR_SIMD_SSE2) || defined(PNTR_SIMD_AVX2)
+            pntr_color alphaColor = PNTR_NEW_COLOR(0, 0, 0, 255);
+        #endif
 
-PNTR_API unsigned char pntr_color_g(pntr_color color) {
-    return color.rgba.g;
-}
+        #ifdef PNTR_SIMD_AVX2
+        {
+            const __m256i alphaMask = _mm256_set1_epi32((int)alphaColor.value);
+            const __m256i zero = _mm256_setzero_si256();
+            const __m256i max = _mm256_set1_epi16(255);
+            const __m256i half = _mm256_set1_epi16(128);
+            for (; x + 8 <= width; x += 8) {
+                __m256i srcPixels = _mm256_loadu_si256((const __m256i*)(src + x));
+                if (_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(srcPixels, alphaMask), alphaMask))) == 0xFF) {
+                    _mm256_storeu_si256((__m256i*)(dst + x), srcPixels);
+                    continue;
+                }
+                if (_mm256_movemask_epi8(_mm256_cmpeq_epi32(srcPixels, zero)) == -1) {
+                    continue;
+                }
 
-PNTR_API unsigned char pntr_color_b(pntr_color color) {
-    return color.rgba.b;
-}
+                __m256i dstPixels = _mm256_loadu_si256((const __m256i*)(dst + x));
+                __m256i result[2];
+                for (int part = 0; part < 2; part++) {
+                    __m256i srcChannels = part ? _mm256_unpackhi_epi8(srcPixels, zero) : _mm256_unpacklo_epi8(srcPixels, zero);
+                    __m256i dstChannels = part ? _mm256_unpackhi_epi8(dstPixels, zero) : _mm256_unpacklo_epi8(dstPixels, zero);
+                    __m256i inverse = _mm256_sub_epi16(max, _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(srcChannels, 0xFF), 0xFF));
+                    __m256i product = _mm256_add_epi16(_mm256_mullo_epi16(dstChannels, inverse), half);
+                    result[part] = _mm256_srli_epi16(_mm256_add_epi16(product, _mm256_srli_epi16(product, 8)), 8);
+                }
+                _mm256_storeu_si256((__m256i*)(dst + x), _mm256_adds_epu8(srcPixels, _mm256_packus_epi16(result[0], result[1])));
+            }
+        }
+        #endif
 
-PNTR_API unsigned char pntr_color_a(pntr_color color) {
-    return color.rgba.a;
-}
+        #ifdef PNTR_SIMD_SSE2
+        {
+            const __m128i alphaMask = _mm_set1_epi32((int)alphaColor.value);
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i max = _mm_set1_epi16(255);
+            const __m128i half = _mm_set1_epi16(128);
+            for (; x + 4 <= width; x += 4) {
+                __m128i srcPixels = _mm_loadu_si128((const __m128i*)(src + x));
+                if (_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(srcPixels, alphaMask), alphaMask))) == 0xF) {
+                    _mm_storeu_si128((__m128i*)(dst + x), srcPixels);
+                    continue;
+                }
+                if (_mm_movemask_epi8(_mm_cmpeq_epi32(srcPixels, zero)) == 0xFFFF) {
+                    continue;
+                }
 
-PNTR_API void pntr_color_set_r(pntr_color* color, unsigned char r) {
-    color->rgba.r = r;
-}
+                __m128i dstPixels = _mm_loadu_si128((const __m128i*)(dst + x));
+                __m128i result[2];
+                for (int part = 0; part < 2; part++) {
+                    __m128i srcChannels = part ? _mm_unpackhi_epi8(srcPixels, zero) : _mm_unpacklo_epi8(srcPixels, zero);
+                    __m128i dstChannels = part ? _mm_unpackhi_epi8(dstPixels, zero) : _mm_unpacklo_epi8(dstPixels, zero);
+                    __m128i inverse = _mm_sub_epi16(max, _mm_shufflehi_epi16(_mm_shufflelo_epi16(srcChannels, 0xFF), 0xFF));
+                    __m128i product = _mm_add_epi16(_mm_mullo_epi16(dstChannels, inverse), half);
+                    result[part] = _mm_srli_epi16(_mm_add_epi16(product, _mm_srli_epi16(product, 8)), 8);
+                }
+                _mm_storeu_si128((__m128i*)(dst + x), _mm_adds_epu8(srcPixels, _mm_packus_epi16(result[0], result[1])));
+            }
+        }
+        #endif
 
-PNTR_API void pntr_color_set_g(pntr_color* color, unsigned char g) {
-    color->rgba.g = g;
-}
+        #ifdef PNTR_SIMD_NEON
+        {
+            const uint8x16_t max = vdupq_n_u8(255);
+            const uint16x8_t half = vdupq_n_u16(128);
+            for (; x + 16 <= width; x += 16) {
+                uint8x16x4_t srcPixels = vld4q_u8((const uint8_t*)(src + x));
+                if (_pntr_neon_all(vceqq_u8(srcPixels.val[3], max))) {
+                    vst4q_u8((uint8_t*)(dst + x), srcPixels);
+                    continue;
+                }
 
-PNTR_API void pntr_color_set_b(pntr_color* color, unsigned char b) {
-    color->rgba.b = b;
-}
+                uint8x16x4_t dstPixels = vld4q_u8((const uint8_t*)(dst + x));
+                uint8x16_t inverse = vmvnq_u8(srcPixels.val[3]);
+                for (int channel = 0; channel < 4; channel++) {
+                    uint16x8_t low = vaddq_u16(vmull_u8(vget_low_u8(dstPixels.val[channel]), vget_low_u8(inverse)), half);
+                    uint16x8_t high = vaddq_u16(vmull_u8(vget_high_u8(dstPixels.val[channel]), vget_high_u8(inverse)), half);
+                    uint8x16_t scaled = vcombine_u8(
+                        vshrn_n_u16(vaddq_u16(low, vshrq_n_u16(low, 8)), 8),
+                        vshrn_n_u16(vaddq_u16(high, vshrq_n_u16(high, 8)), 8));
+                    dstPixels.val[channel] = vqaddq_u8(srcPixels.val[channel], scaled);
+                }
+                vst4q_u8((uint8_t*)(dst + x), dstPixels);
+            }
+        }
+        #endif
+    #endif
 
-PNTR_API void pntr_color_set_a(pntr_color* color, unsigned char a) {
-    color->rgba.a = a;
+    for (; x < width; x++) {
+        pntr_blend_color_premultiplied(dst + x, src[x]);
+    }
 }
 
 /**
- * Draws a point on the given image, without safety checks.
+ * Per-channel lookup tables for tinting colors with one tint color.
+ *
+ * @see _pntr_tint_table_init()
+ * @internal
  */
-PNTR_API void pntr_draw_point_unsafe(pntr_image* dst, int x, int y, pntr_color color) {
-    pntr_blend_color(&PNTR_PIXEL(dst, x, y), color);
-}
+typedef struct _pntr_tint_table {
+    pntr_color tint; /** The tint the tables were built for. */
+    bool ready; /** Whether the tables have been built. */
+    unsigned char r[256]; /** The tinted red channel values. */
+    unsigned char g[256]; /** The tinted green channel values. */
+    unsigned char b[256]; /** The tinted blue channel values. */
+    unsigned char a[256]; /** The tinted alpha channel values. */
+} _pntr_tint_table;
 
 /**
- * Draws a pixel on the given image.
+ * Builds the lookup tables for the given tint, unless they were already built for it.
+ *
+ * The values come from pntr_color_tint(), so tinting through the tables gives the exact same colors.
+ *
+ * @internal
  */
-PNTR_API void pntr_draw_point(pntr_image* dst, int x, int y, pntr_color color) {
-   if ((color.rgba.a == 0) || (dst == NULL) || (x < dst->clip.x) || (x >= dst->clip.x + dst->clip.width) || (y < dst->clip.y) || (y >= dst->clip.y + dst->clip.height)) {
+static void _pntr_tint_table_init(_pntr_tint_table* table, pntr_color tint) {
+    if (table->ready && table->tint.value == tint.value) {
         return;
     }
 
-    pntr_draw_point_unsafe(dst, x, y, color);
-}
-
-PNTR_API void pntr_draw_point_vec(pntr_image* dst, pntr_vector* point, pntr_color color) {
-    if (point != NULL) {
-        pntr_draw_point(dst, point->x, point->y, color);
+    for (int value = 0; value < 256; value++) {
+        pntr_color tinted = pntr_color_tint(PNTR_NEW_COLOR((unsigned char)value, (unsigned char)value, (unsigned char)value, (unsigned char)value), tint);
+        table->r[value] = tinted.rgba.r;
+        table->g[value] = tinted.rgba.g;
+        table->b[value] = tinted.rgba.b;
+        table->a[value] = tinted.rgba.a;
     }
-}
 
-PNTR_API void pntr_draw_points(pntr_image* dst, pntr_vector* points, int pointsCount, pntr_color color) {
-    if (dst == NULL || color.rgba.a == 0 || points == NULL || pointsCount <= 0) {
-        return;
-    }
+    table->tint = tint;
+    table->ready = true;
+}
 
-    for (int i = 0; i < pointsCount; i++) {
-        if (points[i].x >= dst->clip.x && points[i].x < dst->clip.x + dst->clip.width && points[i].y >= dst->clip.y && points[i].y < dst->clip.y + dst->clip.height) {
-            pntr_draw_point_unsafe(dst, points[i].x, points[i].y, color);
-        }
+/**
+ * Maps each channel of a row of pixels through the given 256 entry lookup tables.
+ *
+ * @see _pntr_tint_table_init()
+ * @internal
+ */
+static void _pntr_color_map_row(pntr_color* dst, const pntr_color* src, int width, const unsigned char* r, const unsigned char* g, const unsigned char* b, const unsigned char* a) {
+    for (int x = 0; x < width; x++) {
+        pntr_color color = src[x];
+        color.rgba.r = r[color.rgba.r];
+        color.rgba.g = g[color.rgba.g];
+        color.rgba.b = b[color.rgba.b];
+        color.rgba.a = a[color.rgba.a];
+        dst[x] = color;
     }
 }
 
 /**
- * Draws a line on the given image.
+ * Alpha blends a row of source pixels into a row of the destination image, depending on whether it is premultiplied.
  *
- * TODO: pntr_draw_line: Add anti-aliased, and thickness to the lines.
+ * @param dst The destination image.
+ * @param dstPixel The first pixel in the destination image.
+ * @param src The first source pixel, in the same alpha representation as the destination image.
+ * @param width The number of pixels to blend.
  *
- * @see pntr_draw_line_horizontal()
- * @see pntr_draw_line_vertical()
+ * @internal
  */
-PNTR_API void pntr_draw_line(pntr_image *dst, int startPosX, int startPosY, int endPosX, int endPosY, pntr_color color) {
-    if (dst == NULL || color.rgba.a == 0) {
-        return;
+static void _pntr_blend_image_row(pntr_image* dst, pntr_color* dstPixel, const pntr_color* src, int width) {
+    if (dst->premultiplied) {
+        _pntr_blend_row_premultiplied(dstPixel, src, width);
     }
-
-    int changeInX = (endPosX - startPosX);
-    int absChangeInX = (changeInX < 0) ? -changeInX : changeInX;
-    int changeInY = (endPosY - startPosY);
-    int absChangeInY = (changeInY < 0) ? -changeInY : changeInY;
-
-    // Drawing a straight line is fast.
-    if (startPosX == endPosX) {
-        pntr_draw_line_vertical(dst, startPosX, (startPosY > endPosY) ? endPosY : startPosY, absChangeInY, color);
-        return;
+    else {
+        _pntr_blend_row(dstPixel, src, width);
     }
+}
 
-    if (startPosY == endPosY) {
-        pntr_draw_line_horizontal(dst, (startPosX > endPosX) ? endPosX : startPosX, startPosY, absChangeInX, color);
-        return;
+/**
+ * Marks the cached opacity of the image, and of the image that owns its pixels, as unknown, and unloads their mipmaps.
+ *
+ * @see pntr_image_get_opacity()
+ * @internal
+ */
+static void _pntr_image_modified(pntr_image* image) {
+    image->opacity = PNTR_OPACITY_UNKNOWN;
+    if (image->mipmap != NULL) {
+        pntr_image_unload_mipmaps(image);
     }
-
-    int startU, startV, endU, stepV;
-    int A, B, P;
-    int reversedXY = (absChangeInY < absChangeInX);
-
-    if (reversedXY) {
-        A = 2 * absChangeInY;
-        B = A - 2 * absChangeInX;
-        P = A - absChangeInX;
-
-        if (changeInX > 0) {
-            startU = startPosX;
-            startV = startPosY;
-            endU = endPosX;
-            //endV = endPosY;
-        }
-        else {
-            startU = endPosX;
-            startV = endPosY;
-            endU = startPosX;
-            //endV = startPosY;
-
-            // Since start and end are reversed
-            changeInX = -changeInX;
-            changeInY = -changeInY;
+    if (image->parent != NULL) {
+        image->parent->opacity = PNTR_OPACITY_UNKNOWN;
+        if (image->parent->mipmap != NULL) {
+            pntr_image_unload_mipmaps(image->parent);
         }
-
-        stepV = (changeInY < 0) ? -1 : 1;
-
-        pntr_draw_point(dst, startU, startV, color);
     }
-    else {
-        A = 2 * absChangeInX;
-        B = A - 2 * absChangeInY;
-        P = A - absChangeInY;
+}
 
-        if (changeInY > 0) {
-            startU = startPosY;
-            startV = startPosX;
-            endU = endPosY;
+/**
+ * Reads the alpha of every pixel to determine the opacity of the image.
+ *
+ * @see pntr_image_get_opacity()
+ * @internal
+ */
+static pntr_opacity _pntr_image_scan_opacity(pntr_image* image) {
+    unsigned char all = 255;
+    unsigned char any = 0;
+    for (int y = 0; y < image->height; y++) {
+        pntr_color* pixel = &PNTR_PIXEL(image, 0, y);
+        for (int x = 0; x < image->width; x++) {
+            all &= pixel[x].rgba.a;
+            any |= pixel[x].rgba.a;
         }
-        else {
-            startU = endPosY;
-            startV = endPosX;
-            endU = startPosY;
 
-            changeInX = -changeInX;
-            changeInY = -changeInY;
+        // Stop as soon as there is something that isn't opaque, and something that isn't transparent.
+        if (all != 255 && any != 0) {
+            return PNTR_OPACITY_MIXED;
         }
-
-        stepV = (changeInX < 0) ? -1 : 1;
-
-        pntr_draw_point(dst, startV, startU, color);
     }
 
-    for (int u = startU + 1, v = startV; u <= endU; u++) {
-        if (P >= 0) {
-            v += stepV;
-            P += B;
-        }
-        else {
-            P += A;
-        }
-
-        if (reversedXY) {
-            pntr_draw_point(dst, u, v, color);
-        }
-        else {
-            pntr_draw_point(dst, v, u, color);
-        }
-    }
+    return (all == 255) ? PNTR_OPACITY_OPAQUE : PNTR_OPACITY_TRANSPARENT;
 }
 
 /**
- * Draws a line on the given image, with thickness
+ * Gets the opacity of the image, without having to read any pixels.
+ *
+ * A subimage of a fully opaque or fully transparent image shares the same opacity.
+ *
+ * @internal
  */
-PNTR_API void pntr_draw_line_thick(pntr_image *dst, int startPosX, int startPosY, int endPosX, int endPosY, int thickness, pntr_color color) {
-    if (thickness < 1) {
-        return;
-    }
-    if (thickness == 1) {
-        pntr_draw_line(dst, startPosX, startPosY, endPosX, endPosY, color);
-        return;
+static pntr_opacity _pntr_image_cached_opacity(pntr_image* image) {
+    if (image->subimage) {
+        if (image->parent == NULL || image->parent->opacity == PNTR_OPACITY_MIXED) {
+            return PNTR_OPACITY_UNKNOWN;
+        }
+        image = image->parent;
     }
 
-    if (dst == NULL || color.rgba.a == 0) {
-        return;
+    // Pixel data the image doesn't own may be changed by whoever owns it.
+    if (!image->owned) {
+        return PNTR_OPACITY_UNKNOWN;
     }
 
-    int changeInX = (endPosX - startPosX);
-    int absChangeInX = (changeInX < 0) ? -changeInX : changeInX;
-    int changeInY = (endPosY - startPosY);
-    int absChangeInY = (changeInY < 0) ? -changeInY : changeInY;
+    return image->opacity;
+}
 
-    // Drawing a straight line is fast.
-    if (startPosX == endPosX) {
-        pntr_draw_line_vertical_thick(dst, startPosX, (startPosY > endPosY) ? endPosY : startPosY, absChangeInY, thickness, color);
-        return;
+/**
+ * Gets whether the image is fully opaque, fully transparent, or a mix of both.
+ *
+ * The result is cached on the image until it is drawn to again, so only the first call reads the pixels.
+ *
+ * @param image The image to check.
+ *
+ * @return The opacity of the image, or PNTR_OPACITY_UNKNOWN if the image is invalid, or wraps pixel data it doesn't
+ *         own, which could change at any time.
+ *
+ * @see pntr_image_from_pixels()
+ *
+ * @see pntr_opacity
+ */
+PNTR_API pntr_opacity pntr_image_get_opacity(pntr_image* image) {
+    if (image == NULL) {
+        return PNTR_OPACITY_UNKNOWN;
     }
 
-    if (startPosY == endPosY) {
-        pntr_draw_line_horizontal_thick(dst, (startPosX > endPosX) ? endPosX : startPosX, startPosY, absChangeInX, thickness, color);
-        return;
+    pntr_opacity opacity = _pntr_image_cached_opacity(image);
+    if (opacity != PNTR_OPACITY_UNKNOWN) {
+        return opacity;
     }
 
-    int startU, startV, endU, stepV;
-    int A, B, P;
-    int reversedXY = (absChangeInY < absChangeInX);
-
-    if (reversedXY) {
-        A = 2 * absChangeInY;
-        B = A - 2 * absChangeInX;
-        P = A - absChangeInX;
-
-        if (changeInX > 0) {
-            startU = startPosX;
-            startV = startPosY;
-            endU = endPosX;
-            //endV = endPosY;
-        }
-        else {
-            startU = endPosX;
-            startV = endPosY;
-            endU = startPosX;
-            //endV = startPosY;
-
-            // Since start and end are reversed
-            changeInX = -changeInX;
-            changeInY = -changeInY;
-        }
-
-        stepV = (changeInY < 0) ? -1 : 1;
-
-        // pntr_draw_point(dst, startU, startV, color);
-        pntr_draw_circle_fill(dst, startU, startV, thickness/2, color);
+    pntr_image* owner = image->subimage ? image->parent : image;
+    if (owner == NULL || !owner->owned) {
+        return PNTR_OPACITY_UNKNOWN;
     }
-    else {
-        A = 2 * absChangeInX;
-        B = A - 2 * absChangeInY;
-        P = A - absChangeInY;
-
-        if (changeInY > 0) {
-            startU = startPosY;
-            startV = startPosX;
-            endU = endPosY;
-        }
-        else {
-            startU = endPosY;
-            startV = endPosX;
-            endU = startPosY;
-
-            changeInX = -changeInX;
-            changeInY = -changeInY;
-        }
-
-        stepV = (changeInX < 0) ? -1 : 1;
-
-        // pntr_draw_point(dst, startV, startU, color);
-        pntr_draw_circle_fill(dst, startV, startU, thickness/2, color);
 
+    // Subimages share their pixels with other images, so their opacity isn't cached.
+    opacity = _pntr_image_scan_opacity(image);
+    if (!image->subimage) {
+        image->opacity = opacity;
     }
 
-    for (int u = startU + 1, v = startV; u <= endU; u++) {
-        if (P >= 0) {
-            v += stepV;
-            P += B;
-        }
-        else {
-            P += A;
-        }
+    return opacity;
+}
 
-        if (reversedXY) {
-            // pntr_draw_point(dst, u, v, color);
-            pntr_draw_circle_fill(dst, u, v, thickness/2, color);
+/**
+ * Alpha blends a straight alpha color into a run of pixels of the destination image, without clipping.
+ *
+ * @param dst The destination image.
+ * @param pixel The first pixel to blend.
+ * @param count The number of pixels to blend.
+ * @param stride The number of pixels between each pixel of the run. 1 for a row, or `pitch >> 2` for a column.
+ * @param color The color to blend, with straight alpha.
+ *
+ * The caller marks the image as modified, once per draw.
+ *
+ * @see _pntr_image_modified()
+ * @internal
+ */
+static void _pntr_blend_color_run(pntr_image* dst, pntr_color* pixel, int count, int stride, pntr_color color) {
+    if (dst->premultiplied) {
+        color = pntr_color_alpha_premultiply(color);
+        for (; count > 0; count--, pixel += stride) {
+            pntr_blend_color_premultiplied(pixel, color);
         }
-        else {
-            // pntr_draw_point(dst, v, u, color);
-            pntr_draw_circle_fill(dst, v, u, thickness/2, color);
+    }
+    else {
+        for (; count > 0; count--, pixel += stride) {
+            pntr_blend_color(pixel, color);
         }
     }
 }
 
-PNTR_API void pntr_draw_line_curve(pntr_image* dst, pntr_vector point1, pntr_vector point2, pntr_vector point3, pntr_vector point4, int segments, pntr_color color) {
-    if (dst == NULL || color.rgba.a == 0 || segments <= 0) {
-        return;
+/**
+ * Get a new rectangle representing the intersection of the two given rectangles.
+ *
+ * @code
+ * pntr_rectangle dstRect;
+ * if (!_pntr_rectangle_intersect(10, 10, 20, 20, image->clip.x, image->clip.y, image->clip.width, image>clip.height, dstRect)) {
+ *     return;
+ * }
+ * @endcode
+ *
+ * @param x The input rectangle's x coordinate.
+ * @param y The input rectangle's y coordinate.
+ * @param width The input rectangle's width.
+ * @param height The input rectangle's height.
+ * @param destX The destination x coordinate.
+ * @param destY The destination y coordinate.
+ * @param destWidth The destination rectangle's width.
+ * @param destHeight The destination rectangle's height.
+ * @param out The normalized rectangle.
+ *
+ * @return True if the intersect of the rectangle has a width and height greater than 0, false otherwise.
+ *
+ * @internal
+ */
+PNTR_API bool _pntr_rectangle_intersect(int x, int y, int width, int height, int destX, int destY, int destWidth, int destHeight, pntr_rectangle *out) {
+    if (width <= 0 || height <= 0) {
+        return false;
     }
 
-    float t_step = 1.0f / (float)segments;
-    pntr_vector last = point1;
-    for (int i_step = 1; i_step <= segments; ++i_step) {
-        float t = t_step * (float)i_step;
-        float u = 1.0f - t;
-        float w1 = u * u * u;
-        float w2 = 3 * u * u * t;
-        float w3 = 3 * u * t * t;
-        float w4 = t * t * t;
-        float x = w1 * (float)point1.x + w2 * (float)point2.x + w3 * (float)point3.x + w4 * (float)point4.x;
-        float y = w1 * (float)point1.y + w2 * (float)point2.y + w3 * (float)point3.y + w4 * (float)point4.y;
-        pntr_draw_line(dst, last.x, last.y, (int)x, (int)y, color);
-        last.x = (int)x;
-        last.y = (int)y;
+    out->x = PNTR_MAX(x, destX);
+    out->width = PNTR_MIN(x + width, destX + destWidth) - out->x;
+    if (out->width <= 0) {
+        return false;
     }
-}
 
-PNTR_API void pntr_draw_line_curve_thick(pntr_image* dst, pntr_vector point1, pntr_vector point2, pntr_vector point3, pntr_vector point4, int segments, int thickness, pntr_color color) {
-    if (dst == NULL || color.rgba.a == 0 || segments <= 0) {
-        return;
+    out->y = PNTR_MAX(y, destY);
+    out->height = PNTR_MIN(y + height, destY + destHeight) - out->y;
+    if (out->height <= 0) {
+        return false;
     }
 
-    float t_step = 1.0f / (float)segments;
-    pntr_vector last = point1;
-    for (int i_step = 1; i_step <= segments; ++i_step) {
-        float t = t_step * (float)i_step;
-        float u = 1.0f - t;
-        float w1 = u * u * u;
-        float w2 = 3 * u * u * t;
-        float w3 = 3 * u * t * t;
-        float w4 = t * t * t;
-        float x = w1 * (float)point1.x + w2 * (float)point2.x + w3 * (float)point3.x + w4 * (float)point4.x;
-        float y = w1 * (float)point1.y + w2 * (float)point2.y + w3 * (float)point3.y + w4 * (float)point4.y;
-        pntr_draw_line_thick(dst, last.x, last.y, (int)x, (int)y, thickness, color);
-        last.x = (int)x;
-        last.y = (int)y;
-    }
+    return true;
 }
 
-PNTR_API void pntr_draw_polyline(pntr_image* dst, pntr_vector* points, int numPoints, pntr_color color) {
-    if (color.rgba.a == 0 || dst == NULL || numPoints <= 0 || points == NULL) {
-        return;
-    }
-
-    if (numPoints == 1) {
-        pntr_draw_point_vec(dst, points, color);
-        return;
+/**
+ * Creates a new image from a section of the original image.
+ *
+ * The new image must be cleared with pntr_unload_image().
+ *
+ * @param image The original image to build the new image from.
+ * @param x The x coordinate to build the new image from.
+ * @param y The y coordinate to build the new image from.
+ * @param width The width of the new image.
+ * @param height The height of the new image.
+ *
+ * @return A new image that is based off of the section of the original image.
+ *
+ * @see pntr_image_subimage()
+ * @see pntr_unload_image()
+ */
+PNTR_API pntr_image* pntr_image_from_image(pntr_image* image, int x, int y, int width, int height) {
+    if (image == NULL) {
+        return (pntr_image*)pntr_set_error(PNTR_ERROR_INVALID_ARGS);
     }
 
-    for (int i = 0; i < numPoints - 1; i++) {
-        pntr_draw_line_vec(dst, points[i], points[i + 1], color);
+    pntr_rectangle dstRect;
+    if (!_pntr_rectangle_intersect(x, y, width, height, 0, 0, image->width, image->height, &dstRect)) {
+        return NULL;
     }
-}
 
-PNTR_API void pntr_draw_polyline_thick(pntr_image* dst, pntr_vector* points, int numPoints, int thickness, pntr_color color) {
-    if (color.rgba.a == 0 || dst == NULL || numPoints <= 0 || points == NULL) {
-        return;
+    pntr_image* result = pntr_new_image(dstRect.width, dstRect.height);
+    if (result == NULL) {
+        return NULL;
     }
+    result->premultiplied = image->premultiplied;
+    result->opacity = _pntr_image_cached_opacity(image);
 
-    if (numPoints == 1) {
-        pntr_draw_point_vec(dst, points, color);
-        return;
+    for (int destY = 0; destY < dstRect.height; destY++) {
+        PNTR_MEMCPY(&PNTR_PIXEL(result, 0, destY),
+            &PNTR_PIXEL(image, dstRect.x, dstRect.y + destY),
+            (size_t)result->width * sizeof(pntr_color));
     }
 
-    for (int i = 0; i < numPoints - 1; i++) {
-        pntr_draw_line_thick_vec(dst, points[i], points[i + 1], thickness, color);
-    }
+    return result;
 }
 
 /**
- * Draw a horizontal line at the given x, y coordinates.
+ * Creates an image that references a section of another image.
  *
- * @param dst The destination image.
- * @param posX The X position.
- * @param posY The Y position.
- * @param width How long the line should be.
- * @param color The color of the line.
+ * This is useful to have images reference a sprite in a tileset. Sub-images still need to be cleared with pntr_unload_image().
+ *
+ * @param image The original image to reference for the new portion of the image.
+ * @param x The X coorindate of the subimage.
+ * @param y The Y coordinate of the subimage.
+ * @param width The width of the subimage.
+ * @param height The height of the subimage.
+ *
+ * @return The pntr_image referencing the section of the given image.
  *
+ * @see pntr_image_from_image()
+ * @see pntr_unload_image()
  */
-PNTR_API void pntr_draw_line_horizontal(pntr_image* dst, int posX, int posY, int width, pntr_color color) {
-    if (width < 0) {
-        posX += width;
-        width = -width;
-    }
-    if (color.rgba.a == 0 || dst == NULL || posY < dst->clip.y || posY >= dst->clip.y + dst->clip.height || posX >= dst->clip.x + dst->clip.width || posX + width < dst->clip.x) {
-        return;
+PNTR_API pntr_image* pntr_image_subimage(pntr_image* image, int x, int y, int width, int height) {
+    if (image == NULL) {
+        return (pntr_image*)pntr_set_error(PNTR_ERROR_INVALID_ARGS);
     }
 
-    if (posX < dst->clip.x) {
-        width += posX - dst->clip.x;
-        posX = dst->clip.x;
-    }
-    if (posX + width >= dst->clip.x + dst->clip.width) {
-        width = dst->clip.x + dst->clip.width - posX;
+    // Ensure we are referencing an actual portion of the image.
+    pntr_rectangle dstRect;
+    if (!_pntr_rectangle_intersect(x, y, width, height, 0, 0, image->width, image->height, &dstRect)) {
+        return NULL;
     }
 
-    if (color.rgba.a == 255) {
-        pntr_put_horizontal_line_unsafe(dst, posX, posY, width, color);
-    }
-    else {
-        pntr_color *row = &PNTR_PIXEL(dst, posX, posY);
-        while (--width >= 0) {
-            pntr_blend_color(row + width, color);
-        }
+    // Build the subimage.
+    pntr_image* subimage = (pntr_image*)PNTR_MALLOC(sizeof(pntr_image));
+    if (subimage == NULL) {
+        return (pntr_image*)pntr_set_error(PNTR_ERROR_NO_MEMORY);
     }
-}
 
-PNTR_API void pntr_draw_line_horizontal_thick(pntr_image* dst, int posX, int posY, int width, int thickness, pntr_color color) {
-    if (thickness == 0) {
-        return;
-    }
-    if (thickness == 1) {
-        pntr_draw_line_horizontal(dst, posX, posY, width, color);
-        return;
-    }
+    subimage->pitch = image->pitch;
+    subimage->width = dstRect.width;
+    subimage->height = dstRect.height;
+    subimage->subimage = true;
+    subimage->owned = false;
+    subimage->aligned = false;
+    subimage->premultiplied = image->premultiplied;
+    subimage->opacity = PNTR_OPACITY_UNKNOWN;
+    subimage->parent = image->subimage ? image->parent : image;
+    subimage->mipmap = NULL;
+    pntr_image_reset_clip(subimage);
+    subimage->data = &PNTR_PIXEL(image, dstRect.x, dstRect.y);
 
-    pntr_draw_rectangle_fill(dst, posX, posY - thickness / 2, width, thickness, color);
-    pntr_draw_circle_fill(dst, posX, posY, thickness / 2, color);
-    pntr_draw_circle_fill(dst, posX + width, posY, thickness / 2, color);
+    return subimage;
 }
 
 /**
- * Draw a vertical line at the given x, y coordinates.
+ * Creates an image that draws directly into the given pixel data, without copying it.
  *
- * @param dst The destination image.
- * @param posX The X position.
- * @param posY The Y position.
- * @param height How tall the line should be.
- * @param color The color of the line.
+ * This allows rendering straight into a framebuffer or shared memory surface. The pixel data must be in the pixel
+ * format of the application, either RGBA or ARGB. Unless the image owns the data, its opacity is never cached, so
+ * the data may be changed at any time.
+ *
+ * @param data The pixel data to wrap.
+ * @param width The width of the image.
+ * @param height The height of the image.
+ * @param pitch The amount of bytes between each row of the pixel data, which must be a multiple of 4. Use 0 when the rows are tightly packed.
+ * @param owned Whether or not pntr_unload_image() should free the pixel data. Owned data must be allocated with PNTR_MALLOC().
  *
+ * @return The image wrapping the given pixel data, or NULL on failure.
+ *
+ * @see pntr_image_from_pixelformat()
+ * @see pntr_unload_image()
  */
-PNTR_API void pntr_draw_line_vertical(pntr_image* dst, int posX, int posY, int height, pntr_color color) {
-    if (height < 0) {
-        posY += height;
-        height = -height;
+PNTR_API pntr_image* pntr_image_from_pixels(pntr_color* data, int width, int height, int pitch, bool owned) {
+    if (pitch <= 0) {
+        pitch = width * (int)sizeof(pntr_color);
     }
-    if (color.rgba.a == 0 || dst == NULL || posX < dst->clip.x || posX >= dst->clip.x + dst->clip.width || posY >= dst->clip.y + dst->clip.height || posY + height < dst->clip.y) {
-        return;
+
+    if (data == NULL || width <= 0 || height <= 0 || pitch < width * (int)sizeof(pntr_color) || pitch % (int)sizeof(pntr_color) != 0) {
+        return (pntr_image*)pntr_set_error(PNTR_ERROR_INVALID_ARGS);
     }
 
-    if (posY < dst->clip.y) {
-        height += posY - dst->clip.y;
-        posY = dst->clip.y;
-    }
-    if (posY + height >= dst->clip.y + dst->clip.height) {
-        height = dst->clip.y + dst->clip.height - posY;
-    }
-
-    if (color.rgba.a == 255) {
-        for (int y = 0; y < height; y++) {
-            PNTR_PIXEL(dst, posX, posY + y) = color;
-        }
-    }
-    else {
-        for (int y = 0; y < height; y++) {
-            pntr_blend_color(&PNTR_PIXEL(dst, posX, posY + y), color);
-        }
+    pntr_image* image = (pntr_image*)PNTR_MALLOC(sizeof(pntr_image));
+    if (image == NULL) {
+        return (pntr_image*)pntr_set_error(PNTR_ERROR_NO_MEMORY);
     }
-}
 
-PNTR_API void pntr_draw_line_vertical_thick(pntr_image* dst, int posX, int posY, int height, int thickness, pntr_color color) {
-    if (thickness == 0) {
-        return;
-    }
-    if (thickness == 1) {
-        pntr_draw_line_vertical(dst, posX, posY, height, color);
-        return;
-    }
-    pntr_draw_rectangle_fill(dst, posX - thickness / 2, posY, thickness, height, color);
-    pntr_draw_circle_fill(dst, posX, posY, thickness / 2, color);
-    pntr_draw_circle_fill(dst, posX, posY + height, thickness / 2, color);
-}
+    image->data = data;
+    image->pitch = pitch;
+    image->width = width;
+    image->height = height;
+    image->subimage = false;
+    image->owned = owned;
+    image->aligned = false;
+    image->premultiplied = false;
+    image->opacity = PNTR_OPACITY_UNKNOWN;
+    image->parent = NULL;
+    image->mipmap = NULL;
+    pntr_image_reset_clip(image);
 
-/**
- * Draws a rectangle using a rectangle.
- *
- * @param dst Where to draw the rectangle.
- * @param rec The rectangle of which to draw.
- * @param color The color of the lines for the rectangle.
- */
-PNTR_API void pntr_draw_rectangle_rec(pntr_image* dst, pntr_rectangle rec, pntr_color color) {
-    pntr_draw_rectangle(dst, rec.x, rec.y, rec.width, rec.height, color);
+    return image;
 }
 
 /**
- * Draw a rectangle on the given image.
+ * Unloads the given image from memory.
  *
- * @param dst The destination image.
- * @param posX The X position.
- * @param posY The Y position.
- * @param width How wide the rectangle should be.
- * @param height How tall the rectangle should be.
- * @param color The color of the line.
+ * Pixel data that the image does not own, like that of subimages, is left alone. Its mipmap chain is unloaded too.
  *
- * @see pntr_draw_rectangle_rec()
- * @see pntr_draw_rectangle_fill()
+ * @param image The image to unload from memory.
  */
-PNTR_API void pntr_draw_rectangle(pntr_image* dst, int posX, int posY, int width, int height, pntr_color color) {
-    if (color.rgba.a == 0 || dst == NULL || width <= 0 || height <= 0) {
+PNTR_API void pntr_unload_image(pntr_image* image) {
+    if (image == NULL) {
         return;
     }
 
-    pntr_draw_line_horizontal(dst, posX, posY, width, color);
-    pntr_draw_line_horizontal(dst, posX, posY + height - 1, width, color);
-    pntr_draw_line_vertical(dst, posX, posY + 1, height - 2, color);
-    pntr_draw_line_vertical(dst, posX + width - 1, posY + 1, height - 2, color);
-}
-
-PNTR_API void pntr_draw_rectangle_thick(pntr_image* dst, int posX, int posY, int width, int height, int thickness, pntr_color color) {
-    for (int i = 0; i < thickness; i++) {
-        pntr_draw_rectangle(dst, posX + i, posY + i, width - i * 2, height - i * 2, color);
-    }
-}
+    // Only clear image data that the image owns.
+    _pntr_image_free_data(image);
+    pntr_image_unload_mipmaps(image);
 
-PNTR_API void pntr_draw_rectangle_thick_rec(pntr_image* dst, pntr_rectangle rect, int thickness, pntr_color color) {
-    pntr_draw_rectangle_thick(dst, rect.x, rect.y, rect.width, rect.height, thickness, color);
+    PNTR_FREE(image);
 }
 
 /**
- * Draws a filled rectangle on the given image.
+ * Reduces an image to half its size, averaging each 2x2 block of pixels.
  *
- * @param dst The destination image.
- * @param posX The X position.
- * @param posY The Y position.
- * @param width How wide the rectangle should be.
- * @param height How tall the rectangle should be.
- * @param color The color of the rectangle.
+ * Odd sizes round up, with the last column or row averaged with itself. Straight alpha pixels are weighted by their
+ * alpha, so that transparent pixels do not darken their neighbours.
  *
- * @see pntr_draw_rectangle()
- */
-PNTR_API void pntr_draw_rectangle_fill(pntr_image* dst, int posX, int posY, int width, int height, pntr_color color) {
-    pntr_draw_rectangle_fill_rec(dst, PNTR_CLITERAL(pntr_rectangle) { posX, posY, width, height }, color);
-}
-
-/**
- * Draws a filled rectangle on the given image, using a rectangle as input data.
+ * @param image The image to reduce.
  *
- * @param dst The destination image.
- * @param rect The rectangle of which to draw.
- * @param color The color of the rectangle.
+ * @return The new image, or NULL on failure.
  *
- * @see pntr_draw_rectangle_fill()
+ * @see pntr_image_gen_mipmaps()
+ * @internal
  */
-PNTR_API void pntr_draw_rectangle_fill_rec(pntr_image* dst, pntr_rectangle rect, pntr_color color) {
-    if (color.rgba.a == 0 || dst == NULL) {
-        return;
-    }
-
-    if (!_pntr_rectangle_intersect(rect.x, rect.y, rect.width, rect.height, dst->clip.x, dst->clip.y, dst->clip.width, dst->clip.height, &rect)) {
-        return;
+static pntr_image* _pntr_image_mipmap_reduce(pntr_image* image) {
+    pntr_image* output = pntr_new_image((image->width + 1) >> 1, (image->height + 1) >> 1);
+    if (output == NULL) {
+        return NULL;
     }
 
-    // When the color is solid, we can do some performance improvements.
-    if (color.rgba.a == 255) {
-        pntr_put_horizontal_line_unsafe(dst, rect.x, rect.y, rect.width, color);
-
-        pntr_color* srcPixel = &PNTR_PIXEL(dst, rect.x, rect.y);
-        for (int y = rect.y + 1; y < rect.y + rect.height; y++) {
-            PNTR_MEMCPY(&PNTR_PIXEL(dst, rect.x, y), srcPixel, (size_t)rect.width * sizeof(pntr_color));
-        }
-    }
-    else {
-        for (int y = 0; y < rect.height; y++) {
-            pntr_color* col = &PNTR_PIXEL(dst, rect.x, rect.y + y);
-            for (int x = 0; x < rect.width; x++) {
-                pntr_blend_color(col++, color);
+    output->premultiplied = image->premultiplied;
+    for (int y = 0; y < output->height; y++) {
+        pntr_color* row0 = &PNTR_PIXEL(image, 0, y << 1);
+        pntr_color* row1 = &PNTR_PIXEL(image, 0, PNTR_MIN((y << 1) + 1, image->height - 1));
+        pntr_color* pixel = &PNTR_PIXEL(output, 0, y);
+        for (int x = 0; x < output->width; x++) {
+            int x0 = x << 1;
+            int x1 = PNTR_MIN(x0 + 1, image->width - 1);
+            pntr_color c00 = row0[x0];
+            pntr_color c10 = row0[x1];
+            pntr_color c01 = row1[x0];
+            pntr_color c11 = row1[x1];
+            unsigned int alpha = (unsigned int)c00.rgba.a + c10.rgba.a + c01.rgba.a + c11.rgba.a;
+
+            // Premultiplied and opaque pixels average each channel on its own.
+            if (image->premultiplied || alpha == 1020) {
+                pixel[x] = PNTR_NEW_COLOR(
+                    (unsigned char)(((unsigned int)c00.rgba.r + c10.rgba.r + c01.rgba.r + c11.rgba.r + 2) >> 2),
+                    (unsigned char)(((unsigned int)c00.rgba.g + c10.rgba.g + c01.rgba.g + c11.rgba.g + 2) >> 2),
+                    (unsigned char)(((unsigned int)c00.rgba.b + c10.rgba.b + c01.rgba.b + c11.rgba.b + 2) >> 2),
+                    (unsigned char)((alpha + 2) >> 2)
+                );
+            }
+            else if (alpha == 0) {
+                pixel[x] = PNTR_BLANK;
+            }
+            else {
+                #define _PNTR_MIPMAP_CHANNEL(channel) (unsigned char)(( \
+                    (unsigned int)c00.rgba.channel * c00.rgba.a + (unsigned int)c10.rgba.channel * c10.rgba.a + \
+                    (unsigned int)c01.rgba.channel * c01.rgba.a + (unsigned int)c11.rgba.channel * c11.rgba.a + (alpha >> 1)) / alpha)
+                pixel[x] = PNTR_NEW_COLOR(
+                    _PNTR_MIPMAP_CHANNEL(r),
+                    _PNTR_MIPMAP_CHANNEL(g),
+                    _PNTR_MIPMAP_CHANNEL(b),
+                    (unsigned char)((alpha + 2) >> 2)
+                );
+                #undef _PNTR_MIPMAP_CHANNEL
             }
         }
     }
-}
 
-PNTR_API void pntr_draw_rectangle_gradient_rec(pntr_image* dst, pntr_rectangle rect, pntr_color topLeft, pntr_color topRight, pntr_color bottomLeft, pntr_color bottomRight) {
-    if (dst == NULL) {
-        return;
-    }
+    return output;
+}
 
-    pntr_rectangle dstRect;
-    if (!_pntr_rectangle_intersect(rect.x, rect.y, rect.width, rect.height, dst->clip.x, dst->clip.y, dst->clip.width, dst->clip.height, &dstRect)) {
-        return;
+/**
+ * Generates the mipmap chain of an image, halving its size at each level down to a single pixel.
+ *
+ * pntr_draw_image_scaled() and pntr_draw_image_scaled_rec() sample the levels that match their scale when the image is
+ * drawn smaller than its size, which avoids the shimmering of minified sprites. The chain is a copy of the image as it
+ * is now: drawing into the image unloads it, and changing its pixels directly needs the chain generated again. Any
+ * existing chain is replaced.
+ *
+ * @param image The image to generate the mipmaps for.
+ *
+ * @return True when the chain was generated, false on failure.
+ *
+ * @see pntr_image_unload_mipmaps()
+ * @see pntr_unload_image()
+ */
+PNTR_API bool pntr_image_gen_mipmaps(pntr_image* image) {
+    if (image == NULL) {
+        pntr_set_error(PNTR_ERROR_INVALID_ARGS);
+        return false;
     }
 
-    // Protect against division by zero.
-    if (rect.width == 0 || rect.height == 0) {
-        return;
-    }
+    pntr_image_unload_mipmaps(image);
 
-    float width = (float)rect.width;
-    float height = (float)rect.height;
-    for (int x = dstRect.x; x < dstRect.x + dstRect.width; x++) {
-        float factorX = (float)(x - rect.x) / width;
-        for (int y = dstRect.y; y < dstRect.y + dstRect.height; y++) {
-            pntr_draw_point_unsafe(dst, x, y, pntr_color_bilinear_interpolate(
-                topLeft, bottomLeft,
-                topRight, bottomRight,
-                factorX,
-                (float)(y - rect.y) / height
-            ));
+    pntr_image* level = image;
+    while (level->width > 1 || level->height > 1) {
+        level->mipmap = _pntr_image_mipmap_reduce(level);
+        if (level->mipmap == NULL) {
+            pntr_image_unload_mipmaps(image);
+            return false;
         }
+
+        level = level->mipmap;
     }
-}
 
-PNTR_API void pntr_draw_rectangle_gradient(pntr_image* dst, int x, int y, int width, int height, pntr_color topLeft, pntr_color topRight, pntr_color bottomLeft, pntr_color bottomRight) {
-    pntr_draw_rectangle_gradient_rec(dst, PNTR_CLITERAL(pntr_rectangle) {x, y, width, height}, topLeft, topRight, bottomLeft, bottomRight);
+    return true;
 }
 
 /**
- * Draws a circle from the given center, with the given radius.
- *
- * This uses the Midpoint Circle Algorithm:
- *   https://en.wikipedia.org/wiki/Midpoint_circle_algorithm
- *
- * TODO: pntr_draw_circle: Add anti-aliased, and thickness.
+ * Unloads the mipmap chain of an image, keeping the image itself.
  *
- * @param dst The image to draw the circle onto.
- * @param centerX The center of the circle at the X coordinate.
- * @param centerY The center of the circle at the Y coordinate.
- * @param radius The radius of the circle.
- * @param color The desired color of the circle.
+ * @param image The image to unload the mipmaps of.
  *
- * @see pntr_draw_circle_fill()
+ * @see pntr_image_gen_mipmaps()
  */
-PNTR_API void pntr_draw_circle(pntr_image* dst, int centerX, int centerY, int radius, pntr_color color) {
-    if (dst == NULL || color.rgba.a == 0) {
+PNTR_API void pntr_image_unload_mipmaps(pntr_image* image) {
+    if (image == NULL) {
         return;
     }
 
-    if (radius == 0) {
-        return;
+    pntr_image* level = image->mipmap;
+    image->mipmap = NULL;
+    while (level != NULL) {
+        pntr_image* next = level->mipmap;
+        _pntr_image_free_data(level);
+        PNTR_FREE(level);
+        level = next;
     }
+}
 
-    if (radius < 0) {
-        radius = -radius;
+/**
+ * Draws a line on the destination image, ignoring clipping and bounds.
+ */
+PNTR_API void pntr_put_horizontal_line_unsafe(pntr_image* dst, int posX, int posY, int width, pntr_color color) {
+    _pntr_image_modified(dst);
+    pntr_color *row = &PNTR_PIXEL(dst, posX, posY);
+    while (--width >= 0) {
+        row[width] = color;
     }
+}
 
-    if (radius == 1) {
-        pntr_draw_point(dst, centerX, centerY, color);
-        return;
+/**
+ * Fills a horizontal span that is already clipped, either writing or blending the color.
+ *
+ * @internal
+ */
+static void _pntr_fill_span(pntr_image* dst, int posX, int posY, int width, pntr_color color) {
+    if (color.rgba.a == 255) {
+        pntr_put_horizontal_line_unsafe(dst, posX, posY, width, color);
     }
-
-    // Check that the circle is in the bounds.
-    if (centerX + radius < dst->clip.x || centerY + radius < dst->clip.y || centerX - radius > dst->clip.x + dst->clip.width || centerY - radius > dst->clip.y + dst->clip.height) {
-        return;
+    else {
+        _pntr_image_modified(dst);
+        _pntr_blend_color_run(dst, &PNTR_PIXEL(dst, posX, posY), width, 1, color);
     }
+}
 
-    int largestX = radius;
-    int r2 = radius * radius;
-    for (int y = 0; y <= radius; ++y) {
-        int y2 = y * y;
-        for (int x = largestX; x >= 0; --x) {
-            if (x * x + y2 <= r2) {
-                pntr_draw_point(dst, centerX + x, centerY + y, color);
-                pntr_draw_point(dst, centerX - x, centerY + y, color);
-                pntr_draw_point(dst, centerX + x, centerY - y, color);
-                pntr_draw_point(dst, centerX - x, centerY - y, color);
-                pntr_draw_point(dst, centerX + y, centerY + x, color);
-                pntr_draw_point(dst, centerX - y, centerY + x, color);
-                pntr_draw_point(dst, centerX + y, centerY - x, color);
-                pntr_draw_point(dst, centerX - y, centerY - x, color);
-                largestX = x;
-                break;
-            }
-        }
+/**
+ * Fills the pixels of a row from left up to, but not including, right. The row must already be within the clip, and
+ * the span is clipped horizontally.
+ *
+ * @internal
+ */
+static void _pntr_fill_row(pntr_image* dst, int left, int right, int posY, pntr_color color) {
+    left = PNTR_MAX(left, dst->clip.x);
+    right = PNTR_MIN(right, dst->clip.x + dst->clip.width);
+    if (left < right) {
+        _pntr_fill_span(dst, left, posY, right - left, color);
     }
 }
 
 /**
- * Draws a filled circle on the given image.
- *
- * TODO: pntr_draw_circle_fill: Add anti-aliased.
+ * Clears an image with the given color.
  *
- * @param dst The image to draw the filled circle onto.
- * @param centerX The center of the circle at the X coordinate.
- * @param centerY The center of the circle at the Y coordinate.
- * @param radius The radius of the circle.
- * @param color The desired fill color of the circle.
+ * @details Clearing the background ignores clipping.
  *
- * @see pntr_draw_circle()
+ * @param image The image to clear.
+ * @param color The color to fill the image with.
  */
-PNTR_API void pntr_draw_circle_fill(pntr_image* dst, int centerX, int centerY, int radius, pntr_color color) {
-    if (radius == 0) {
+PNTR_API void pntr_clear_background(pntr_image* image, pntr_color color) {
+    if (image == NULL) {
         return;
     }
 
-    if (radius < 0) {
-        radius = -radius;
+    if (image->premultiplied) {
+        color = pntr_color_alpha_premultiply(color);
     }
 
-    if (radius == 1) {
-        pntr_draw_point(dst, centerX, centerY, color);
-        return;
-    }
+    size_t rowSize = (size_t)image->width * sizeof(pntr_color);
 
-    if (dst == NULL || color.rgba.a == 0 || radius == 0 || centerX + radius < dst->clip.x || centerX - radius >= dst->clip.x + dst->clip.width || centerY + radius < dst->clip.y || centerY - radius >= dst->clip.y + dst->clip.height) {
-        return;
+    // Blank or white can have some performance optimization.
+    if (color.value == PNTR_WHITE_VALUE || color.rgba.a == 0) {
+        if ((size_t)image->pitch == rowSize) {
+            PNTR_MEMSET((void*)image->data, (color.rgba.a == 0) ? 0 : 255, rowSize * (size_t)image->height);
+        }
+        else {
+            // Leave the rest of each row alone, as it may belong to another image.
+            for (int y = 0; y < image->height; y++) {
+                PNTR_MEMSET((void*)&PNTR_PIXEL(image, 0, y), (color.rgba.a == 0) ? 0 : 255, rowSize);
+            }
+        }
     }
+    else {
+        // Draw the first line
+        pntr_put_horizontal_line_unsafe(image, 0, 0, image->width, color);
 
-    int largestX = radius;
-    int r2 = radius * radius;
-    for (int y = 0; y <= radius; ++y) {
-        int y2 = y * y;
-        for (int x = largestX; x >= 0; --x) {
-            if (x * x + y2 <= r2) {
-                pntr_draw_line_horizontal(dst, centerX - x, centerY + y, x, color);
-                pntr_draw_line_horizontal(dst, centerX - x, centerY - y, x, color);
-                pntr_draw_line_horizontal(dst, centerX, centerY + y, x, color);
-                pntr_draw_line_horizontal(dst, centerX, centerY - y, x, color);
-                largestX = x;
-                break;
-            }
+        // Copy the line for the rest of the background
+        for (int y = 1; y < image->height; y++) {
+            PNTR_MEMCPY(&PNTR_PIXEL(image, 0, y), image->data, rowSize);
         }
     }
+
+    // The whole image is now the same color.
+    if (image->subimage) {
+        _pntr_image_modified(image);
+    }
+    else {
+        image->opacity = (color.rgba.a == 255) ? PNTR_OPACITY_OPAQUE : (color.rgba.a == 0) ? PNTR_OPACITY_TRANSPARENT : PNTR_OPACITY_MIXED;
+    }
 }
 
 /**
- * Draws a circle from the given center, with the given radius & line-thickness.
+ * Creates a new color, provided the given red, green, blue, and alpha colors.
  *
- * @param dst The image to draw the circle onto.
- * @param centerX The center of the circle at the X coordinate.
- * @param centerY The center of the circle at the Y coordinate.
- * @param radius The radius of the circle.
- * @param color The desired color of the circle.
+ * @param red The red channel.
+ * @param green The green channel.
+ * @param blue The blue channel.
+ * @param alpha The alpha channel.
  *
+ * @return The color with the given red, green, blue, and alpha components.
  */
-PNTR_API void pntr_draw_circle_thick(pntr_image* dst, int centerX, int centerY, int radius, int thickness, pntr_color color) {
-    if (thickness < 1) {
+PNTR_API pntr_color pntr_new_color(unsigned char red, unsigned char green, unsigned char blue, unsigned char alpha) {
+    return PNTR_NEW_COLOR(red, green, blue, alpha);
+}
+
+/**
+ * Get a pntr_color from a RGBA hexadecimal value
+ *
+ * @param hexValue The RGBA hexadecimal value representing the color. For example: 0x052c46ff.
+ *
+ * @return The color representing the given hex value.
+ */
+PNTR_API pntr_color pntr_get_color(unsigned int hexValue) {
+    return PNTR_NEW_COLOR(
+        (unsigned char)((hexValue >> 24U) & (unsigned int)0xFF),
+        (unsigned char)((hexValue >> 16U) & (unsigned int)0xFF),
+        (unsigned char)((hexValue >> 8U) & (unsigned int)0xFF),
+        (unsigned char)(hexValue & (unsigned int)0xFF)
+    );
+}
+
+PNTR_API unsigned char pntr_color_r(pntr_color color) {
+    return color.rgba.r;
+}
+
+PNTR_API unsigned char pntr_color_g(pntr_color color) {
+    return color.rgba.g;
+}
+
+PNTR_API unsigned char pntr_color_b(pntr_color color) {
+    return color.rgba.b;
+}
+
+PNTR_API unsigned char pntr_color_a(pntr_color color) {
+    return color.rgba.a;
+}
+
+PNTR_API void pntr_color_set_r(pntr_color* color, unsigned char r) {
+    color->rgba.r = r;
+}
+
+PNTR_API void pntr_color_set_g(pntr_color* color, unsigned char g) {
+    color->rgba.g = g;
+}
+
+PNTR_API void pntr_color_set_b(pntr_color* color, unsigned char b) {
+    color->rgba.b = b;
+}
+
+PNTR_API void pntr_color_set_a(pntr_color* color, unsigned char a) {
+    color->rgba.a = a;
+}
+
+/**
+ * Draws a point on the given image, without safety checks.
+ */
+PNTR_API void pntr_draw_point_unsafe(pntr_image* dst, int x, int y, pntr_color color) {
+    _pntr_image_modified(dst);
+    _pntr_blend_color_run(dst, &PNTR_PIXEL(dst, x, y), 1, 1, color);
+}
+
+/**
+ * Draws a pixel on the given image.
+ */
+PNTR_API void pntr_draw_point(pntr_image* dst, int x, int y, pntr_color color) {
+   if ((color.rgba.a == 0) || (dst == NULL) || (x < dst->clip.x) || (x >= dst->clip.x + dst->clip.width) || (y < dst->clip.y) || (y >= dst->clip.y + dst->clip.height)) {
         return;
     }
-    if (thickness == 1) {
-        pntr_draw_circle(dst, centerX, centerY, radius, color);
-        return;
+
+    pntr_draw_point_unsafe(dst, x, y, color);
+}
+
+/**
+ * Draws a pixel sampled from the source image, converting between straight and premultiplied alpha as needed.
+ *
+ * @param dst The destination image.
+ * @param x The x coordinate on the destination image.
+ * @param y The y coordinate on the destination image.
+ * @param src The image that the color was sampled from.
+ * @param color The sampled color, in the same alpha representation as the source image.
+ *
+ * The caller marks the image as modified, once per draw.
+ *
+ * @see _pntr_image_modified()
+ * @internal
+ */
+static void _pntr_draw_sample_unsafe(pntr_image* dst, int x, int y, pntr_image* src, pntr_color color) {
+    if (dst->premultiplied) {
+        pntr_blend_color_premultiplied(&PNTR_PIXEL(dst, x, y), src->premultiplied ? color : pntr_color_alpha_premultiply(color));
     }
-    if (dst == NULL || color.rgba.a == 0) {
-        return;
+    else {
+        pntr_blend_color(&PNTR_PIXEL(dst, x, y), src->premultiplied ? pntr_color_alpha_unpremultiply(color) : color);
     }
+}
 
-    if (radius < 0) {
-        radius = -radius;
+/**
+ * Draws a pixel sampled from the source image, within the destination's clip.
+ *
+ * @see _pntr_draw_sample_unsafe()
+ * @internal
+ */
+static void _pntr_draw_sample(pntr_image* dst, int x, int y, pntr_image* src, pntr_color color) {
+    if (x >= dst->clip.x && x < dst->clip.x + dst->clip.width && y >= dst->clip.y && y < dst->clip.y + dst->clip.height) {
+        _pntr_draw_sample_unsafe(dst, x, y, src, color);
     }
+}
 
-    // Check that the circle is in the bounds.
-    if (centerX + radius < dst->clip.x || centerY + radius < dst->clip.y || centerX - radius > dst->clip.x + dst->clip.width || centerY - radius > dst->clip.y + dst->clip.height) {
+PNTR_API void pntr_draw_point_vec(pntr_image* dst, pntr_vector* point, pntr_color color) {
+    if (point != NULL) {
+        pntr_draw_point(dst, point->x, point->y, color);
+    }
+}
+
+PNTR_API void pntr_draw_points(pntr_image* dst, pntr_vector* points, int pointsCount, pntr_color color) {
+    if (dst == NULL || color.rgba.a == 0 || points == NULL || pointsCount <= 0) {
         return;
     }
 
-    int largestX = radius;
-    int r2 = radius * radius;
-    for (int y = 0; y <= radius; ++y) {
-        int y2 = y * y;
-        for (int x = largestX; x >= 0; --x) {
-            if (x * x + y2 <= r2) {
-                pntr_draw_circle_fill(dst, centerX + x, centerY + y, thickness/2, color);
-                pntr_draw_circle_fill(dst, centerX - x, centerY + y, thickness/2, color);
-                pntr_draw_circle_fill(dst, centerX + x, centerY - y, thickness/2, color);
-                pntr_draw_circle_fill(dst, centerX - x, centerY - y, thickness/2, color);
-                pntr_draw_circle_fill(dst, centerX + y, centerY + x, thickness/2, color);
-                pntr_draw_circle_fill(dst, centerX - y, centerY + x, thickness/2, color);
-                pntr_draw_circle_fill(dst, centerX + y, centerY - x, thickness/2, color);
-                pntr_draw_circle_fill(dst, centerX - y, centerY - x, thickness/2, color);
-                largestX = x;
-                break;
-            }
+    for (int i = 0; i < pointsCount; i++) {
+        if (points[i].x >= dst->clip.x && points[i].x < dst->clip.x + dst->clip.width && points[i].y >= dst->clip.y && points[i].y < dst->clip.y + dst->clip.height) {
+            pntr_draw_point_unsafe(dst, points[i].x, points[i].y, color);
         }
     }
 }
 
 /**
- * Draws an ellipse on the given image.
+ * Adds a color, scaled by its alpha, to a pixel. The alpha of the pixel grows as it would with pntr_blend_color().
  *
- * @param dst The image to draw the ellipse onto.
- * @param centerX The center of the ellipse at the X coordinate.
- * @param centerY The center of the ellipse at the Y coordinate.
- * @param radiusX The  horizontal radius of the ellipse.
- * @param radiusY The vertical radius of the ellipse.
- * @param color The desired color of the ellipse.
+ * The addition is done on premultiplied colors, so that straight and premultiplied images end up the same.
  *
- * @see pntr_draw_ellipse_fill()
+ * @param dst The pixel to add to.
+ * @param src The color to add, with straight alpha.
+ * @param premultiplied Whether or not the pixel is premultiplied.
+ *
+ * @internal
  */
-PNTR_API void pntr_draw_ellipse(pntr_image* dst, int centerX, int centerY, int radiusX, int radiusY, pntr_color color) {
-    if (dst == NULL || radiusX == 0 || radiusY == 0 || color.rgba.a == 0) {
-        return;
+static void _pntr_blend_color_add(pntr_color* dst, pntr_color src, bool premultiplied) {
+    // Opaque straight pixels are the same as premultiplied ones.
+    pntr_color color = *dst;
+    bool convert = !premultiplied && color.rgba.a != 255;
+    if (convert) {
+        color = pntr_color_alpha_premultiply(color);
     }
 
-    int x = 0;
-    if (radiusX < 0) {
-        radiusX = -radiusX;
-    }
-    if (radiusY < 0) {
-        radiusY = -radiusY;
-    }
+    unsigned int alpha = src.rgba.a;
+    color.rgba.r = (unsigned char)PNTR_MIN(255, color.rgba.r + _pntr_multiply_255(src.rgba.r, alpha));
+    color.rgba.g = (unsigned char)PNTR_MIN(255, color.rgba.g + _pntr_multiply_255(src.rgba.g, alpha));
+    color.rgba.b = (unsigned char)PNTR_MIN(255, color.rgba.b + _pntr_multiply_255(src.rgba.b, alpha));
+    color.rgba.a = (unsigned char)PNTR_MIN(255, alpha + _pntr_multiply_255(color.rgba.a, 255 - alpha));
 
-    int radiusXSquared = radiusX * radiusX;
-    int radiusXSquared2 = radiusXSquared * 2;
-    int radiusYSquared = radiusY * radiusY;
-    int radiusYSquared2 = radiusYSquared * 2;
-    int error = radiusYSquared - radiusXSquared * radiusY;
+    *dst = convert ? pntr_color_alpha_unpremultiply(color) : color;
+}
 
-    while (radiusY >= 0) {
-        pntr_draw_point(dst, centerX + x, centerY + radiusY, color);
-        pntr_draw_point(dst, centerX - x, centerY + radiusY, color);
-        pntr_draw_point(dst, centerX - x, centerY - radiusY, color);
-        pntr_draw_point(dst, centerX + x, centerY - radiusY, color);
+/**
+ * Draws a single particle pixel, which must be within the clip.
+ *
+ * @internal
+ */
+static void _pntr_draw_particle(pntr_image* dst, pntr_color* pixel, pntr_color color, pntr_blend_mode mode) {
+    if (color.rgba.a == 0) {
+        return;
+    }
 
-        if (error <= 0) {
-            x++;
-            error += radiusYSquared2 * x + radiusYSquared;
-        }
-        if (error > 0) {
-            radiusY--;
-            error -= radiusXSquared2 * radiusY - radiusXSquared;
-        }
+    if (mode == PNTR_BLEND_ADD) {
+        _pntr_blend_color_add(pixel, color, dst->premultiplied);
+    }
+    else if (color.rgba.a == 255) {
+        *pixel = color;
+    }
+    else if (dst->premultiplied) {
+        pntr_blend_color_premultiplied(pixel, pntr_color_alpha_premultiply(color));
+    }
+    else {
+        pntr_blend_color(pixel, color);
     }
 }
 
 /**
- * Draws a filled ellipse on the given image.
+ * Draws many particles at once, such as for a particle system or a scatter plot.
  *
- * TODO: pntr_draw_ellipse_fill: Add anti-aliased
+ * The coordinates are given as separate arrays. Without sizes, each particle is a single pixel, and the particles are
+ * tested against the clip several at a time with SIMD.
  *
- * @param dst The image to draw the filled ellipse onto.
- * @param centerX The center of the ellipse at the X coordinate.
- * @param centerY The center of the ellipse at the Y coordinate.
- * @param radiusX The  horizontal radius of the ellipse.
- * @param radiusY The vertical radius of the ellipse.
- * @param color The desired fill color of the ellipse.
+ * @param dst The image to draw the particles on.
+ * @param x The x coordinate of each particle.
+ * @param y The y coordinate of each particle.
+ * @param colors The color of each particle.
+ * @param sizes The width and height of each particle's square, centered on its coordinates. NULL to draw each particle as a single pixel.
+ * @param count How many particles there are.
+ * @param mode How the particles are combined with the image.
  *
- * @see pntr_draw_ellipse()
+ * @see pntr_draw_points()
+ * @see PNTR_NO_SIMD
  */
-PNTR_API void pntr_draw_ellipse_fill(pntr_image* dst, int centerX, int centerY, int radiusX, int radiusY, pntr_color color) {
-    if (radiusX < 0) {
-        radiusX = -radiusX;
-    }
-    if (radiusY < 0) {
-        radiusY = -radiusY;
+PNTR_API void pntr_draw_particles(pntr_image* dst, int* x, int* y, pntr_color* colors, int* sizes, int count, pntr_blend_mode mode) {
+    if (dst == NULL || x == NULL || y == NULL || colors == NULL || count <= 0 || dst->clip.width <= 0 || dst->clip.height <= 0) {
+        return;
     }
 
-    if (dst == NULL || radiusX == 0 || radiusY == 0 || color.rgba.a == 0 || centerX + radiusX < dst->clip.x || centerX - radiusX > dst->clip.x + dst->clip.width || centerY + radiusY < dst->clip.y || centerY - radiusY > dst->clip.y + dst->clip.height) {
+    _pntr_image_modified(dst);
+
+    if (sizes != NULL) {
+        for (int i = 0; i < count; i++) {
+            pntr_rectangle rect;
+            if (sizes[i] <= 0 || colors[i].rgba.a == 0 || !_pntr_rectangle_intersect(x[i] - sizes[i] / 2, y[i] - sizes[i] / 2, sizes[i], sizes[i], dst->clip.x, dst->clip.y, dst->clip.width, dst->clip.height, &rect)) {
+                continue;
+            }
+            for (int row = rect.y; row < rect.y + rect.height; row++) {
+                pntr_color* pixel = &PNTR_PIXEL(dst, rect.x, row);
+                for (int column = 0; column < rect.width; column++) {
+                    _pntr_draw_particle(dst, pixel + column, colors[i], mode);
+                }
+            }
+        }
         return;
     }
 
-    int x = 0;
-    int radiusXSquared = radiusX * radiusX;
-    int radiusXSquared2 = radiusXSquared * 2;
-    int radiusYSquared = radiusY * radiusY;
-    int radiusYSquared2 = radiusYSquared * 2;
-    int error = radiusYSquared - radiusXSquared * radiusY;
+    int left = dst->clip.x;
+    int top = dst->clip.y;
+    int i = 0;
 
-    while (radiusY >= 0) {
-        pntr_draw_line_horizontal(dst, centerX - x, centerY + radiusY, x, color);
-        pntr_draw_line_horizontal(dst, centerX - x, centerY - radiusY, x, color);
-        pntr_draw_line_horizontal(dst, centerX, centerY + radiusY, x, color);
-        pntr_draw_line_horizontal(dst, centerX, centerY - radiusY, x, color);
+    #ifdef PNTR_SIMD_AVX2
+    {
+        const __m256i leftEdge = _mm256_set1_epi32(left - 1);
+        const __m256i topEdge = _mm256_set1_epi32(top - 1);
+        const __m256i rightEdge = _mm256_set1_epi32(left + dst->clip.width);
+        const __m256i bottomEdge = _mm256_set1_epi32(top + dst->clip.height);
+        for (; i + 8 <= count; i += 8) {
+            __m256i px = _mm256_loadu_si256((const __m256i*)(x + i));
+            __m256i py = _mm256_loadu_si256((const __m256i*)(y + i));
+            __m256i inside = _mm256_and_si256(
+                _mm256_and_si256(_mm256_cmpgt_epi32(px, leftEdge), _mm256_cmpgt_epi32(rightEdge, px)),
+                _mm256_and_si256(_mm256_cmpgt_epi32(py, topEdge), _mm256_cmpgt_epi32(bottomEdge, py)));
+            int mask = _mm256_movemask_ps(_mm256_castsi256_ps(inside));
+            for (int j = 0; mask != 0; j++, mask >>= 1) {
+                if (mask & 1) {
+                    _pntr_draw_particle(dst, &PNTR_PIXEL(dst, x[i + j], y[i + j]), colors[i + j], mode);
+                }
+            }
+        }
+    }
+    #endif
 
-        if (error <= 0) {
-            x++;
-            error += radiusYSquared2 * x + radiusYSquared;
+    #ifdef PNTR_SIMD_SSE2
+    {
+        const __m128i leftEdge = _mm_set1_epi32(left - 1);
+        const __m128i topEdge = _mm_set1_epi32(top - 1);
+        const __m128i rightEdge = _mm_set1_epi32(left + dst->clip.width);
+        const __m128i bottomEdge = _mm_set1_epi32(top + dst->clip.height);
+        for (; i + 4 <= count; i += 4) {
+            __m128i px = _mm_loadu_si128((const __m128i*)(x + i));
+            __m128i py = _mm_loadu_si128((const __m128i*)(y + i));
+            __m128i inside = _mm_and_si128(
+                _mm_and_si128(_mm_cmpgt_epi32(px, leftEdge), _mm_cmplt_epi32(px, rightEdge)),
+                _mm_and_si128(_mm_cmpgt_epi32(py, topEdge), _mm_cmplt_epi32(py, bottomEdge)));
+            int mask = _mm_movemask_ps(_mm_castsi128_ps(inside));
+            for (int j = 0; mask != 0; j++, mask >>= 1) {
+                if (mask & 1) {
+                    _pntr_draw_particle(dst, &PNTR_PIXEL(dst, x[i + j], y[i + j]), colors[i + j], mode);
+                }
+            }
         }
-        if (error > 0) {
-            radiusY--;
-            error -= radiusXSquared2 * radiusY - radiusXSquared;
+    }
+    #endif
+
+    #ifdef PNTR_SIMD_NEON
+    {
+        const int32x4_t leftEdge = vdupq_n_s32(left);
+        const int32x4_t topEdge = vdupq_n_s32(top);
+        const int32x4_t rightEdge = vdupq_n_s32(left + dst->clip.width);
+        const int32x4_t bottomEdge = vdupq_n_s32(top + dst->clip.height);
+        for (; i + 4 <= count; i += 4) {
+            int32x4_t px = vld1q_s32(x + i);
+            int32x4_t py = vld1q_s32(y + i);
+            uint32x4_t inside = vandq_u32(
+                vandq_u32(vcgeq_s32(px, leftEdge), vcltq_s32(px, rightEdge)),
+                vandq_u32(vcgeq_s32(py, topEdge), vcltq_s32(py, bottomEdge)));
+            uint64x2_t any = vreinterpretq_u64_u32(inside);
+            if ((vgetq_lane_u64(any, 0) | vgetq_lane_u64(any, 1)) == 0) {
+                continue;
+            }
+            uint32_t lanes[4];
+            vst1q_u32(lanes, inside);
+            for (int j = 0; j < 4; j++) {
+                if (lanes[j] != 0) {
+                    _pntr_draw_particle(dst, &PNTR_PIXEL(dst, x[i + j], y[i + j]), colors[i + j], mode);
+                }
+            }
+        }
+    }
+    #endif
+
+    // The subtractions wrap around for coordinates before the clip, so one comparison checks both sides.
+    for (; i < count; i++) {
+        if ((unsigned int)x[i] - (unsigned int)left < (unsigned int)dst->clip.width && (unsigned int)y[i] - (unsigned int)top < (unsigned int)dst->clip.height) {
+            _pntr_draw_particle(dst, &PNTR_PIXEL(dst, x[i], y[i]), colors[i], mode);
         }
     }
 }
 
 /**
- * Draws an ellipse on the given image, with line-thickness.
+ * Divides two positive integers, rounding up.
  *
- * @param dst The image to draw the ellipse onto.
- * @param centerX The center of the ellipse at the X coordinate.
- * @param centerY The center of the ellipse at the Y coordinate.
- * @param radiusX The  horizontal radius of the ellipse.
- * @param radiusY The vertical radius of the ellipse.
- * @param thickness The thickness of the line
- * @param color The desired color of the ellipse.
+ * @internal
+ */
+static int64_t _pntr_ceil_div(int64_t numerator, int64_t denominator) {
+    return (numerator + denominator - 1) / denominator;
+}
+
+/**
+ * Draws a line that is neither horizontal nor vertical, including both of its end points.
  *
+ * The line is stepped along its longer axis with Bresenham's algorithm. After k steps, it has stepped along its shorter
+ * axis floor((2 * minor * k + major) / (2 * major)) times, so the steps that stay inside of the clip are found once,
+ * and the pixels between them are drawn without checking each of them.
+ *
+ * @internal
  */
-PNTR_API void pntr_draw_ellipse_thick(pntr_image* dst, int centerX, int centerY, int radiusX, int radiusY, int thickness, pntr_color color) {
-    if (thickness < 1) {
+static void _pntr_draw_line_clipped(pntr_image* dst, int startPosX, int startPosY, int endPosX, int endPosY, pntr_color color) {
+    int changeInX = endPosX - startPosX;
+    int changeInY = endPosY - startPosY;
+    bool alongX = PNTR_MAX(changeInY, -changeInY) < PNTR_MAX(changeInX, -changeInX);
+
+    // Always step forwards along the longer axis.
+    bool reversed = alongX ? (changeInX < 0) : (changeInY < 0);
+    int startU = alongX ? startPosX : startPosY;
+    int startV = alongX ? startPosY : startPosX;
+    int endU = alongX ? endPosX : endPosY;
+    int endV = alongX ? endPosY : endPosX;
+    if (reversed) {
+        int swap = startU;
+        startU = endU;
+        endU = swap;
+        swap = startV;
+        startV = endV;
+        endV = swap;
+    }
+
+    int64_t major = (int64_t)endU - startU;
+    int64_t minor = (endV > startV) ? (int64_t)endV - startV : (int64_t)startV - endV;
+    int stepV = (endV > startV) ? 1 : -1;
+    int64_t lowU = alongX ? dst->clip.x : dst->clip.y;
+    int64_t highU = lowU + (alongX ? dst->clip.width : dst->clip.height) - 1;
+    int64_t lowV = alongX ? dst->clip.y : dst->clip.x;
+    int64_t highV = lowV + (alongX ? dst->clip.height : dst->clip.width) - 1;
+
+    // Find the range of steps where both axes are inside of the clip.
+    int64_t first = PNTR_MAX(0, lowU - startU);
+    int64_t last = PNTR_MIN(major, highU - startU);
+    int64_t fewest = (stepV > 0) ? lowV - startV : startV - highV;
+    int64_t most = (stepV > 0) ? highV - startV : startV - lowV;
+    if (most < 0) {
         return;
     }
-    if (thickness == 1) {
-        pntr_draw_ellipse(dst, centerX, centerY, radiusX, radiusY, color);
-        return;
+    if (fewest > 0) {
+        first = PNTR_MAX(first, _pntr_ceil_div(2 * major * fewest - major, 2 * minor));
     }
-    if (dst == NULL || radiusX == 0 || radiusY == 0 || color.rgba.a == 0) {
+    last = PNTR_MIN(last, _pntr_ceil_div(2 * major * (most + 1) - major, 2 * minor) - 1);
+    if (first > last) {
         return;
     }
 
-    int x = 0;
-    if (radiusX < 0) {
-        radiusX = -radiusX;
-    }
-    if (radiusY < 0) {
-        radiusY = -radiusY;
+    // Start the error term where it would be after the skipped steps.
+    int64_t stepsV = (2 * minor * first + major) / (2 * major);
+    int64_t error = 2 * minor * (first + 1) - major - 2 * major * stepsV;
+    int u = startU + (int)first;
+    int v = startV + stepV * (int)stepsV;
+    int pitch = dst->pitch >> 2;
+    pntr_color* pixel = alongX ? &PNTR_PIXEL(dst, u, v) : &PNTR_PIXEL(dst, v, u);
+    int strideU = alongX ? 1 : pitch;
+    int strideV = alongX ? stepV * pitch : stepV;
+
+    _pntr_image_modified(dst);
+    bool opaque = color.rgba.a == 255;
+    if (dst->premultiplied) {
+        color = pntr_color_alpha_premultiply(color);
     }
 
-    int radiusXSquared = radiusX * radiusX;
-    int radiusXSquared2 = radiusXSquared * 2;
-    int radiusYSquared = radiusY * radiusY;
-    int radiusYSquared2 = radiusYSquared * 2;
-    int error = radiusYSquared - radiusXSquared * radiusY;
-
-    while (radiusY >= 0) {
-        pntr_draw_circle_fill(dst, centerX + x, centerY + radiusY, thickness/2, color);
-        pntr_draw_circle_fill(dst, centerX - x, centerY + radiusY, thickness/2, color);
-        pntr_draw_circle_fill(dst, centerX - x, centerY - radiusY, thickness/2, color);
-        pntr_draw_circle_fill(dst, centerX + x, centerY - radiusY, thickness/2, color);
+    for (int64_t count = last - first; ; count--) {
+        if (opaque) {
+            *pixel = color;
+        }
+        else if (dst->premultiplied) {
+            pntr_blend_color_premultiplied(pixel, color);
+        }
+        else {
+            pntr_blend_color(pixel, color);
+        }
 
-        if (error <= 0) {
-            x++;
-            error += radiusYSquared2 * x + radiusYSquared;
+        if (count == 0) {
+            break;
         }
-        if (error > 0) {
-            radiusY--;
-            error -= radiusXSquared2 * radiusY - radiusXSquared;
+        if (error >= 0) {
+            pixel += strideV;
+            error += 2 * minor - 2 * major;
+        }
+        else {
+            error += 2 * minor;
         }
+        pixel += strideU;
     }
 }
 
 /**
- * Draw a triangle using vectors.
+ * Draws a line, once the image and the color have been checked.
  *
- * @param dst Where to draw the triangle.
- * @param point1 The first point in the triangle.
- * @param point2 The second point in the triangle.
- * @param point3 The third point in the triangle.
- * @param color What color to draw the triangle.
+ * @internal
  */
-PNTR_API void pntr_draw_triangle_vec(pntr_image* dst, pntr_vector point1, pntr_vector point2, pntr_vector point3, pntr_color color) {
-    pntr_draw_triangle(dst, point1.x, point1.y, point2.x, point2.y, point3.x, point3.y, color);
+static void _pntr_draw_line(pntr_image* dst, int startPosX, int startPosY, int endPosX, int endPosY, pntr_color color) {
+    // Drawing a straight line is fast.
+    if (startPosX == endPosX) {
+        pntr_draw_line_vertical(dst, startPosX, PNTR_MIN(startPosY, endPosY), PNTR_MAX(endPosY - startPosY, startPosY - endPosY), color);
+    }
+    else if (startPosY == endPosY) {
+        pntr_draw_line_horizontal(dst, PNTR_MIN(startPosX, endPosX), startPosY, PNTR_MAX(endPosX - startPosX, startPosX - endPosX), color);
+    }
+    else {
+        _pntr_draw_line_clipped(dst, startPosX, startPosY, endPosX, endPosY, color);
+    }
 }
 
 /**
- * Draw a triangle using vectors, with line-thickness.
+ * Draws a line on the given image.
  *
- * @param dst Where to draw the triangle.
- * @param point1 The first point in the triangle.
- * @param point2 The second point in the triangle.
- * @param point3 The third point in the triangle.
- * @param thickness The thickness of the line
- * @param color What color to draw the triangle.
+ * @see pntr_draw_line_horizontal()
+ * @see pntr_draw_line_vertical()
+ * @see pntr_draw_line_aa()
+ * @see pntr_draw_line_thick()
+ * @see pntr_draw_lines()
  */
-PNTR_API void pntr_draw_triangle_thick_vec(pntr_image *dst, pntr_vector point1, pntr_vector point2, pntr_vector point3, int thickness, pntr_color color) {
-    pntr_draw_line_thick(dst, point1.x, point1.y, point2.x, point2.y, thickness, color);
-    pntr_draw_line_thick(dst, point2.x, point2.y, point3.x, point3.y, thickness, color);
-    pntr_draw_line_thick(dst, point3.x, point3.y, point1.x, point1.y, thickness, color);
+PNTR_API void pntr_draw_line(pntr_image *dst, int startPosX, int startPosY, int endPosX, int endPosY, pntr_color color) {
+    if (dst == NULL || color.rgba.a == 0) {
+        return;
+    }
+
+    _pntr_draw_line(dst, startPosX, startPosY, endPosX, endPosY, color);
 }
 
 /**
- * Draw a triangle on an image.
+ * Draws many separate lines on the given image, like the edges of a wireframe.
  *
- * @param dst The image of which to draw the triangle.
- * @param x1 The x coordinate of the first point.
- * @param y1 The y coordinate of the first point.
- * @param x2 The x coordinate of the second point.
- * @param y2 The y coordinate of the second point.
- * @param x3 The x coordinate of the third point.
- * @param y3 The y coordinate of the third point.
- * @param color The line color for the triangle.
+ * @param dst The image to draw the lines on.
+ * @param segments The start and end points of each line, one after the other. There are twice as many as there are lines.
+ * @param count How many lines there are.
+ * @param color The color of the lines.
+ *
+ * @see pntr_draw_line()
  */
-PNTR_API void pntr_draw_triangle(pntr_image* dst, int x1, int y1, int x2, int y2, int x3, int y3, pntr_color color) {
-    pntr_draw_line(dst, x1, y1, x2, y2, color);
-    pntr_draw_line(dst, x2, y2, x3, y3, color);
-    pntr_draw_line(dst, x3, y3, x1, y1, color);
+PNTR_API void pntr_draw_lines(pntr_image* dst, pntr_vector* segments, int count, pntr_color color) {
+    if (dst == NULL || segments == NULL || count <= 0 || color.rgba.a == 0) {
+        return;
+    }
+
+    for (int i = 0; i < count; i++) {
+        _pntr_draw_line(dst, segments[i * 2].x, segments[i * 2].y, segments[i * 2 + 1].x, segments[i * 2 + 1].y, color);
+    }
 }
 
 /**
- * Draw a triangle on an image, with line-thickness.
+ * Draws a line on the given image, with thickness and rounded ends.
  *
- * @param dst The image of which to draw the triangle.
- * @param x1 The x coordinate of the first point.
- * @param y1 The y coordinate of the first point.
- * @param x2 The x coordinate of the second point.
- * @param y2 The y coordinate of the second point.
- * @param x3 The x coordinate of the third point.
- * @param y3 The y coordinate of the third point.
- * @param thickness The thickness of the line
- * @param color The line color for the triangle.
+ * @param dst The image to draw the line on.
+ * @param startPosX The x coordinate of where the line starts.
+ * @param startPosY The y coordinate of where the line starts.
+ * @param endPosX The x coordinate of where the line ends.
+ * @param endPosY The y coordinate of where the line ends.
+ * @param thickness How thick the line is, in pixels.
+ * @param color The color of the line.
+ *
+ * @see pntr_draw_line_thick_cap()
  */
-PNTR_API void pntr_draw_triangle_thick(pntr_image* dst, int x1, int y1, int x2, int y2, int x3, int y3, int thickness, pntr_color color) {
-    pntr_draw_line_thick(dst, x1, y1, x2, y2, thickness, color);
-    pntr_draw_line_thick(dst, x2, y2, x3, y3, thickness, color);
-    pntr_draw_line_thick(dst, x3, y3, x1, y1, thickness, color);
+PNTR_API void pntr_draw_line_thick(pntr_image *dst, int startPosX, int startPosY, int endPosX, int endPosY, int thickness, pntr_color color) {
+    pntr_draw_line_thick_cap(dst, startPosX, startPosY, endPosX, endPosY, thickness, PNTR_LINE_CAP_ROUND, color);
 }
 
+/**
+ * Draws a line on the given image, with thickness and the given ends.
+ *
+ * The line is filled as one convex shape, one span per scanline, so every pixel is drawn exactly once. This keeps
+ * translucent lines evenly blended, including their ends. A pixel is drawn when its top left corner is inside of the
+ * shape, or on its top or left boundary.
+ *
+ * @param dst The image to draw the line on.
+ * @param startPosX The x coordinate of where the line starts.
+ * @param startPosY The y coordinate of where the line starts.
+ * @param endPosX The x coordinate of where the line ends.
+ * @param endPosY The y coordinate of where the line ends.
+ * @param thickness How thick the line is, in pixels.
+ * @param cap How the ends of the line are drawn.
+ * @param color The color of the line.
+ *
+ * @see pntr_line_cap
+ */
+PNTR_API void pntr_draw_line_thick_cap(pntr_image* dst, int startPosX, int startPosY, int endPosX, int endPosY, int thickness, pntr_line_cap cap, pntr_color color) {
+    if (thickness < 1) {
+        return;
+    }
+    if (thickness == 1) {
+        pntr_draw_line(dst, startPosX, startPosY, endPosX, endPosY, color);
+        return;
+    }
+
+    if (dst == NULL || color.rgba.a == 0) {
+        return;
+    }
+
+    float halfThickness = (float)thickness * 0.5f;
+    float directionX = (float)(endPosX - startPosX);
+    float directionY = (float)(endPosY - startPosY);
+    float length = PNTR_SQRTF(directionX * directionX + directionY * directionY);
+
+    // The corners of the body of the line, with square ends pushed out by half of the thickness.
+    float corners[4][2];
+    int cornerCount = 0;
+    if (length > 0.0f) {
+        directionX /= length;
+        directionY /= length;
+        float extend = (cap == PNTR_LINE_CAP_SQUARE) ? halfThickness : 0.0f;
+        float normalX = -directionY * halfThickness;
+        float normalY = directionX * halfThickness;
+        float startX = (float)startPosX - directionX * extend;
+        float startY = (float)startPosY - directionY * extend;
+        float endX = (float)endPosX + directionX * extend;
+        float endY = (float)endPosY + directionY * extend;
+        corners[0][0] = startX + normalX;
+        corners[0][1] = startY + normalY;
+        corners[1][0] = endX + normalX;
+        corners[1][1] = endY + normalY;
+        corners[2][0] = endX - normalX;
+        corners[2][1] = endY - normalY;
+        corners[3][0] = startX - normalX;
+        corners[3][1] = startY - normalY;
+        cornerCount = 4;
+    }
+    else if (cap == PNTR_LINE_CAP_SQUARE) {
+        corners[0][0] = (float)startPosX - halfThickness;
+        corners[0][1] = (float)startPosY - halfThickness;
+        corners[1][0] = (float)startPosX + halfThickness;
+        corners[1][1] = corners[0][1];
+        corners[2][0] = corners[1][0];
+        corners[2][1] = (float)startPosY + halfThickness;
+        corners[3][0] = corners[0][0];
+        corners[3][1] = corners[2][1];
+        cornerCount = 4;
+    }
+    else if (cap != PNTR_LINE_CAP_ROUND) {
+        return;
+    }
+
+    // Find the rows the line covers.
+    float top = (float)PNTR_MIN(startPosY, endPosY) - ((cap == PNTR_LINE_CAP_ROUND) ? halfThickness : 0.0f);
+    float bottom = (float)PNTR_MAX(startPosY, endPosY) + ((cap == PNTR_LINE_CAP_ROUND) ? halfThickness : 0.0f);
+    for (int i = 0; i < cornerCount; i++) {
+        top = PNTR_MIN(top, corners[i][1]);
+        bottom = PNTR_MAX(bottom, corners[i][1]);
+    }
+    int startRow = PNTR_MAX((int)PNTR_CEILF(top), dst->clip.y);
+    int endRow = PNTR_MIN((int)PNTR_CEILF(bottom) - 1, dst->clip.y + dst->clip.height - 1);
+    float radiusSquared = halfThickness * halfThickness;
+
+    for (int y = startRow; y <= endRow; y++) {
+        float row = (float)y;
+        float left = (float)(dst->clip.x + dst->clip.width);
+        float right = (float)dst->clip.x - 1.0f;
+
+        // The body, which is convex, so each edge that crosses the row bounds its span.
+        for (int i = 0; i < cornerCount; i++) {
+            const float* a = corners[i];
+            const float* b = corners[(i + 1) % 4];
+            if ((row < a[1] && row < b[1]) || (row > a[1] && row > b[1]) || a[1] == b[1]) {
+                continue;
+            }
+            float x = a[0] + (b[0] - a[0]) * (row - a[1]) / (b[1] - a[1]);
+            left = PNTR_MIN(left, x);
+            right = PNTR_MAX(right, x);
+        }
+
+        // Round ends widen the span by the circle around each end point.
+        if (cap == PNTR_LINE_CAP_ROUND) {
+            for (int i = 0; i < 2; i++) {
+                float centerX = (float)(i == 0 ? startPosX : endPosX);
+                float distanceY = row - (float)(i == 0 ? startPosY : endPosY);
+                if (distanceY * distanceY < radiusSquared) {
+                    float halfWidth = PNTR_SQRTF(radiusSquared - distanceY * distanceY);
+                    left = PNTR_MIN(left, centerX - halfWidth);
+                    right = PNTR_MAX(right, centerX + halfWidth);
+                }
+            }
+        }
+
+        int x = PNTR_MAX((int)PNTR_CEILF(left), dst->clip.x);
+        int width = PNTR_MIN((int)PNTR_CEILF(right), dst->clip.x + dst->clip.width) - x;
+        if (width > 0) {
+            _pntr_fill_span(dst, x, y, width, color);
+        }
+    }
+}
 
 /**
- * Draw a filled triangle on an image.
+ * Draws a line on the given image, with thickness and the given ends, using vectors.
  *
- * @param dst The image of which to draw the triangle.
- * @param x1 The x coordinate of the first point.
- * @param y1 The y coordinate of the first point.
- * @param x2 The x coordinate of the second point.
- * @param y2 The y coordinate of the second point.
- * @param x3 The x coordinate of the third point.
- * @param y3 The y coordinate of the third point.
- * @param color The fill color of the triangle.
+ * @see pntr_draw_line_thick_cap()
  */
-PNTR_API void pntr_draw_triangle_fill(pntr_image* dst, int x1, int y1, int x2, int y2, int x3, int y3, pntr_color color) {
-    pntr_draw_triangle_fill_vec(dst,
-        PNTR_CLITERAL(pntr_vector) { .x = x1, .y = y1 },
-        PNTR_CLITERAL(pntr_vector) { .x = x2, .y = y2 },
-        PNTR_CLITERAL(pntr_vector) { .x = x3, .y = y3 },
-        color
-    );
+PNTR_API void pntr_draw_line_thick_cap_vec(pntr_image* dst, pntr_vector start, pntr_vector end, int thickness, pntr_line_cap cap, pntr_color color) {
+    pntr_draw_line_thick_cap(dst, start.x, start.y, end.x, end.y, thickness, cap, color);
 }
 
-PNTR_API void pntr_draw_line_vec(pntr_image* dst, pntr_vector start, pntr_vector end, pntr_color color) {
-    pntr_draw_line(dst, start.x, start.y, end.x, end.y, color);
+/**
+ * An edge of a shape with fractional coordinates, sampled where it crosses each scanline.
+ *
+ * @see _pntr_scan_edges
+ * @internal
+ */
+typedef struct _pntr_scan_edge {
+    float x; /** The x coordinate where the edge crosses its first scanline. */
+    float slope; /** How much the x coordinate changes from one scanline to the next. */
+    float current; /** The x coordinate on the scanline being filled. */
+    int yStart; /** The first scanline the edge crosses. */
+    int yEnd; /** The last scanline the edge crosses. */
+    int winding; /** How much crossing the edge from left to right changes the winding, either 1 or -1. */
+    int next; /** The next edge that starts on the same scanline, or -1. */
+} _pntr_scan_edge;
+
+/**
+ * A list of edges that are filled together in one pass, clipped to the scanlines of an image.
+ *
+ * A pixel is inside of an edge when its top left corner is on or after it, so that shapes sharing an edge neither
+ * overlap nor leave a gap.
+ *
+ * @see _pntr_scan_edges_fill()
+ * @internal
+ */
+typedef struct _pntr_scan_edges {
+    _pntr_scan_edge* edges; /** The edges. */
+    int count; /** How many edges there are. */
+    int capacity; /** How many edges fit before the list needs to grow. */
+    int top; /** The first scanline of the clip. */
+    int bottom; /** The last scanline of the clip. */
+    float right; /** The right of the clip. Edges past it are moved onto it, as they still close the spans before them. */
+    bool failed; /** Whether the list ran out of memory. */
+} _pntr_scan_edges;
+
+/**
+ * Starts an empty list of edges for filling on the given image.
+ *
+ * @internal
+ */
+static void _pntr_scan_edges_init(_pntr_scan_edges* list, pntr_image* dst) {
+    list->edges = NULL;
+    list->count = 0;
+    list->capacity = 0;
+    list->top = dst->clip.y;
+    list->bottom = dst->clip.y + dst->clip.height - 1;
+    list->right = (float)(dst->clip.x + dst->clip.width);
+    list->failed = false;
 }
 
-PNTR_API void pntr_draw_line_thick_vec(pntr_image* dst, pntr_vector start, pntr_vector end, int thickness, pntr_color color) {
-    pntr_draw_line_thick(dst, start.x, start.y, end.x, end.y, thickness, color);
+/**
+ * Adds an edge from one point to another, skipping it when it crosses no scanlines of the clip.
+ *
+ * Edges past the right of the clip are moved onto it, so that they still close the spans before them.
+ *
+ * @param winding 1 when the edge is part of a clockwise shape, or -1 when it is part of a counter-clockwise one.
+ *
+ * @internal
+ */
+static void _pntr_scan_edges_add(_pntr_scan_edges* list, float x1, float y1, float x2, float y2, int winding) {
+    if (y1 == y2 || list->failed) {
+        return;
+    }
+    if (x1 >= list->right && x2 >= list->right) {
+        x1 = list->right;
+        x2 = list->right;
+    }
+
+    if (y1 > y2) {
+        float swap = x1;
+        x1 = x2;
+        x2 = swap;
+        swap = y1;
+        y1 = y2;
+        y2 = swap;
+        winding = -winding;
+    }
+
+    int yStart = PNTR_MAX((int)PNTR_CEILF(y1), list->top);
+    int yEnd = PNTR_MIN((int)PNTR_CEILF(y2) - 1, list->bottom);
+    if (yStart > yEnd) {
+        return;
+    }
+
+    if (list->count == list->capacity) {
+        int capacity = (list->capacity > 0) ? list->capacity * 2 : 64;
+        _pntr_scan_edge* edges = (_pntr_scan_edge*)PNTR_REALLOC(list->edges, sizeof(_pntr_scan_edge) * (size_t)capacity);
+        if (edges == NULL) {
+            list->failed = true;
+            pntr_set_error(PNTR_ERROR_NO_MEMORY);
+            return;
+        }
+        list->edges = edges;
+        list->capacity = capacity;
+    }
+
+    _pntr_scan_edge* edge = &list->edges[list->count++];
+    edge->slope = (x2 - x1) / (y2 - y1);
+    edge->x = x1 + edge->slope * ((float)yStart - y1);
+    edge->yStart = yStart;
+    edge->yEnd = yEnd;
+    edge->winding = winding;
 }
 
-PNTR_API void pntr_draw_polygon(pntr_image* dst, pntr_vector* points, int numPoints, pntr_color color) {
-    if (dst == NULL || color.rgba.a == 0 || numPoints <= 0 || points == NULL) {
+/**
+ * Adds the edges of a polygon, always wound the same way. Overlapping polygons are then filled as their union with
+ * the non-zero rule, and the edges they share cancel out exactly.
+ *
+ * @param points The x and y coordinates of each point.
+ * @param count How many points there are.
+ *
+ * @internal
+ */
+static void _pntr_scan_edges_add_polygon(_pntr_scan_edges* list, const float* points, int count) {
+    float area = 0.0f;
+    for (int i = 0, j = count - 1; i < count; j = i++) {
+        area += points[j * 2] * points[i * 2 + 1] - points[i * 2] * points[j * 2 + 1];
+    }
+    int winding = (area < 0.0f) ? -1 : 1;
+    for (int i = 0, j = count - 1; i < count; j = i++) {
+        _pntr_scan_edges_add(list, points[j * 2], points[j * 2 + 1], points[i * 2], points[i * 2 + 1], winding);
+    }
+}
+
+/**
+ * Fills the inside of the edges one scanline at a time, and then frees them.
+ *
+ * @param nonZero True to fill where the edges wind around a pixel any number of times, or false to only fill where
+ *                they wind around it an odd number of times.
+ *
+ * @internal
+ */
+static void _pntr_scan_edges_fill(pntr_image* dst, _pntr_scan_edges* list, bool nonZero, pntr_color color) {
+    if (list->count == 0 || list->failed) {
+        PNTR_FREE(list->edges);
         return;
     }
 
-    int nextPointIndex;
-    for (int i = 0; i < numPoints; i++) {
-        if (i < numPoints - 1) {
-            nextPointIndex = i + 1;
+    // Bucket the edges by the scanline they start on.
+    int rows = list->bottom - list->top + 1;
+    int* heads = (int*)PNTR_MALLOC(sizeof(int) * (size_t)(rows + list->count * 3));
+    if (heads == NULL) {
+        pntr_set_error(PNTR_ERROR_NO_MEMORY);
+        PNTR_FREE(list->edges);
+        return;
+    }
+    int* active = heads + rows;
+    int* added = active + list->count;
+    int* merged = added + list->count;
+    for (int row = 0; row < rows; row++) {
+        heads[row] = -1;
+    }
+    _pntr_scan_edge* edges = list->edges;
+    for (int i = list->count - 1; i >= 0; i--) {
+        edges[i].next = heads[edges[i].yStart - list->top];
+        heads[edges[i].yStart - list->top] = i;
+    }
+
+    int clipLeft = dst->clip.x;
+    int clipRight = dst->clip.x + dst->clip.width;
+    int activeCount = 0;
+    for (int y = list->top; y <= list->bottom; y++) {
+        // Drop the edges that ended, and find where the others cross this scanline.
+        int kept = 0;
+        for (int i = 0; i < activeCount; i++) {
+            _pntr_scan_edge* edge = &edges[active[i]];
+            if (edge->yEnd >= y) {
+                edge->current = edge->x + edge->slope * (float)(y - edge->yStart);
+                active[kept++] = active[i];
+            }
         }
-        else {
-            nextPointIndex = 0;
+        activeCount = kept;
+
+        // The active edges stay nearly sorted between scanlines, so an insertion sort is quick.
+        for (int i = 1; i < activeCount; i++) {
+            int index = active[i];
+            int k = i;
+            while (k > 0 && edges[active[k - 1]].current > edges[index].current) {
+                active[k] = active[k - 1];
+                k--;
+            }
+            active[k] = index;
         }
 
-        pntr_draw_line(dst, points[i].x, points[i].y, points[nextPointIndex].x, points[nextPointIndex].y, color);
-   }
+        // Sort the edges starting on this scanline on their own, and merge them in.
+        int addedCount = 0;
+        for (int i = heads[y - list->top]; i >= 0; i = edges[i].next) {
+            edges[i].current = edges[i].x;
+            int k = addedCount++;
+            while (k > 0 && edges[added[k - 1]].current > edges[i].current) {
+                added[k] = added[k - 1];
+                k--;
+            }
+            added[k] = i;
+        }
+        if (addedCount > 0) {
+            int a = 0;
+            int b = 0;
+            int count = 0;
+            while (a < activeCount || b < addedCount) {
+                if (b >= addedCount || (a < activeCount && edges[active[a]].current <= edges[added[b]].current)) {
+                    merged[count++] = active[a++];
+                }
+                else {
+                    merged[count++] = added[b++];
+                }
+            }
+            int* swap = active;
+            active = merged;
+            merged = swap;
+            activeCount = count;
+        }
+
+        // Count the winding from left to right, filling wherever it is inside.
+        int winding = 0;
+        float spanStart = 0.0f;
+        for (int i = 0; i < activeCount; i++) {
+            _pntr_scan_edge* edge = &edges[active[i]];
+            bool wasInside = nonZero ? (winding != 0) : (winding % 2 != 0);
+            winding += edge->winding;
+            bool inside = nonZero ? (winding != 0) : (winding % 2 != 0);
+            if (!wasInside && inside) {
+                spanStart = edge->current;
+            }
+            else if (wasInside && !inside) {
+                int left = PNTR_MAX((int)PNTR_CEILF(spanStart), clipLeft);
+                int right = PNTR_MIN((int)PNTR_CEILF(edge->current), clipRight);
+                if (left < right) {
+                    _pntr_fill_span(dst, left, y, right - left, color);
+                }
+            }
+        }
+    }
+
+    PNTR_FREE(heads);
+    PNTR_FREE(list->edges);
 }
 
-PNTR_API void pntr_draw_polygon_thick(pntr_image* dst, pntr_vector* points, int numPoints, int thickness, pntr_color color) {
-    if (dst == NULL || color.rgba.a == 0 || numPoints <= 0 || points == NULL) {
+/**
+ * The most points a piece of a stroke can have.
+ *
+ * @internal
+ */
+#define _PNTR_STROKE_PIECE_POINTS 40
+
+/**
+ * Adds the points of an arc to a piece of a stroke, turning from one offset around the center towards another by
+ * less than half of a turn. The last offset is not added.
+ *
+ * The arc is stepped by rotating the offset, so there is no trigonometry involved.
+ *
+ * @return The new amount of points in the piece.
+ *
+ * @internal
+ */
+static int _pntr_stroke_arc(float* points, int count, float centerX, float centerY, float fromX, float fromY, float toX, float toY, float cosStep, float sinStep) {
+    float direction = (fromX * toY - fromY * toX < 0.0f) ? -1.0f : 1.0f;
+    float sinTurn = sinStep * direction;
+    float x = fromX;
+    float y = fromY;
+    do {
+        points[count * 2] = centerX + x;
+        points[count * 2 + 1] = centerY + y;
+        count++;
+        float nextX = x * cosStep - y * sinTurn;
+        y = x * sinTurn + y * cosStep;
+        x = nextX;
+    } while ((x * toY - y * toX) * direction > 0.0f && count < _PNTR_STROKE_PIECE_POINTS - 2);
+
+    return count;
+}
+
+/**
+ * Adds the cap at an end of a stroke.
+ *
+ * @param directionX The x direction leaving the stroke at this end, with a length of 1.
+ * @param directionY The y direction leaving the stroke at this end, with a length of 1.
+ *
+ * @internal
+ */
+static void _pntr_stroke_cap(_pntr_scan_edges* edges, float x, float y, float directionX, float directionY, float halfThickness, pntr_line_cap cap, float cosStep, float sinStep) {
+    float normalX = -directionY * halfThickness;
+    float normalY = directionX * halfThickness;
+    float forwardX = directionX * halfThickness;
+    float forwardY = directionY * halfThickness;
+    float piece[_PNTR_STROKE_PIECE_POINTS * 2];
+    int count;
+
+    // The center is a point of the piece, so that it shares its edges with the segment exactly.
+    piece[0] = x;
+    piece[1] = y;
+    if (cap == PNTR_LINE_CAP_SQUARE) {
+        piece[2] = x + normalX;
+        piece[3] = y + normalY;
+        piece[4] = x + normalX + forwardX;
+        piece[5] = y + normalY + forwardY;
+        piece[6] = x - normalX + forwardX;
+        piece[7] = y - normalY + forwardY;
+        count = 4;
+    }
+    else if (cap == PNTR_LINE_CAP_ROUND) {
+        count = _pntr_stroke_arc(piece, 1, x, y, normalX, normalY, forwardX, forwardY, cosStep, sinStep);
+        count = _pntr_stroke_arc(piece, count, x, y, forwardX, forwardY, -normalX, -normalY, cosStep, sinStep);
+    }
+    else {
         return;
     }
 
-    int nextPointIndex;
-    for (int i = 0; i < numPoints; i++) {
-        if (i < numPoints - 1) {
-            nextPointIndex = i + 1;
+    piece[count * 2] = x - normalX;
+    piece[count * 2 + 1] = y - normalY;
+    _pntr_scan_edges_add_polygon(edges, piece, count + 1);
+}
+
+/**
+ * Adds the join between two segments of a stroke, which fills the gap on the outer side of the turn.
+ *
+ * @param inX The x direction of the segment coming in to the point, with a length of 1.
+ * @param inY The y direction of the segment coming in to the point, with a length of 1.
+ * @param outX The x direction of the segment going out of the point, with a length of 1.
+ * @param outY The y direction of the segment going out of the point, with a length of 1.
+ *
+ * @internal
+ */
+static void _pntr_stroke_join(_pntr_scan_edges* edges, float x, float y, float inX, float inY, float outX, float outY, float halfThickness, pntr_line_join join, float cosStep, float sinStep) {
+    float cross = inX * outY - inY * outX;
+    float dot = inX * outX + inY * outY;
+
+    // The gap is on the side that the stroke turns away from.
+    float side = (cross > 0.0f) ? -halfThickness : halfThickness;
+    float fromX = -inY * side;
+    float fromY = inX * side;
+    float toX = -outY * side;
+    float toY = outX * side;
+    float piece[_PNTR_STROKE_PIECE_POINTS * 2];
+    piece[0] = x;
+    piece[1] = y;
+    int count = 1;
+
+    if (join == PNTR_LINE_JOIN_ROUND) {
+        if (cross == 0.0f) {
+            // Turning straight back goes around the front of the point.
+            count = _pntr_stroke_arc(piece, count, x, y, fromX, fromY, inX * halfThickness, inY * halfThickness, cosStep, sinStep);
+            count = _pntr_stroke_arc(piece, count, x, y, inX * halfThickness, inY * halfThickness, toX, toY, cosStep, sinStep);
         }
         else {
-            nextPointIndex = 0;
+            count = _pntr_stroke_arc(piece, count, x, y, fromX, fromY, toX, toY, cosStep, sinStep);
+        }
+    }
+    else {
+        piece[2] = x + fromX;
+        piece[3] = y + fromY;
+        count = 2;
+
+        // The miter's length grows as the turn sharpens, so sharp turns are beveled instead.
+        if (join == PNTR_LINE_JOIN_MITER && 1.0f + dot >= 0.125f) {
+            float scale = 1.0f / (1.0f + dot);
+            piece[4] = x + (fromX + toX) * scale;
+            piece[5] = y + (fromY + toY) * scale;
+            count = 3;
         }
+    }
 
-        pntr_draw_line_thick(dst, points[i].x, points[i].y, points[nextPointIndex].x, points[nextPointIndex].y, thickness, color);
-   }
+    piece[count * 2] = x + toX;
+    piece[count * 2 + 1] = y + toY;
+    count++;
+    _pntr_scan_edges_add_polygon(edges, piece, count);
 }
 
-PNTR_API void pntr_draw_polygon_fill(pntr_image* dst, pntr_vector* points, int numPoints, pntr_color color) {
-    if (dst == NULL || points == NULL || numPoints <= 0 || color.rgba.a == 0) {
-        return;
+/**
+ * Adds the outline of a thick line through a list of points.
+ *
+ * Each segment, join and cap is added as a convex piece of the stroke's outline. When the outline is filled with the
+ * non-zero rule, pixels where the pieces overlap are still only drawn once.
+ *
+ * @param points The x and y coordinates of each point. Repeated points are removed in place.
+ * @param numPoints How many points there are.
+ * @param closed Whether the last point connects back to the first one, like a polygon.
+ * @param thickness How thick the line is.
+ * @param join How to draw the corners between segments.
+ * @param cap How to draw the ends, when not closed.
+ *
+ * @internal
+ */
+static void _pntr_stroke_add(_pntr_scan_edges* edges, float* points, int numPoints, bool closed, float thickness, pntr_line_join join, pntr_line_cap cap) {
+    // Repeated points have no direction, so skip them.
+    int count = 1;
+    for (int i = 1; i < numPoints; i++) {
+        if (points[i * 2] != points[count * 2 - 2] || points[i * 2 + 1] != points[count * 2 - 1]) {
+            points[count * 2] = points[i * 2];
+            points[count * 2 + 1] = points[i * 2 + 1];
+            count++;
+        }
+    }
+    if (closed && count > 1 && points[count * 2 - 2] == points[0] && points[count * 2 - 1] == points[1]) {
+        count--;
+    }
+
+    // Step around arcs so that they stray from the true circle by at most a quarter of a pixel.
+    float halfThickness = thickness * 0.5f;
+    float cosHalfStep = PNTR_MAX(1.0f - 0.25f / halfThickness, 0.0f);
+    float cosStep = PNTR_MIN(2.0f * cosHalfStep * cosHalfStep - 1.0f, 0.995184727f);
+    float sinStep = PNTR_SQRTF(1.0f - cosStep * cosStep);
+
+    // A single point is drawn as its two caps back to back.
+    if (count == 1) {
+        pntr_line_cap dot = closed ? PNTR_LINE_CAP_ROUND : cap;
+        _pntr_stroke_cap(edges, points[0], points[1], 1.0f, 0.0f, halfThickness, dot, cosStep, sinStep);
+        _pntr_stroke_cap(edges, points[0], points[1], -1.0f, 0.0f, halfThickness, dot, cosStep, sinStep);
+        return;
+    }
+
+    int segments = closed ? count : count - 1;
+    float firstX = 0.0f;
+    float firstY = 0.0f;
+    float previousX = 0.0f;
+    float previousY = 0.0f;
+    float piece[12];
+    for (int i = 0; i < segments; i++) {
+        const float* start = &points[i * 2];
+        const float* end = &points[((i + 1) % count) * 2];
+        float directionX = end[0] - start[0];
+        float directionY = end[1] - start[1];
+        float length = PNTR_SQRTF(directionX * directionX + directionY * directionY);
+        directionX /= length;
+        directionY /= length;
+
+        // The end points are points of the segment too, so that it shares its edges with the joins and caps exactly.
+        float normalX = -directionY * halfThickness;
+        float normalY = directionX * halfThickness;
+        piece[0] = start[0];
+        piece[1] = start[1];
+        piece[2] = start[0] + normalX;
+        piece[3] = start[1] + normalY;
+        piece[4] = end[0] + normalX;
+        piece[5] = end[1] + normalY;
+        piece[6] = end[0];
+        piece[7] = end[1];
+        piece[8] = end[0] - normalX;
+        piece[9] = end[1] - normalY;
+        piece[10] = start[0] - normalX;
+        piece[11] = start[1] - normalY;
+        _pntr_scan_edges_add_polygon(edges, piece, 6);
+
+        if (i == 0) {
+            firstX = directionX;
+            firstY = directionY;
+        }
+        else {
+            _pntr_stroke_join(edges, start[0], start[1], previousX, previousY, directionX, directionY, halfThickness, join, cosStep, sinStep);
+        }
+        previousX = directionX;
+        previousY = directionY;
+    }
+
+    if (closed) {
+        _pntr_stroke_join(edges, points[0], points[1], previousX, previousY, firstX, firstY, halfThickness, join, cosStep, sinStep);
+    }
+    else {
+        _pntr_stroke_cap(edges, points[0], points[1], -firstX, -firstY, halfThickness, cap, cosStep, sinStep);
+        _pntr_stroke_cap(edges, points[count * 2 - 2], points[count * 2 - 1], previousX, previousY, halfThickness, cap, cosStep, sinStep);
+    }
+}
+
+/**
+ * Draws a thick line through a list of points.
+ *
+ * @see _pntr_stroke_add()
+ * @internal
+ */
+static void _pntr_draw_stroke(pntr_image* dst, float* points, int numPoints, bool closed, float thickness, pntr_line_join join, pntr_line_cap cap, pntr_color color) {
+    _pntr_scan_edges edges;
+    _pntr_scan_edges_init(&edges, dst);
+    _pntr_stroke_add(&edges, points, numPoints, closed, thickness, join, cap);
+    _pntr_scan_edges_fill(dst, &edges, true, color);
+}
+
+/**
+ * Draws a thick line through a list of vectors.
+ *
+ * @see _pntr_draw_stroke()
+ * @internal
+ */
+static void _pntr_draw_stroke_vectors(pntr_image* dst, pntr_vector* points, int numPoints, bool closed, int thickness, pntr_line_join join, pntr_line_cap cap, pntr_color color) {
+    float* coordinates = (float*)PNTR_MALLOC(sizeof(float) * 2 * (size_t)numPoints);
+    if (coordinates == NULL) {
+        pntr_set_error(PNTR_ERROR_NO_MEMORY);
+        return;
+    }
+
+    for (int i = 0; i < numPoints; i++) {
+        coordinates[i * 2] = (float)points[i].x;
+        coordinates[i * 2 + 1] = (float)points[i].y;
+    }
+
+    _pntr_draw_stroke(dst, coordinates, numPoints, closed, (float)thickness, join, cap, color);
+    PNTR_FREE(coordinates);
+}
+
+/**
+ * An edge of an anti-aliased shape, keeping its exact fractional extent.
+ *
+ * @see _pntr_coverage
+ * @internal
+ */
+typedef struct _pntr_coverage_edge {
+    float x; /** The x coordinate at the top of the edge. */
+    float top; /** The y coordinate of the top of the edge. */
+    float bottom; /** The y coordinate of the bottom of the edge. */
+    float slope; /** How much the x coordinate changes for each pixel down the edge. */
+    float direction; /** 1 when the edge goes down, or -1 when it goes up. */
+    int next; /** The next edge that starts on the same row, or -1. */
+} _pntr_coverage_edge;
+
+/**
+ * A list of edges whose coverage of each pixel is computed analytically, clipped to an image.
+ *
+ * Pixel (x, y) covers the area from (x, y) to (x + 1, y + 1). Where the edges wind around an area any number of times
+ * it is covered, so overlapping contours are filled as their union, and a contour wound the other way cuts a hole.
+ *
+ * @see _pntr_coverage_fill()
+ * @internal
+ */
+typedef struct _pntr_coverage {
+    _pntr_coverage_edge* edges; /** The edges. */
+    int count; /** How many edges there are. */
+    int capacity; /** How many edges fit before the list needs to grow. */
+    int top; /** The first row of the clip. */
+    int bottom; /** The last row of the clip. */
+    float left; /** The left of the clip. */
+    float right; /** The right of the clip. Edges past it are moved onto it, as they still end the coverage before them. */
+    bool failed; /** Whether the list ran out of memory. */
+} _pntr_coverage;
+
+/**
+ * Starts an empty list of anti-aliased edges for filling on the given image.
+ *
+ * @internal
+ */
+static void _pntr_coverage_init(_pntr_coverage* coverage, pntr_image* dst) {
+    coverage->edges = NULL;
+    coverage->count = 0;
+    coverage->capacity = 0;
+    coverage->top = dst->clip.y;
+    coverage->bottom = dst->clip.y + dst->clip.height - 1;
+    coverage->left = (float)dst->clip.x;
+    coverage->right = (float)(dst->clip.x + dst->clip.width);
+    coverage->failed = false;
+}
+
+/**
+ * Adds an edge from one point to another, skipping it when it covers nothing within the clip.
+ *
+ * Edges past the right of the clip are moved onto it, so that they still end the coverage before them.
+ *
+ * @internal
+ */
+static void _pntr_coverage_add(_pntr_coverage* coverage, float x1, float y1, float x2, float y2) {
+    if (y1 == y2 || coverage->failed) {
+        return;
+    }
+    if (x1 >= coverage->right && x2 >= coverage->right) {
+        x1 = coverage->right;
+        x2 = coverage->right;
+    }
+
+    float direction = 1.0f;
+    if (y1 > y2) {
+        float swap = x1;
+        x1 = x2;
+        x2 = swap;
+        swap = y1;
+        y1 = y2;
+        y2 = swap;
+        direction = -1.0f;
+    }
+
+    if (y2 <= (float)coverage->top || y1 >= (float)(coverage->bottom + 1)) {
+        return;
+    }
+
+    if (coverage->count == coverage->capacity) {
+        int capacity = (coverage->capacity > 0) ? coverage->capacity * 2 : 64;
+        _pntr_coverage_edge* edges = (_pntr_coverage_edge*)PNTR_REALLOC(coverage->edges, sizeof(_pntr_coverage_edge) * (size_t)capacity);
+        if (edges == NULL) {
+            coverage->failed = true;
+            pntr_set_error(PNTR_ERROR_NO_MEMORY);
+            return;
+        }
+        coverage->edges = edges;
+        coverage->capacity = capacity;
+    }
+
+    _pntr_coverage_edge* edge = &coverage->edges[coverage->count++];
+    edge->x = x1;
+    edge->top = y1;
+    edge->bottom = y2;
+    edge->slope = (x2 - x1) / (y2 - y1);
+    edge->direction = direction;
+}
+
+/**
+ * Adds the edges of a closed contour, in the order the points are given.
+ *
+ * @param points The x and y coordinates of each point.
+ * @param count How many points there are.
+ *
+ * @internal
+ */
+static void _pntr_coverage_add_polygon(_pntr_coverage* coverage, const float* points, int count) {
+    for (int i = 0, j = count - 1; i < count; j = i++) {
+        _pntr_coverage_add(coverage, points[j * 2], points[j * 2 + 1], points[i * 2], points[i * 2 + 1]);
+    }
+}
+
+/**
+ * Adds the edges of an ellipse, with chords that stray from the curve by no more than a fiftieth of a pixel.
+ *
+ * One quarter is stepped by rotating a point, and then mirrored into the others, so there is only trigonometry for
+ * the step itself.
+ *
+ * @param reverse Whether to wind the other way around, for cutting a hole out of another contour.
+ *
+ * @internal
+ */
+static void _pntr_coverage_add_ellipse(_pntr_coverage* coverage, float centerX, float centerY, float radiusX, float radiusY, bool reverse) {
+    // A chord over the angle a strays from its arc by about radius * a * a / 8.
+    float radius = PNTR_MAX(radiusX, radiusY);
+    int steps = (int)PNTR_CEILF((PNTR_PI / 2.0f) / PNTR_SQRTF(8.0f * 0.02f / radius));
+    steps = PNTR_MAX(2, PNTR_MIN(steps, 256));
+    float angle = (PNTR_PI / 2.0f) / (float)steps;
+    float cosStep = PNTR_COSF(angle);
+    float sinStep = PNTR_SINF(angle);
+
+    float previousX = centerX + radiusX;
+    float previousY = centerY;
+    for (int quarter = 0; quarter < 4; quarter++) {
+        float cosine = 1.0f;
+        float sine = 0.0f;
+        for (int i = 1; i <= steps; i++) {
+            float rotated = cosine * cosStep - sine * sinStep;
+            sine = sine * cosStep + cosine * sinStep;
+            cosine = rotated;
+            if (i == steps) {
+                cosine = 0.0f;
+                sine = 1.0f;
+            }
+
+            // Turn the point of the first quarter into the quarter being added.
+            float x = cosine;
+            float y = sine;
+            if (quarter == 1) {
+                x = -sine;
+                y = cosine;
+            }
+            else if (quarter == 2) {
+                x = -cosine;
+                y = -sine;
+            }
+            else if (quarter == 3) {
+                x = sine;
+                y = -cosine;
+            }
+            x = centerX + x * radiusX;
+            y = centerY + y * radiusY;
+
+            if (reverse) {
+                _pntr_coverage_add(coverage, x, y, previousX, previousY);
+            }
+            else {
+                _pntr_coverage_add(coverage, previousX, previousY, x, y);
+            }
+            previousX = x;
+            previousY = y;
+        }
+    }
+}
+
+/**
+ * Accumulates the area a piece of an edge within one row covers, where both of its ends are within the row's cells.
+ *
+ * Each cell gets the area to the right of the piece within it, and the cell after the piece gets the rest of its
+ * height, so that a running sum across the row gives the coverage of each pixel.
+ *
+ * @param cells The accumulation cells of the row.
+ * @param x The x coordinate where the piece starts, relative to the first cell.
+ * @param xNext The x coordinate where the piece ends, relative to the first cell.
+ * @param height How much of the row's height the piece spans, negative when it goes up.
+ * @param first The first cell that was touched so far, which is updated.
+ * @param last The last cell that was touched so far, which is updated.
+ *
+ * @internal
+ */
+static void _pntr_coverage_accumulate(float* cells, float x, float xNext, float height, int* first, int* last) {
+    float x0 = PNTR_MIN(x, xNext);
+    float x1 = PNTR_MAX(x, xNext);
+    float x0Floor = PNTR_FLOORF(x0);
+    float x1Ceil = PNTR_CEILF(x1);
+    int x0i = (int)x0Floor;
+    int x1i = (int)x1Ceil;
+
+    if (x1i <= x0i + 1) {
+        // The piece stays within one cell.
+        float middle = 0.5f * (x + xNext) - x0Floor;
+        cells[x0i] += height - height * middle;
+        cells[x0i + 1] += height * middle;
+        x1i = x0i + 1;
+    }
+    else {
+        // The piece spreads its height over the cells it passes through.
+        float scale = 1.0f / (x1 - x0);
+        float x0Fraction = x0 - x0Floor;
+        float firstArea = 0.5f * scale * (1.0f - x0Fraction) * (1.0f - x0Fraction);
+        float x1Fraction = x1 - x1Ceil + 1.0f;
+        float lastArea = 0.5f * scale * x1Fraction * x1Fraction;
+        cells[x0i] += height * firstArea;
+        if (x1i == x0i + 2) {
+            cells[x0i + 1] += height * (1.0f - firstArea - lastArea);
+        }
+        else {
+            float area = scale * (1.5f - x0Fraction);
+            cells[x0i + 1] += height * (area - firstArea);
+            for (int i = x0i + 2; i < x1i - 1; i++) {
+                cells[i] += height * scale;
+            }
+            area += (float)(x1i - x0i - 3) * scale;
+            cells[x1i - 1] += height * (1.0f - area - lastArea);
+        }
+        cells[x1i] += height * lastArea;
+    }
+
+    *first = PNTR_MIN(*first, x0i);
+    *last = PNTR_MAX(*last, x1i);
+}
+
+/**
+ * Fills the coverage of all the edges one row at a time, blending each pixel once, and then frees them.
+ *
+ * Only the cells an edge passes through are touched. A running sum across them gives the coverage of each pixel, and
+ * the pixels between them share the same coverage, so they are filled as spans.
+ *
+ * @internal
+ */
+static void _pntr_coverage_fill(pntr_image* dst, _pntr_coverage* coverage, pntr_color color) {
+    if (coverage->count == 0 || coverage->failed) {
+        PNTR_FREE(coverage->edges);
+        return;
+    }
+
+    // Bucket the edges by the row they start on, with room for two extra cells past the right of the clip.
+    int rows = coverage->bottom - coverage->top + 1;
+    int width = dst->clip.width;
+    int* heads = (int*)PNTR_MALLOC(sizeof(int) * (size_t)(rows + coverage->count) + sizeof(float) * (size_t)(width + 2));
+    if (heads == NULL) {
+        pntr_set_error(PNTR_ERROR_NO_MEMORY);
+        PNTR_FREE(coverage->edges);
+        return;
+    }
+    int* active = heads + rows;
+    float* cells = (float*)(void*)(active + coverage->count);
+    for (int row = 0; row < rows; row++) {
+        heads[row] = -1;
+    }
+    for (int i = 0; i < width + 2; i++) {
+        cells[i] = 0.0f;
+    }
+    _pntr_coverage_edge* edges = coverage->edges;
+    for (int i = coverage->count - 1; i >= 0; i--) {
+        int row = PNTR_MAX((int)PNTR_FLOORF(edges[i].top), coverage->top) - coverage->top;
+        edges[i].next = heads[row];
+        heads[row] = i;
+    }
+
+    float right = (float)width;
+    int activeCount = 0;
+    for (int y = coverage->top; y <= coverage->bottom; y++) {
+        for (int i = heads[y - coverage->top]; i >= 0; i = edges[i].next) {
+            active[activeCount++] = i;
+        }
+        if (activeCount == 0) {
+            continue;
+        }
+
+        // Accumulate the piece of each edge within this row, dropping the edges that end in it.
+        int first = width + 2;
+        int last = -1;
+        int kept = 0;
+        float rowTop = (float)y;
+        float rowBottom = rowTop + 1.0f;
+        for (int i = 0; i < activeCount; i++) {
+            _pntr_coverage_edge* edge = &edges[active[i]];
+            float top = PNTR_MAX(edge->top, rowTop);
+            float bottom = PNTR_MIN(edge->bottom, rowBottom);
+            float xTop = edge->x + (top - edge->top) * edge->slope - coverage->left;
+            float xBottom = edge->x + (bottom - edge->top) * edge->slope - coverage->left;
+            float height = (bottom - top) * edge->direction;
+
+            // The parts of the piece outside of the clip are pushed onto its sides. On the left they still cover the
+            // whole row, and on the right they don't cover anything visible.
+            float splits[4];
+            int splitCount = 0;
+            splits[splitCount++] = 0.0f;
+            if ((xTop < 0.0f) != (xBottom < 0.0f)) {
+                splits[splitCount++] = -xTop / (xBottom - xTop);
+            }
+            if ((xTop > right) != (xBottom > right)) {
+                splits[splitCount++] = (right - xTop) / (xBottom - xTop);
+            }
+            if (splitCount == 3 && splits[1] > splits[2]) {
+                float swap = splits[1];
+                splits[1] = splits[2];
+                splits[2] = swap;
+            }
+            splits[splitCount++] = 1.0f;
+            for (int s = 0; s < splitCount - 1; s++) {
+                float from = xTop + (xBottom - xTop) * splits[s];
+                float to = xTop + (xBottom - xTop) * splits[s + 1];
+                from = PNTR_MAX(0.0f, PNTR_MIN(from, right));
+                to = PNTR_MAX(0.0f, PNTR_MIN(to, right));
+                _pntr_coverage_accumulate(cells, from, to, height * (splits[s + 1] - splits[s]), &first, &last);
+            }
+
+            if (edge->bottom > rowBottom) {
+                active[kept++] = active[i];
+            }
+        }
+        activeCount = kept;
+
+        // Sum the cells from left to right, filling each run of the same coverage at once.
+        int end = PNTR_MIN(last, width - 1);
+        float sum = 0.0f;
+        int x = first;
+        while (x <= end) {
+            sum += cells[x];
+            cells[x] = 0.0f;
+            int run = 1;
+            while (x + run <= end && cells[x + run] == 0.0f) {
+                run++;
+            }
+
+            float amount = PNTR_MIN(PNTR_FABSF(sum), 1.0f);
+            int alpha = (int)(amount * (float)color.rgba.a + 0.5f);
+            if (alpha > 0) {
+                pntr_color faded = color;
+                faded.rgba.a = (unsigned char)alpha;
+                _pntr_fill_span(dst, dst->clip.x + x, y, run, faded);
+            }
+            x += run;
+        }
+        for (x = PNTR_MAX(first, end + 1); x <= last; x++) {
+            cells[x] = 0.0f;
+        }
+    }
+
+    PNTR_FREE(heads);
+    PNTR_FREE(coverage->edges);
+}
+
+/**
+ * Draws an anti-aliased line on the given image.
+ *
+ * The line is one pixel wide, and reaches half a pixel past both of its points, so that a straight line fully covers
+ * the pixels of both of them. Each pixel is blended by how much of it the line covers.
+ *
+ * @param dst The image to draw the line onto.
+ * @param startPosX The x coordinate of the start of the line.
+ * @param startPosY The y coordinate of the start of the line.
+ * @param endPosX The x coordinate of the end of the line.
+ * @param endPosY The y coordinate of the end of the line.
+ * @param color The color of the line.
+ *
+ * @see pntr_draw_line()
+ */
+PNTR_API void pntr_draw_line_aa(pntr_image* dst, int startPosX, int startPosY, int endPosX, int endPosY, pntr_color color) {
+    if (dst == NULL || color.rgba.a == 0 || dst->clip.width <= 0 || dst->clip.height <= 0) {
+        return;
+    }
+
+    float directionX = (float)(endPosX - startPosX);
+    float directionY = (float)(endPosY - startPosY);
+    float length = PNTR_SQRTF(directionX * directionX + directionY * directionY);
+    if (length > 0.0f) {
+        directionX = directionX / length * 0.5f;
+        directionY = directionY / length * 0.5f;
+    }
+    else {
+        directionX = 0.5f;
+        directionY = 0.0f;
+    }
+
+    float startX = (float)startPosX + 0.5f - directionX;
+    float startY = (float)startPosY + 0.5f - directionY;
+    float endX = (float)endPosX + 0.5f + directionX;
+    float endY = (float)endPosY + 0.5f + directionY;
+    float points[8] = {
+        startX - directionY, startY + directionX,
+        endX - directionY, endY + directionX,
+        endX + directionY, endY - directionX,
+        startX + directionY, startY - directionX
+    };
+
+    _pntr_coverage coverage;
+    _pntr_coverage_init(&coverage, dst);
+    _pntr_coverage_add_polygon(&coverage, points, 4);
+    _pntr_coverage_fill(dst, &coverage, color);
+}
+
+/**
+ * Draws an anti-aliased line on the given image.
+ *
+ * @see pntr_draw_line_aa()
+ */
+PNTR_API void pntr_draw_line_aa_vec(pntr_image* dst, pntr_vector start, pntr_vector end, pntr_color color) {
+    pntr_draw_line_aa(dst, start.x, start.y, end.x, end.y, color);
+}
+
+/**
+ * Draws an anti-aliased ellipse outline, one pixel wide, on the given image.
+ *
+ * @param dst The image to draw the ellipse onto.
+ * @param centerX The center of the ellipse at the X coordinate.
+ * @param centerY The center of the ellipse at the Y coordinate.
+ * @param radiusX The horizontal radius of the ellipse.
+ * @param radiusY The vertical radius of the ellipse.
+ * @param color The color of the ellipse.
+ *
+ * @see pntr_draw_ellipse()
+ */
+PNTR_API void pntr_draw_ellipse_aa(pntr_image* dst, int centerX, int centerY, int radiusX, int radiusY, pntr_color color) {
+    if (dst == NULL || color.rgba.a == 0 || dst->clip.width <= 0 || dst->clip.height <= 0) {
+        return;
+    }
+
+    radiusX = (radiusX < 0) ? -radiusX : radiusX;
+    radiusY = (radiusY < 0) ? -radiusY : radiusY;
+
+    // The outline is the ring between the ellipses half a pixel inside and outside of it.
+    _pntr_coverage coverage;
+    _pntr_coverage_init(&coverage, dst);
+    _pntr_coverage_add_ellipse(&coverage, (float)centerX + 0.5f, (float)centerY + 0.5f, (float)radiusX + 0.5f, (float)radiusY + 0.5f, false);
+    if (radiusX > 0 && radiusY > 0) {
+        _pntr_coverage_add_ellipse(&coverage, (float)centerX + 0.5f, (float)centerY + 0.5f, (float)radiusX - 0.5f, (float)radiusY - 0.5f, true);
+    }
+    _pntr_coverage_fill(dst, &coverage, color);
+}
+
+/**
+ * Draws an anti-aliased filled ellipse on the given image.
+ *
+ * @param dst The image to draw the filled ellipse onto.
+ * @param centerX The center of the ellipse at the X coordinate.
+ * @param centerY The center of the ellipse at the Y coordinate.
+ * @param radiusX The horizontal radius of the ellipse.
+ * @param radiusY The vertical radius of the ellipse.
+ * @param color The fill color of the ellipse.
+ *
+ * @see pntr_draw_ellipse_fill()
+ */
+PNTR_API void pntr_draw_ellipse_fill_aa(pntr_image* dst, int centerX, int centerY, int radiusX, int radiusY, pntr_color color) {
+    if (dst == NULL || color.rgba.a == 0 || dst->clip.width <= 0 || dst->clip.height <= 0) {
+        return;
+    }
+
+    radiusX = (radiusX < 0) ? -radiusX : radiusX;
+    radiusY = (radiusY < 0) ? -radiusY : radiusY;
+
+    _pntr_coverage coverage;
+    _pntr_coverage_init(&coverage, dst);
+    _pntr_coverage_add_ellipse(&coverage, (float)centerX + 0.5f, (float)centerY + 0.5f, (float)radiusX + 0.5f, (float)radiusY + 0.5f, false);
+    _pntr_coverage_fill(dst, &coverage, color);
+}
+
+/**
+ * Draws an anti-aliased circle outline, one pixel wide, on the given image.
+ *
+ * @see pntr_draw_circle()
+ * @see pntr_draw_ellipse_aa()
+ */
+PNTR_API void pntr_draw_circle_aa(pntr_image* dst, int centerX, int centerY, int radius, pntr_color color) {
+    pntr_draw_ellipse_aa(dst, centerX, centerY, radius, radius, color);
+}
+
+/**
+ * Draws an anti-aliased filled circle on the given image.
+ *
+ * @see pntr_draw_circle_fill()
+ * @see pntr_draw_ellipse_fill_aa()
+ */
+PNTR_API void pntr_draw_circle_fill_aa(pntr_image* dst, int centerX, int centerY, int radius, pntr_color color) {
+    pntr_draw_ellipse_fill_aa(dst, centerX, centerY, radius, radius, color);
+}
+
+/**
+ * Draws an anti-aliased filled polygon on the given image.
+ *
+ * The edges of the polygon pass through the centers of its points' pixels. Where the polygon overlaps itself, the
+ * overlap is filled too.
+ *
+ * @param dst The image to draw the polygon onto.
+ * @param points The points of the polygon.
+ * @param numPoints How many points there are.
+ * @param color The fill color of the polygon.
+ *
+ * @see pntr_draw_polygon_fill()
+ */
+PNTR_API void pntr_draw_polygon_fill_aa(pntr_image* dst, pntr_vector* points, int numPoints, pntr_color color) {
+    if (dst == NULL || points == NULL || numPoints < 3 || color.rgba.a == 0 || dst->clip.width <= 0 || dst->clip.height <= 0) {
+        return;
+    }
+
+    _pntr_coverage coverage;
+    _pntr_coverage_init(&coverage, dst);
+    for (int i = 0, j = numPoints - 1; i < numPoints; j = i++) {
+        _pntr_coverage_add(&coverage, (float)points[j].x + 0.5f, (float)points[j].y + 0.5f, (float)points[i].x + 0.5f, (float)points[i].y + 0.5f);
+    }
+    _pntr_coverage_fill(dst, &coverage, color);
+}
+
+PNTR_API void pntr_draw_line_curve(pntr_image* dst, pntr_vector point1, pntr_vector point2, pntr_vector point3, pntr_vector point4, int segments, pntr_color color) {
+    if (dst == NULL || color.rgba.a == 0 || segments <= 0) {
+        return;
+    }
+
+    float t_step = 1.0f / (float)segments;
+    pntr_vector last = point1;
+    for (int i_step = 1; i_step <= segments; ++i_step) {
+        float t = t_step * (float)i_step;
+        float u = 1.0f - t;
+        float w1 = u * u * u;
+        float w2 = 3 * u * u * t;
+        float w3 = 3 * u * t * t;
+        float w4 = t * t * t;
+        float x = w1 * (float)point1.x + w2 * (float)point2.x + w3 * (float)point3.x + w4 * (float)point4.x;
+        float y = w1 * (float)point1.y + w2 * (float)point2.y + w3 * (float)point3.y + w4 * (float)point4.y;
+        pntr_draw_line(dst, last.x, last.y, (int)x, (int)y, color);
+        last.x = (int)x;
+        last.y = (int)y;
+    }
+}
+
+PNTR_API void pntr_draw_line_curve_thick(pntr_image* dst, pntr_vector point1, pntr_vector point2, pntr_vector point3, pntr_vector point4, int segments, int thickness, pntr_color color) {
+    if (dst == NULL || color.rgba.a == 0 || segments <= 0 || thickness < 1) {
+        return;
+    }
+    if (thickness == 1) {
+        pntr_draw_line_curve(dst, point1, point2, point3, point4, segments, color);
+        return;
+    }
+
+    // The curve is stroked as one polyline, so that the joints between segments are drawn once.
+    float* points = (float*)PNTR_MALLOC(sizeof(float) * 2 * (size_t)(segments + 1));
+    if (points == NULL) {
+        pntr_set_error(PNTR_ERROR_NO_MEMORY);
+        return;
+    }
+
+    float t_step = 1.0f / (float)segments;
+    for (int i_step = 0; i_step <= segments; ++i_step) {
+        float t = t_step * (float)i_step;
+        float u = 1.0f - t;
+        float w1 = u * u * u;
+        float w2 = 3 * u * u * t;
+        float w3 = 3 * u * t * t;
+        float w4 = t * t * t;
+        points[i_step * 2] = w1 * (float)point1.x + w2 * (float)point2.x + w3 * (float)point3.x + w4 * (float)point4.x;
+        points[i_step * 2 + 1] = w1 * (float)point1.y + w2 * (float)point2.y + w3 * (float)point3.y + w4 * (float)point4.y;
+    }
+
+    _pntr_draw_stroke(dst, points, segments + 1, false, (float)thickness, PNTR_LINE_JOIN_ROUND, PNTR_LINE_CAP_ROUND, color);
+    PNTR_FREE(points);
+}
+
+/**
+ * How far the lines of a flattened curve may stray from the true curve, in pixels.
+ *
+ * @internal
+ */
+#define _PNTR_PATH_TOLERANCE 0.25f
+
+/**
+ * The most lines that a single curve is flattened into.
+ *
+ * @internal
+ */
+#define _PNTR_PATH_MAX_SEGMENTS 1024
+
+/**
+ * Creates a new, empty path.
+ *
+ * @code
+ * pntr_path* path = pntr_new_path();
+ * pntr_path_move_to(path, 10, 10);
+ * pntr_path_line_to(path, 90, 10);
+ * pntr_path_quad_to(path, 90, 90, 10, 90);
+ * pntr_path_close(path);
+ * pntr_draw_path_fill(image, path, PNTR_FILL_RULE_NON_ZERO, PNTR_RED);
+ * pntr_unload_path(path);
+ * @endcode
+ *
+ * @return The new path, which must be unloaded with pntr_unload_path(). NULL on failure.
+ *
+ * @see pntr_unload_path()
+ * @see pntr_draw_path_fill()
+ * @see pntr_draw_path_thick()
+ */
+PNTR_API pntr_path* pntr_new_path(void) {
+    pntr_path* path = (pntr_path*)PNTR_MALLOC(sizeof(pntr_path));
+    if (path == NULL) {
+        return (pntr_path*)pntr_set_error(PNTR_ERROR_NO_MEMORY);
+    }
+
+    path->points = NULL;
+    path->pointsCount = 0;
+    path->pointsCapacity = 0;
+    path->contours = NULL;
+    path->contoursCount = 0;
+    path->contoursCapacity = 0;
+    path->x = 0.0f;
+    path->y = 0.0f;
+    path->open = false;
+
+    return path;
+}
+
+/**
+ * Unloads the given path from memory.
+ *
+ * @param path The path to unload.
+ *
+ * @see pntr_new_path()
+ */
+PNTR_API void pntr_unload_path(pntr_path* path) {
+    if (path == NULL) {
+        return;
+    }
+
+    PNTR_FREE(path->points);
+    PNTR_FREE(path->contours);
+    PNTR_FREE(path);
+}
+
+/**
+ * Adds a point to the last contour of the path, and makes it the current point.
+ *
+ * A point that repeats the one before it is skipped, so the contours can be stroked without being copied.
+ *
+ * @internal
+ */
+static void _pntr_path_add(pntr_path* path, float x, float y) {
+    path->x = x;
+    path->y = y;
+
+    pntr_path_contour* contour = &path->contours[path->contoursCount - 1];
+    if (contour->count > 0 && path->points[path->pointsCount * 2 - 2] == x && path->points[path->pointsCount * 2 - 1] == y) {
+        return;
+    }
+
+    if (path->pointsCount == path->pointsCapacity) {
+        int capacity = (path->pointsCapacity > 0) ? path->pointsCapacity * 2 : 32;
+        float* points = (float*)PNTR_REALLOC(path->points, sizeof(float) * 2 * (size_t)capacity);
+        if (points == NULL) {
+            pntr_set_error(PNTR_ERROR_NO_MEMORY);
+            return;
+        }
+        path->points = points;
+        path->pointsCapacity = capacity;
+    }
+
+    path->points[path->pointsCount * 2] = x;
+    path->points[path->pointsCount * 2 + 1] = y;
+    path->pointsCount++;
+    contour->count++;
+}
+
+/**
+ * Starts a new contour at the current point, unless one is already open.
+ *
+ * @return True when there is an open contour to add to, or false when there was no memory for a new one.
+ *
+ * @internal
+ */
+static bool _pntr_path_begin(pntr_path* path) {
+    if (path->open) {
+        return true;
+    }
+
+    if (path->contoursCount == path->contoursCapacity) {
+        int capacity = (path->contoursCapacity > 0) ? path->contoursCapacity * 2 : 4;
+        pntr_path_contour* contours = (pntr_path_contour*)PNTR_REALLOC(path->contours, sizeof(pntr_path_contour) * (size_t)capacity);
+        if (contours == NULL) {
+            pntr_set_error(PNTR_ERROR_NO_MEMORY);
+            return false;
+        }
+        path->contours = contours;
+        path->contoursCapacity = capacity;
+    }
+
+    pntr_path_contour* contour = &path->contours[path->contoursCount++];
+    contour->start = path->pointsCount;
+    contour->count = 0;
+    contour->closed = false;
+    path->open = true;
+    _pntr_path_add(path, path->x, path->y);
+
+    return true;
+}
+
+/**
+ * How many lines a curve needs so that none of them strays from it by more than the tolerance.
+ *
+ * A curve's lines stray from it by at most an eighth of its largest second derivative, divided by the square of how
+ * many equal steps it is split into.
+ *
+ * @param curvature The largest length of the curve's second derivative.
+ *
+ * @internal
+ */
+static int _pntr_path_segments(float curvature) {
+    float segments = PNTR_CEILF(PNTR_SQRTF(curvature / (8.0f * _PNTR_PATH_TOLERANCE)));
+    if (!(segments >= 1.0f)) {
+        return 1;
+    }
+    return (segments >= (float)_PNTR_PATH_MAX_SEGMENTS) ? _PNTR_PATH_MAX_SEGMENTS : (int)segments;
+}
+
+/**
+ * Moves the current point of the path, so that the next line or curve starts a new contour there.
+ *
+ * @param path The path.
+ * @param x The x coordinate of the new current point.
+ * @param y The y coordinate of the new current point.
+ */
+PNTR_API void pntr_path_move_to(pntr_path* path, float x, float y) {
+    if (path == NULL) {
+        return;
+    }
+
+    path->open = false;
+    path->x = x;
+    path->y = y;
+}
+
+/**
+ * Adds a straight line from the current point to the given point.
+ *
+ * @param path The path.
+ * @param x The x coordinate of where the line ends.
+ * @param y The y coordinate of where the line ends.
+ */
+PNTR_API void pntr_path_line_to(pntr_path* path, float x, float y) {
+    if (path == NULL || !_pntr_path_begin(path)) {
+        return;
+    }
+
+    _pntr_path_add(path, x, y);
+}
+
+/**
+ * Adds a quadratic Bézier curve from the current point to the given point.
+ *
+ * The curve is flattened into as few lines as keep within a quarter of a pixel of it.
+ *
+ * @param path The path.
+ * @param controlX The x coordinate of the control point, which the curve bends towards.
+ * @param controlY The y coordinate of the control point, which the curve bends towards.
+ * @param x The x coordinate of where the curve ends.
+ * @param y The y coordinate of where the curve ends.
+ */
+PNTR_API void pntr_path_quad_to(pntr_path* path, float controlX, float controlY, float x, float y) {
+    if (path == NULL || !_pntr_path_begin(path)) {
+        return;
+    }
+
+    float startX = path->x;
+    float startY = path->y;
+    float bendX = startX - 2.0f * controlX + x;
+    float bendY = startY - 2.0f * controlY + y;
+    int segments = _pntr_path_segments(2.0f * PNTR_SQRTF(bendX * bendX + bendY * bendY));
+
+    for (int i = 1; i <= segments; i++) {
+        float t = (float)i / (float)segments;
+        float u = 1.0f - t;
+        _pntr_path_add(path,
+            u * u * startX + 2.0f * u * t * controlX + t * t * x,
+            u * u * startY + 2.0f * u * t * controlY + t * t * y);
+    }
+}
+
+/**
+ * Adds a cubic Bézier curve from the current point to the given point.
+ *
+ * The curve is flattened into as few lines as keep within a quarter of a pixel of it.
+ *
+ * @param path The path.
+ * @param control1X The x coordinate of the first control point.
+ * @param control1Y The y coordinate of the first control point.
+ * @param control2X The x coordinate of the second control point.
+ * @param control2Y The y coordinate of the second control point.
+ * @param x The x coordinate of where the curve ends.
+ * @param y The y coordinate of where the curve ends.
+ *
+ * @see pntr_draw_line_curve()
+ */
+PNTR_API void pntr_path_cubic_to(pntr_path* path, float control1X, float control1Y, float control2X, float control2Y, float x, float y) {
+    if (path == NULL || !_pntr_path_begin(path)) {
+        return;
+    }
+
+    // The second derivative changes linearly along a cubic, so it is largest at one of the ends.
+    float startX = path->x;
+    float startY = path->y;
+    float bend1X = startX - 2.0f * control1X + control2X;
+    float bend1Y = startY - 2.0f * control1Y + control2Y;
+    float bend2X = control1X - 2.0f * control2X + x;
+    float bend2Y = control1Y - 2.0f * control2Y + y;
+    float bend = PNTR_MAX(bend1X * bend1X + bend1Y * bend1Y, bend2X * bend2X + bend2Y * bend2Y);
+    int segments = _pntr_path_segments(6.0f * PNTR_SQRTF(bend));
+
+    for (int i = 1; i <= segments; i++) {
+        float t = (float)i / (float)segments;
+        float u = 1.0f - t;
+        float w1 = u * u * u;
+        float w2 = 3.0f * u * u * t;
+        float w3 = 3.0f * u * t * t;
+        float w4 = t * t * t;
+        _pntr_path_add(path,
+            w1 * startX + w2 * control1X + w3 * control2X + w4 * x,
+            w1 * startY + w2 * control1Y + w3 * control2Y + w4 * y);
+    }
+}
+
+/**
+ * Closes the current contour with a line back to where it started.
+ *
+ * The next line or curve starts a new contour from there.
+ *
+ * @param path The path.
+ */
+PNTR_API void pntr_path_close(pntr_path* path) {
+    if (path == NULL || !path->open) {
+        return;
+    }
+
+    pntr_path_contour* contour = &path->contours[path->contoursCount - 1];
+    contour->closed = true;
+    path->x = path->points[contour->start * 2];
+    path->y = path->points[contour->start * 2 + 1];
+    path->open = false;
+}
+
+/**
+ * Fills the inside of a path. Every contour is filled as though it were closed.
+ *
+ * @param dst The image to draw the path onto.
+ * @param path The path to fill.
+ * @param rule Which pixels are inside where the contours cross or overlap.
+ * @param color The color to fill the path with.
+ *
+ * @see pntr_draw_path_thick()
+ */
+PNTR_API void pntr_draw_path_fill(pntr_image* dst, pntr_path* path, pntr_fill_rule rule, pntr_color color) {
+    if (dst == NULL || path == NULL || color.rgba.a == 0) {
+        return;
+    }
+
+    _pntr_scan_edges edges;
+    _pntr_scan_edges_init(&edges, dst);
+    for (int c = 0; c < path->contoursCount; c++) {
+        const float* points = &path->points[path->contours[c].start * 2];
+        int count = path->contours[c].count;
+        for (int i = 0, j = count - 1; i < count; j = i++) {
+            _pntr_scan_edges_add(&edges, points[j * 2], points[j * 2 + 1], points[i * 2], points[i * 2 + 1], 1);
+        }
+    }
+    _pntr_scan_edges_fill(dst, &edges, rule != PNTR_FILL_RULE_EVEN_ODD, color);
+}
+
+/**
+ * Draws a thick line along a path.
+ *
+ * All of the contours are stroked together, so where they overlap, pixels are still only drawn once.
+ *
+ * @param dst The image to draw the path onto.
+ * @param path The path to stroke.
+ * @param thickness How thick the line is.
+ * @param join How to draw the corners between the lines of the path.
+ * @param cap How to draw the ends of the contours that are not closed.
+ * @param color The color of the line.
+ *
+ * @see pntr_draw_path_fill()
+ */
+PNTR_API void pntr_draw_path_thick(pntr_image* dst, pntr_path* path, int thickness, pntr_line_join join, pntr_line_cap cap, pntr_color color) {
+    if (dst == NULL || path == NULL || color.rgba.a == 0 || thickness < 1) {
+        return;
+    }
+
+    _pntr_scan_edges edges;
+    _pntr_scan_edges_init(&edges, dst);
+    for (int c = 0; c < path->contoursCount; c++) {
+        if (path->contours[c].count > 0) {
+            _pntr_stroke_add(&edges, &path->points[path->contours[c].start * 2], path->contours[c].count, path->contours[c].closed, (float)thickness, join, cap);
+        }
+    }
+    _pntr_scan_edges_fill(dst, &edges, true, color);
+}
+
+PNTR_API void pntr_draw_polyline(pntr_image* dst, pntr_vector* points, int numPoints, pntr_color color) {
+    if (color.rgba.a == 0 || dst == NULL || numPoints <= 0 || points == NULL) {
+        return;
+    }
+
+    if (numPoints == 1) {
+        pntr_draw_point_vec(dst, points, color);
+        return;
+    }
+
+    for (int i = 0; i < numPoints - 1; i++) {
+        pntr_draw_line_vec(dst, points[i], points[i + 1], color);
+    }
+}
+
+/**
+ * Draws a thick line through a list of points, with round joins and ends.
+ *
+ * @see pntr_draw_polyline_thick_ex()
+ */
+PNTR_API void pntr_draw_polyline_thick(pntr_image* dst, pntr_vector* points, int numPoints, int thickness, pntr_color color) {
+    pntr_draw_polyline_thick_ex(dst, points, numPoints, thickness, PNTR_LINE_JOIN_ROUND, PNTR_LINE_CAP_ROUND, color);
+}
+
+/**
+ * Draws a thick line through a list of points, with the given joins and ends.
+ *
+ * The whole line is filled in one pass, so every pixel is drawn once, even where segments overlap.
+ *
+ * @param dst The image to draw the line on.
+ * @param points The points the line goes through.
+ * @param numPoints How many points there are.
+ * @param thickness How thick the line is, in pixels.
+ * @param join How the corners between segments are drawn.
+ * @param cap How the ends of the line are drawn.
+ * @param color The color of the line.
+ *
+ * @see pntr_line_join
+ * @see pntr_line_cap
+ */
+PNTR_API void pntr_draw_polyline_thick_ex(pntr_image* dst, pntr_vector* points, int numPoints, int thickness, pntr_line_join join, pntr_line_cap cap, pntr_color color) {
+    if (color.rgba.a == 0 || dst == NULL || numPoints <= 0 || points == NULL || thickness < 1) {
+        return;
+    }
+
+    if (thickness == 1) {
+        pntr_draw_polyline(dst, points, numPoints, color);
+        return;
+    }
+
+    _pntr_draw_stroke_vectors(dst, points, numPoints, false, thickness, join, cap, color);
+}
+
+/**
+ * Draw a horizontal line at the given x, y coordinates.
+ *
+ * @param dst The destination image.
+ * @param posX The X position.
+ * @param posY The Y position.
+ * @param width How long the line should be.
+ * @param color The color of the line.
+ *
+ */
+PNTR_API void pntr_draw_line_horizontal(pntr_image* dst, int posX, int posY, int width, pntr_color color) {
+    if (width < 0) {
+        posX += width;
+        width = -width;
+    }
+    if (color.rgba.a == 0 || dst == NULL || posY < dst->clip.y || posY >= dst->clip.y + dst->clip.height || posX >= dst->clip.x + dst->clip.width || posX + width < dst->clip.x) {
+        return;
+    }
+
+    if (posX < dst->clip.x) {
+        width += posX - dst->clip.x;
+        posX = dst->clip.x;
+    }
+    if (posX + width >= dst->clip.x + dst->clip.width) {
+        width = dst->clip.x + dst->clip.width - posX;
+    }
+
+    _pntr_fill_span(dst, posX, posY, width, color);
+}
+
+PNTR_API void pntr_draw_line_horizontal_thick(pntr_image* dst, int posX, int posY, int width, int thickness, pntr_color color) {
+    if (thickness == 0) {
+        return;
+    }
+    if (thickness == 1) {
+        pntr_draw_line_horizontal(dst, posX, posY, width, color);
+        return;
+    }
+
+    pntr_draw_line_thick_cap(dst, posX, posY, posX + width, posY, thickness, PNTR_LINE_CAP_ROUND, color);
+}
+
+/**
+ * Draw a vertical line at the given x, y coordinates.
+ *
+ * @param dst The destination image.
+ * @param posX The X position.
+ * @param posY The Y position.
+ * @param height How tall the line should be.
+ * @param color The color of the line.
+ *
+ */
+PNTR_API void pntr_draw_line_vertical(pntr_image* dst, int posX, int posY, int height, pntr_color color) {
+    if (height < 0) {
+        posY += height;
+        height = -height;
+    }
+    if (color.rgba.a == 0 || dst == NULL || posX < dst->clip.x || posX >= dst->clip.x + dst->clip.width || posY >= dst->clip.y + dst->clip.height || posY + height < dst->clip.y) {
+        return;
+    }
+
+    if (posY < dst->clip.y) {
+        height += posY - dst->clip.y;
+        posY = dst->clip.y;
+    }
+    if (posY + height >= dst->clip.y + dst->clip.height) {
+        height = dst->clip.y + dst->clip.height - posY;
+    }
+
+    _pntr_image_modified(dst);
+    if (color.rgba.a == 255) {
+        for (int y = 0; y < height; y++) {
+            PNTR_PIXEL(dst, posX, posY + y) = color;
+        }
+    }
+    else {
+        _pntr_blend_color_run(dst, &PNTR_PIXEL(dst, posX, posY), height, dst->pitch >> 2, color);
+    }
+}
+
+PNTR_API void pntr_draw_line_vertical_thick(pntr_image* dst, int posX, int posY, int height, int thickness, pntr_color color) {
+    if (thickness == 0) {
+        return;
+    }
+    if (thickness == 1) {
+        pntr_draw_line_vertical(dst, posX, posY, height, color);
+        return;
+    }
+    pntr_draw_line_thick_cap(dst, posX, posY, posX, posY + height, thickness, PNTR_LINE_CAP_ROUND, color);
+}
+
+/**
+ * Draws a rectangle using a rectangle.
+ *
+ * @param dst Where to draw the rectangle.
+ * @param rec The rectangle of which to draw.
+ * @param color The color of the lines for the rectangle.
+ */
+PNTR_API void pntr_draw_rectangle_rec(pntr_image* dst, pntr_rectangle rec, pntr_color color) {
+    pntr_draw_rectangle(dst, rec.x, rec.y, rec.width, rec.height, color);
+}
+
+/**
+ * Draw a rectangle on the given image.
+ *
+ * @param dst The destination image.
+ * @param posX The X position.
+ * @param posY The Y position.
+ * @param width How wide the rectangle should be.
+ * @param height How tall the rectangle should be.
+ * @param color The color of the line.
+ *
+ * @see pntr_draw_rectangle_rec()
+ * @see pntr_draw_rectangle_fill()
+ */
+PNTR_API void pntr_draw_rectangle(pntr_image* dst, int posX, int posY, int width, int height, pntr_color color) {
+    if (color.rgba.a == 0 || dst == NULL || width <= 0 || height <= 0) {
+        return;
+    }
+
+    pntr_draw_line_horizontal(dst, posX, posY, width, color);
+    pntr_draw_line_horizontal(dst, posX, posY + height - 1, width, color);
+    pntr_draw_line_vertical(dst, posX, posY + 1, height - 2, color);
+    pntr_draw_line_vertical(dst, posX + width - 1, posY + 1, height - 2, color);
+}
+
+PNTR_API void pntr_draw_rectangle_thick(pntr_image* dst, int posX, int posY, int width, int height, int thickness, pntr_color color) {
+    for (int i = 0; i < thickness; i++) {
+        pntr_draw_rectangle(dst, posX + i, posY + i, width - i * 2, height - i * 2, color);
+    }
+}
+
+PNTR_API void pntr_draw_rectangle_thick_rec(pntr_image* dst, pntr_rectangle rect, int thickness, pntr_color color) {
+    pntr_draw_rectangle_thick(dst, rect.x, rect.y, rect.width, rect.height, thickness, color);
+}
+
+/**
+ * Draws a filled rectangle on the given image.
+ *
+ * @param dst The destination image.
+ * @param posX The X position.
+ * @param posY The Y position.
+ * @param width How wide the rectangle should be.
+ * @param height How tall the rectangle should be.
+ * @param color The color of the rectangle.
+ *
+ * @see pntr_draw_rectangle()
+ */
+PNTR_API void pntr_draw_rectangle_fill(pntr_image* dst, int posX, int posY, int width, int height, pntr_color color) {
+    pntr_draw_rectangle_fill_rec(dst, PNTR_CLITERAL(pntr_rectangle) { posX, posY, width, height }, color);
+}
+
+/**
+ * Draws a filled rectangle on the given image, using a rectangle as input data.
+ *
+ * @param dst The destination image.
+ * @param rect The rectangle of which to draw.
+ * @param color The color of the rectangle.
+ *
+ * @see pntr_draw_rectangle_fill()
+ */
+PNTR_API void pntr_draw_rectangle_fill_rec(pntr_image* dst, pntr_rectangle rect, pntr_color color) {
+    if (color.rgba.a == 0 || dst == NULL) {
+        return;
+    }
+
+    if (!_pntr_rectangle_intersect(rect.x, rect.y, rect.width, rect.height, dst->clip.x, dst->clip.y, dst->clip.width, dst->clip.height, &rect)) {
+        return;
+    }
+
+    // When the color is solid, we can do some performance improvements.
+    if (color.rgba.a == 255) {
+        pntr_put_horizontal_line_unsafe(dst, rect.x, rect.y, rect.width, color);
+
+        pntr_color* srcPixel = &PNTR_PIXEL(dst, rect.x, rect.y);
+        for (int y = rect.y + 1; y < rect.y + rect.height; y++) {
+            PNTR_MEMCPY(&PNTR_PIXEL(dst, rect.x, y), srcPixel, (size_t)rect.width * sizeof(pntr_color));
+        }
+    }
+    else {
+        _pntr_image_modified(dst);
+        for (int y = 0; y < rect.height; y++) {
+            _pntr_blend_color_run(dst, &PNTR_PIXEL(dst, rect.x, rect.y + y), rect.width, 1, color);
+        }
+    }
+}
+
+/**
+ * Blends a color onto a pixel, converting it to premultiplied alpha when the image uses it.
+ *
+ * @internal
+ */
+static void _pntr_blend_pixel(pntr_image* dst, pntr_color* pixel, pntr_color color) {
+    if (dst->premultiplied) {
+        pntr_blend_color_premultiplied(pixel, pntr_color_alpha_premultiply(color));
+    }
+    else {
+        pntr_blend_color(pixel, color);
+    }
+}
+
+PNTR_API void pntr_draw_rectangle_gradient_rec(pntr_image* dst, pntr_rectangle rect, pntr_color topLeft, pntr_color topRight, pntr_color bottomLeft, pntr_color bottomRight) {
+    if (dst == NULL) {
+        return;
+    }
+
+    pntr_rectangle dstRect;
+    if (!_pntr_rectangle_intersect(rect.x, rect.y, rect.width, rect.height, dst->clip.x, dst->clip.y, dst->clip.width, dst->clip.height, &dstRect)) {
+        return;
+    }
+
+    // Protect against division by zero.
+    if (rect.width == 0 || rect.height == 0) {
+        return;
+    }
+
+    _pntr_image_modified(dst);
+    bool opaque = (topLeft.rgba.a & topRight.rgba.a & bottomLeft.rgba.a & bottomRight.rgba.a) == 255;
+    int64_t corners[4][4] = {
+        {topLeft.rgba.r, topLeft.rgba.g, topLeft.rgba.b, topLeft.rgba.a},
+        {topRight.rgba.r, topRight.rgba.g, topRight.rgba.b, topRight.rgba.a},
+        {bottomLeft.rgba.r, bottomLeft.rgba.g, bottomLeft.rgba.b, bottomLeft.rgba.a},
+        {bottomRight.rgba.r, bottomRight.rgba.g, bottomRight.rgba.b, bottomRight.rgba.a}
+    };
+
+    // Walk the rows, stepping each channel across the row in 16.16 fixed point rather than interpolating every pixel.
+    int64_t startX = (int64_t)(dstRect.x - rect.x);
+    for (int y = dstRect.y; y < dstRect.y + dstRect.height; y++) {
+        int64_t factorY = ((int64_t)(y - rect.y) << 16) / rect.height;
+        int64_t value[4];
+        int64_t step[4];
+        for (int i = 0; i < 4; i++) {
+            int64_t left = (corners[0][i] << 16) + (corners[2][i] - corners[0][i]) * factorY;
+            int64_t right = (corners[1][i] << 16) + (corners[3][i] - corners[1][i]) * factorY;
+            value[i] = left + (right - left) * startX / rect.width;
+            step[i] = (right - left) / rect.width;
+        }
+
+        pntr_color* pixel = &PNTR_PIXEL(dst, dstRect.x, y);
+        for (int x = 0; x < dstRect.width; x++) {
+            pntr_color color = PNTR_NEW_COLOR(
+                (unsigned char)(value[0] >> 16),
+                (unsigned char)(value[1] >> 16),
+                (unsigned char)(value[2] >> 16),
+                (unsigned char)(value[3] >> 16)
+            );
+            if (opaque) {
+                pixel[x] = color;
+            }
+            else {
+                _pntr_blend_pixel(dst, &pixel[x], color);
+            }
+            value[0] += step[0];
+            value[1] += step[1];
+            value[2] += step[2];
+            value[3] += step[3];
+        }
+    }
+}
+
+PNTR_API void pntr_draw_rectangle_gradient(pntr_image* dst, int x, int y, int width, int height, pntr_color topLeft, pntr_color topRight, pntr_color bottomLeft, pntr_color bottomRight) {
+    pntr_draw_rectangle_gradient_rec(dst, PNTR_CLITERAL(pntr_rectangle) {x, y, width, height}, topLeft, topRight, bottomLeft, bottomRight);
+}
+
+/**
+ * The position of the given color stop along the gradient, from 0.0f to 1.0f.
+ *
+ * @internal
+ */
+static float _pntr_gradient_stop(float* stops, int index, int count) {
+    if (stops != NULL) {
+        return stops[index];
+    }
+    return (count > 1) ? (float)index / (float)(count - 1) : 0.0f;
+}
+
+/**
+ * Allocates a gradient, and interpolates its color stops into its ramp.
+ *
+ * @internal
+ */
+static pntr_gradient* _pntr_new_gradient(pntr_gradient_type type, pntr_color* colors, float* stops, int count) {
+    if (colors == NULL || count <= 0) {
+        return (pntr_gradient*)pntr_set_error(PNTR_ERROR_INVALID_ARGS);
+    }
+
+    pntr_gradient* gradient = (pntr_gradient*)PNTR_MALLOC(sizeof(pntr_gradient));
+    if (gradient == NULL) {
+        return (pntr_gradient*)pntr_set_error(PNTR_ERROR_NO_MEMORY);
+    }
+
+    gradient->type = type;
+    gradient->x = gradient->y = 0.0f;
+    gradient->endX = gradient->endY = 0.0f;
+    gradient->radius = 0.0f;
+    gradient->angle = 0.0f;
+    gradient->opaque = true;
+
+    float first = _pntr_gradient_stop(stops, 0, count);
+    float last = _pntr_gradient_stop(stops, count - 1, count);
+    int stop = 0;
+    for (int i = 0; i < 256; i++) {
+        float position = (float)i / 255.0f;
+        pntr_color color;
+        if (position <= first) {
+            color = colors[0];
+        }
+        else if (position >= last) {
+            color = colors[count - 1];
+        }
+        else {
+            while (stop < count - 2 && _pntr_gradient_stop(stops, stop + 1, count) < position) {
+                stop++;
+            }
+
+            float start = _pntr_gradient_stop(stops, stop, count);
+            float end = _pntr_gradient_stop(stops, stop + 1, count);
+            float amount = (end > start) ? (position - start) / (end - start) : 1.0f;
+            pntr_color from = colors[stop];
+            pntr_color to = colors[stop + 1];
+            color = PNTR_NEW_COLOR(
+                (unsigned char)((float)from.rgba.r + (float)(to.rgba.r - from.rgba.r) * amount + 0.5f),
+                (unsigned char)((float)from.rgba.g + (float)(to.rgba.g - from.rgba.g) * amount + 0.5f),
+                (unsigned char)((float)from.rgba.b + (float)(to.rgba.b - from.rgba.b) * amount + 0.5f),
+                (unsigned char)((float)from.rgba.a + (float)(to.rgba.a - from.rgba.a) * amount + 0.5f)
+            );
+        }
+
+        gradient->ramp[i] = color;
+        gradient->premultipliedRamp[i] = pntr_color_alpha_premultiply(color);
+        if (color.rgba.a != 255) {
+            gradient->opaque = false;
+        }
+    }
+
+    return gradient;
+}
+
+/**
+ * Creates a gradient that changes color along the line from the start point to the end point.
+ *
+ * Pixels before the start point take the first color, and those past the end point take the last one.
+ *
+ * @code
+ * pntr_color colors[] = {PNTR_RED, PNTR_YELLOW, PNTR_BLUE};
+ * pntr_gradient* gradient = pntr_new_gradient_linear(0, 0, 100, 0, colors, NULL, 3);
+ * pntr_draw_rectangle_fill_gradient(image, 0, 0, 100, 50, gradient);
+ * pntr_unload_gradient(gradient);
+ * @endcode
+ *
+ * @param startX The X coordinate where the gradient starts.
+ * @param startY The Y coordinate where the gradient starts.
+ * @param endX The X coordinate where the gradient ends.
+ * @param endY The Y coordinate where the gradient ends.
+ * @param colors The colors of the gradient stops.
+ * @param stops The positions of the stops, from 0.0f to 1.0f in ascending order. NULL to space them evenly.
+ * @param count The number of colors, and of stops.
+ *
+ * @return The new gradient, which must be unloaded with pntr_unload_gradient(). NULL on failure.
+ *
+ * @see pntr_draw_rectangle_fill_gradient()
+ * @see pntr_draw_polygon_fill_gradient()
+ */
+PNTR_API pntr_gradient* pntr_new_gradient_linear(float startX, float startY, float endX, float endY, pntr_color* colors, float* stops, int count) {
+    pntr_gradient* gradient = _pntr_new_gradient(PNTR_GRADIENT_LINEAR, colors, stops, count);
+    if (gradient == NULL) {
+        return NULL;
+    }
+
+    gradient->x = startX;
+    gradient->y = startY;
+    gradient->endX = endX;
+    gradient->endY = endY;
+
+    return gradient;
+}
+
+/**
+ * Creates a gradient that changes color with the distance from its center, out to its radius.
+ *
+ * @param centerX The X coordinate of the center.
+ * @param centerY The Y coordinate of the center.
+ * @param radius The distance from the center at which the last color is reached.
+ * @param colors The colors of the gradient stops.
+ * @param stops The positions of the stops, from 0.0f to 1.0f in ascending order. NULL to space them evenly.
+ * @param count The number of colors, and of stops.
+ *
+ * @return The new gradient, which must be unloaded with pntr_unload_gradient(). NULL on failure.
+ *
+ * @see pntr_new_gradient_linear()
+ */
+PNTR_API pntr_gradient* pntr_new_gradient_radial(float centerX, float centerY, float radius, pntr_color* colors, float* stops, int count) {
+    pntr_gradient* gradient = _pntr_new_gradient(PNTR_GRADIENT_RADIAL, colors, stops, count);
+    if (gradient == NULL) {
+        return NULL;
+    }
+
+    gradient->x = centerX;
+    gradient->y = centerY;
+    gradient->radius = radius;
+
+    return gradient;
+}
+
+/**
+ * Creates a gradient that changes color with the angle around its center, sweeping clockwise once from its start
+ * angle.
+ *
+ * @param centerX The X coordinate of the center.
+ * @param centerY The Y coordinate of the center.
+ * @param angle The angle of the first color, in degrees. 0 points right, and 90 points down.
+ * @param colors The colors of the gradient stops.
+ * @param stops The positions of the stops, from 0.0f to 1.0f in ascending order. NULL to space them evenly.
+ * @param count The number of colors, and of stops.
+ *
+ * @return The new gradient, which must be unloaded with pntr_unload_gradient(). NULL on failure.
+ *
+ * @see pntr_new_gradient_linear()
+ */
+PNTR_API pntr_gradient* pntr_new_gradient_conic(float centerX, float centerY, float angle, pntr_color* colors, float* stops, int count) {
+    pntr_gradient* gradient = _pntr_new_gradient(PNTR_GRADIENT_CONIC, colors, stops, count);
+    if (gradient == NULL) {
+        return NULL;
+    }
+
+    gradient->x = centerX;
+    gradient->y = centerY;
+    gradient->angle = angle;
+
+    return gradient;
+}
+
+/**
+ * Unloads the given gradient from memory.
+ *
+ * @param gradient The gradient to unload.
+ *
+ * @see pntr_new_gradient_linear()
+ */
+PNTR_API void pntr_unload_gradient(pntr_gradient* gradient) {
+    if (gradient == NULL) {
+        return;
+    }
+
+    PNTR_FREE(gradient);
+}
+
+/**
+ * The most pixels that a gradient span computes the ramp indices of at once.
+ *
+ * @internal
+ */
+#define _PNTR_GRADIENT_CHUNK 256
+
+/**
+ * Approximates the angle of the given direction in turns, from 0.0f up to 1.0f, clockwise from the right.
+ *
+ * Uses a polynomial approximation of the arctangent, which is within a tenth of a degree.
+ *
+ * @internal
+ */
+static float _pntr_gradient_turns(float x, float y) {
+    float absX = PNTR_FABSF(x);
+    float absY = PNTR_FABSF(y);
+    if (absX == 0.0f && absY == 0.0f) {
+        return 0.0f;
+    }
+
+    float ratio = PNTR_MIN(absX, absY) / PNTR_MAX(absX, absY);
+    float turns = ratio * (0.125f + 0.0434f * (1.0f - ratio));
+    if (absY > absX) {
+        turns = 0.25f - turns;
+    }
+    if (x < 0.0f) {
+        turns = 0.5f - turns;
+    }
+    if (y < 0.0f) {
+        turns = 1.0f - turns;
+    }
+    return turns;
+}
+
+/**
+ * Finds the ramp index of each pixel along a row, sampling the gradient at the center of each pixel.
+ *
+ * @internal
+ */
+static void _pntr_gradient_indices(pntr_gradient* gradient, int posX, int posY, int count, unsigned char* indices) {
+    float x = (float)posX + 0.5f - gradient->x;
+    float y = (float)posY + 0.5f - gradient->y;
+
+    switch (gradient->type) {
+        case PNTR_GRADIENT_LINEAR: {
+            float dx = gradient->endX - gradient->x;
+            float dy = gradient->endY - gradient->y;
+            float length = dx * dx + dy * dy;
+            if (length <= 0.0f) {
+                PNTR_MEMSET(indices, 255, (size_t)count);
+                return;
+            }
+
+            // The position along the gradient changes by the same amount each pixel, so step it in 16.16 fixed point.
+            float limit = (float)(1 << 30);
+            float start = (x * dx + y * dy) / length * 255.0f;
+            float delta = dx / length * 255.0f;
+            int64_t value = (int64_t)(PNTR_MAX(-limit, PNTR_MIN(limit, start)) * 65536.0f) + 32768;
+            int64_t step = (int64_t)(PNTR_MAX(-limit, PNTR_MIN(limit, delta)) * 65536.0f);
+            for (int i = 0; i < count; i++, value += step) {
+                indices[i] = (value <= 0) ? 0 : (value >= ((int64_t)255 << 16)) ? 255 : (unsigned char)(value >> 16);
+            }
+        }
+        break;
+
+        case PNTR_GRADIENT_RADIAL: {
+            if (gradient->radius <= 0.0f) {
+                PNTR_MEMSET(indices, 255, (size_t)count);
+                return;
+            }
+
+            // The distance changes by at most a pixel each step, so one step of Newton's method from the previous
+            // distance is enough away from the center.
+            float scale = 255.0f / gradient->radius;
+            float squared = x * x + y * y;
+            float distance = PNTR_SQRTF(squared);
+            for (int i = 0; i < count; i++) {
+                if (i > 0) {
+                    squared += 2.0f * x + 1.0f;
+                    x += 1.0f;
+                    distance = (squared < 256.0f) ? PNTR_SQRTF(squared) : 0.5f * (distance + squared / distance);
+                }
+                float index = distance * scale + 0.5f;
+                indices[i] = (index >= 255.0f) ? 255 : (unsigned char)index;
+            }
+        }
+        break;
+
+        case PNTR_GRADIENT_CONIC: {
+            float start = gradient->angle / 360.0f;
+            start -= -PNTR_CEILF(-start);
+            for (int i = 0; i < count; i++, x += 1.0f) {
+                float turns = _pntr_gradient_turns(x, y) - start;
+                if (turns < 0.0f) {
+                    turns += 1.0f;
+                }
+                float index = turns * 255.0f + 0.5f;
+                indices[i] = (index >= 255.0f) ? 255 : (unsigned char)index;
+            }
+        }
+        break;
+    }
+}
+
+/**
+ * Fills a span of pixels with a gradient. The span must already be clipped.
+ *
+ * @internal
+ */
+static void _pntr_gradient_span(pntr_image* dst, pntr_gradient* gradient, int posX, int posY, int width) {
+    unsigned char indices[_PNTR_GRADIENT_CHUNK];
+    pntr_color* pixel = &PNTR_PIXEL(dst, posX, posY);
+    _pntr_image_modified(dst);
+
+    while (width > 0) {
+        int count = PNTR_MIN(width, _PNTR_GRADIENT_CHUNK);
+        _pntr_gradient_indices(gradient, posX, posY, count, indices);
+
+        if (gradient->opaque) {
+            for (int i = 0; i < count; i++) {
+                pixel[i] = gradient->ramp[indices[i]];
+            }
+        }
+        else if (dst->premultiplied) {
+            for (int i = 0; i < count; i++) {
+                pntr_blend_color_premultiplied(&pixel[i], gradient->premultipliedRamp[indices[i]]);
+            }
+        }
+        else {
+            for (int i = 0; i < count; i++) {
+                pntr_blend_color(&pixel[i], gradient->ramp[indices[i]]);
+            }
+        }
+
+        pixel += count;
+        posX += count;
+        width -= count;
+    }
+}
+
+/**
+ * Draws a rectangle filled with the given gradient.
+ *
+ * @param dst The image to draw the rectangle onto.
+ * @param x The x position of the rectangle.
+ * @param y The y position of the rectangle.
+ * @param width The width of the rectangle.
+ * @param height The height of the rectangle.
+ * @param gradient The gradient to fill the rectangle with, in the coordinates of the image.
+ *
+ * @see pntr_new_gradient_linear()
+ * @see pntr_draw_polygon_fill_gradient()
+ */
+PNTR_API void pntr_draw_rectangle_fill_gradient(pntr_image* dst, int x, int y, int width, int height, pntr_gradient* gradient) {
+    if (dst == NULL || gradient == NULL) {
+        return;
+    }
+
+    pntr_rectangle rect;
+    if (!_pntr_rectangle_intersect(x, y, width, height, dst->clip.x, dst->clip.y, dst->clip.width, dst->clip.height, &rect)) {
+        return;
+    }
+
+    for (int row = rect.y; row < rect.y + rect.height; row++) {
+        _pntr_gradient_span(dst, gradient, rect.x, row, rect.width);
+    }
+}
+
+/**
+ * Draws a circle from the given center, with the given radius.
+ *
+ * This uses the Midpoint Circle Algorithm:
+ *   https://en.wikipedia.org/wiki/Midpoint_circle_algorithm
+ *
+ * @param dst The image to draw the circle onto.
+ * @param centerX The center of the circle at the X coordinate.
+ * @param centerY The center of the circle at the Y coordinate.
+ * @param radius The radius of the circle.
+ * @param color The desired color of the circle.
+ *
+ * @see pntr_draw_circle_fill()
+ * @see pntr_draw_circle_aa()
+ */
+PNTR_API void pntr_draw_circle(pntr_image* dst, int centerX, int centerY, int radius, pntr_color color) {
+    if (dst == NULL || color.rgba.a == 0) {
+        return;
+    }
+
+    if (radius == 0) {
+        return;
+    }
+
+    if (radius < 0) {
+        radius = -radius;
+    }
+
+    if (radius == 1) {
+        pntr_draw_point(dst, centerX, centerY, color);
+        return;
+    }
+
+    // Check that the circle is in the bounds.
+    if (centerX + radius < dst->clip.x || centerY + radius < dst->clip.y || centerX - radius > dst->clip.x + dst->clip.width || centerY - radius > dst->clip.y + dst->clip.height) {
+        return;
+    }
+
+    int largestX = radius;
+    int r2 = radius * radius;
+    for (int y = 0; y <= radius; ++y) {
+        int y2 = y * y;
+        for (int x = largestX; x >= 0; --x) {
+            if (x * x + y2 <= r2) {
+                pntr_draw_point(dst, centerX + x, centerY + y, color);
+                pntr_draw_point(dst, centerX - x, centerY + y, color);
+                pntr_draw_point(dst, centerX + x, centerY - y, color);
+                pntr_draw_point(dst, centerX - x, centerY - y, color);
+                pntr_draw_point(dst, centerX + y, centerY + x, color);
+                pntr_draw_point(dst, centerX - y, centerY + x, color);
+                pntr_draw_point(dst, centerX + y, centerY - x, color);
+                pntr_draw_point(dst, centerX - y, centerY - x, color);
+                largestX = x;
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * Draws a filled circle on the given image.
+ *
+ * @param dst The image to draw the filled circle onto.
+ * @param centerX The center of the circle at the X coordinate.
+ * @param centerY The center of the circle at the Y coordinate.
+ * @param radius The radius of the circle.
+ * @param color The desired fill color of the circle.
+ *
+ * @see pntr_draw_circle()
+ * @see pntr_draw_circle_fill_aa()
+ */
+PNTR_API void pntr_draw_circle_fill(pntr_image* dst, int centerX, int centerY, int radius, pntr_color color) {
+    if (radius == 0) {
+        return;
+    }
+
+    if (radius < 0) {
+        radius = -radius;
+    }
+
+    if (radius == 1) {
+        pntr_draw_point(dst, centerX, centerY, color);
+        return;
+    }
+
+    if (dst == NULL || color.rgba.a == 0 || radius == 0 || centerX + radius < dst->clip.x || centerX - radius >= dst->clip.x + dst->clip.width || centerY + radius < dst->clip.y || centerY - radius >= dst->clip.y + dst->clip.height) {
+        return;
+    }
+
+    // Rows are offsets from the center, clipped once.
+    int top = dst->clip.y - centerY;
+    int bottom = dst->clip.y + dst->clip.height - 1 - centerY;
+
+    // Step the edge inwards as the rows move away from the center, keeping error at radius^2 - x^2 - y^2.
+    int x = radius;
+    int error = 0;
+    for (int y = 0; y <= radius; y++) {
+        while (error < 0) {
+            error += 2 * x - 1;
+            x--;
+        }
+        if (x == 0 || (y > bottom && -y < top)) {
+            break;
+        }
+
+        if (y >= top && y <= bottom) {
+            _pntr_fill_row(dst, centerX - x, centerX + x, centerY + y, color);
+        }
+        if (y > 0 && -y >= top && -y <= bottom) {
+            _pntr_fill_row(dst, centerX - x, centerX + x, centerY - y, color);
+        }
+        error -= 2 * y + 1;
+    }
+}
+
+/**
+ * A box with elliptical corners, which makes a rounded rectangle, an ellipse or a circle.
+ *
+ * A pixel is inside of the box when its center is. Pixels with their center right on the edge are left out on every
+ * side, so that shapes stay symmetric.
+ *
+ * @see _pntr_draw_ring()
+ * @internal
+ */
+typedef struct _pntr_rounded_box {
+    float left; /** The left of the box. */
+    float top; /** The top of the box. */
+    float right; /** The right of the box. */
+    float bottom; /** The bottom of the box. */
+    float radiusX[4]; /** The horizontal radius of the top left, top right, bottom left and bottom right corners. */
+    float radiusY[4]; /** The vertical radius of the top left, top right, bottom left and bottom right corners. */
+} _pntr_rounded_box;
+
+/**
+ * Sets up a box around an ellipse, centered on the middle of the given pixel.
+ *
+ * @internal
+ */
+static void _pntr_rounded_box_ellipse(_pntr_rounded_box* box, int centerX, int centerY, float radiusX, float radiusY) {
+    box->left = (float)centerX + 0.5f - radiusX;
+    box->top = (float)centerY + 0.5f - radiusY;
+    box->right = (float)centerX + 0.5f + radiusX;
+    box->bottom = (float)centerY + 0.5f + radiusY;
+    for (int i = 0; i < 4; i++) {
+        box->radiusX[i] = radiusX;
+        box->radiusY[i] = radiusY;
+    }
+}
+
+/**
+ * Finds which pixels of a row are inside of the box.
+ *
+ * @param y The row.
+ * @param left Where to store the first pixel inside of the box.
+ * @param right Where to store the pixel after the last one inside of the box.
+ *
+ * @return True when there are pixels inside of the box on the row, false otherwise.
+ *
+ * @internal
+ */
+static bool _pntr_rounded_box_span(const _pntr_rounded_box* box, int y, int* left, int* right) {
+    float center = (float)y + 0.5f;
+    if (center <= box->top || center >= box->bottom) {
+        return false;
+    }
+
+    float boxLeft = box->left;
+    float boxRight = box->right;
+    for (int corner = 0; corner < 4; corner++) {
+        float radiusX = box->radiusX[corner];
+        float radiusY = box->radiusY[corner];
+        if (radiusX <= 0.0f || radiusY <= 0.0f) {
+            continue;
+        }
+
+        // How far the row reaches into the corner, relative to its radius.
+        float distance = (corner < 2) ? (box->top + radiusY - center) : (center - box->bottom + radiusY);
+        if (distance <= 0.0f) {
+            continue;
+        }
+        distance /= radiusY;
+        float inset = radiusX * (1.0f - PNTR_SQRTF(PNTR_MAX(0.0f, 1.0f - distance * distance)));
+        if (corner % 2 == 0) {
+            boxLeft = PNTR_MAX(boxLeft, box->left + inset);
+        }
+        else {
+            boxRight = PNTR_MIN(boxRight, box->right - inset);
+        }
+    }
+
+    *left = 1 - (int)PNTR_CEILF(0.5f - boxLeft);
+    *right = (int)PNTR_CEILF(boxRight - 0.5f);
+    return *left < *right;
+}
+
+/**
+ * Fills the pixels inside of one box, and outside of another one within it, with one or two spans per row.
+ *
+ * When filling a whole box with a solid color, rows that match the one above are copied from it.
+ *
+ * @param inner The box to leave out, or NULL to fill the whole outer box.
+ *
+ * @internal
+ */
+static void _pntr_draw_ring(pntr_image* dst, const _pntr_rounded_box* outer, const _pntr_rounded_box* inner, pntr_color color) {
+    if (dst == NULL || color.rgba.a == 0) {
+        return;
+    }
+
+    int top = PNTR_MAX(1 - (int)PNTR_CEILF(0.5f - outer->top), dst->clip.y);
+    int bottom = PNTR_MIN((int)PNTR_CEILF(outer->bottom - 0.5f), dst->clip.y + dst->clip.height);
+    int previousY = top - 1;
+    int previousLeft = 0;
+    int previousRight = 0;
+    for (int y = top; y < bottom; y++) {
+        int left;
+        int right;
+        if (!_pntr_rounded_box_span(outer, y, &left, &right)) {
+            continue;
+        }
+
+        int innerLeft;
+        int innerRight;
+        if (inner != NULL && _pntr_rounded_box_span(inner, y, &innerLeft, &innerRight)) {
+            _pntr_fill_row(dst, left, innerLeft, y, color);
+            _pntr_fill_row(dst, innerRight, right, y, color);
+        }
+        else if (inner == NULL && color.rgba.a == 255) {
+            left = PNTR_MAX(left, dst->clip.x);
+            right = PNTR_MIN(right, dst->clip.x + dst->clip.width);
+            if (left >= right) {
+                continue;
+            }
+
+            if (previousY == y - 1 && previousLeft == left && previousRight == right) {
+                PNTR_MEMCPY(&PNTR_PIXEL(dst, left, y), &PNTR_PIXEL(dst, left, previousY), (size_t)(right - left) * sizeof(pntr_color));
+            }
+            else {
+                pntr_put_horizontal_line_unsafe(dst, left, y, right - left, color);
+            }
+            previousY = y;
+            previousLeft = left;
+            previousRight = right;
+        }
+        else {
+            _pntr_fill_row(dst, left, right, y, color);
+        }
+    }
+}
+
+/**
+ * Draws a circle from the given center, with the given radius & line-thickness.
+ *
+ * The line is centered on the radius, and each row of it is filled with at most two spans.
+ *
+ * @param dst The image to draw the circle onto.
+ * @param centerX The center of the circle at the X coordinate.
+ * @param centerY The center of the circle at the Y coordinate.
+ * @param radius The radius of the circle.
+ * @param thickness The thickness of the line.
+ * @param color The desired color of the circle.
+ *
+ */
+PNTR_API void pntr_draw_circle_thick(pntr_image* dst, int centerX, int centerY, int radius, int thickness, pntr_color color) {
+    if (thickness < 1) {
+        return;
+    }
+    if (thickness == 1) {
+        pntr_draw_circle(dst, centerX, centerY, radius, color);
+        return;
+    }
+
+    pntr_draw_ellipse_thick(dst, centerX, centerY, radius, radius, thickness, color);
+}
+
+/**
+ * Draws an ellipse on the given image.
+ *
+ * @param dst The image to draw the ellipse onto.
+ * @param centerX The center of the ellipse at the X coordinate.
+ * @param centerY The center of the ellipse at the Y coordinate.
+ * @param radiusX The  horizontal radius of the ellipse.
+ * @param radiusY The vertical radius of the ellipse.
+ * @param color The desired color of the ellipse.
+ *
+ * @see pntr_draw_ellipse_fill()
+ * @see pntr_draw_ellipse_aa()
+ */
+PNTR_API void pntr_draw_ellipse(pntr_image* dst, int centerX, int centerY, int radiusX, int radiusY, pntr_color color) {
+    if (dst == NULL || radiusX == 0 || radiusY == 0 || color.rgba.a == 0) {
+        return;
+    }
+
+    int x = 0;
+    if (radiusX < 0) {
+        radiusX = -radiusX;
+    }
+    if (radiusY < 0) {
+        radiusY = -radiusY;
+    }
+
+    int radiusXSquared = radiusX * radiusX;
+    int radiusXSquared2 = radiusXSquared * 2;
+    int radiusYSquared = radiusY * radiusY;
+    int radiusYSquared2 = radiusYSquared * 2;
+    int error = radiusYSquared - radiusXSquared * radiusY;
+
+    while (radiusY >= 0) {
+        pntr_draw_point(dst, centerX + x, centerY + radiusY, color);
+        pntr_draw_point(dst, centerX - x, centerY + radiusY, color);
+        pntr_draw_point(dst, centerX - x, centerY - radiusY, color);
+        pntr_draw_point(dst, centerX + x, centerY - radiusY, color);
+
+        if (error <= 0) {
+            x++;
+            error += radiusYSquared2 * x + radiusYSquared;
+        }
+        if (error > 0) {
+            radiusY--;
+            error -= radiusXSquared2 * radiusY - radiusXSquared;
+        }
+    }
+}
+
+/**
+ * Draws a filled ellipse on the given image.
+ *
+ * @param dst The image to draw the filled ellipse onto.
+ * @param centerX The center of the ellipse at the X coordinate.
+ * @param centerY The center of the ellipse at the Y coordinate.
+ * @param radiusX The  horizontal radius of the ellipse.
+ * @param radiusY The vertical radius of the ellipse.
+ * @param color The desired fill color of the ellipse.
+ *
+ * @see pntr_draw_ellipse()
+ * @see pntr_draw_ellipse_fill_aa()
+ */
+PNTR_API void pntr_draw_ellipse_fill(pntr_image* dst, int centerX, int centerY, int radiusX, int radiusY, pntr_color color) {
+    if (radiusX < 0) {
+        radiusX = -radiusX;
+    }
+    if (radiusY < 0) {
+        radiusY = -radiusY;
+    }
+
+    if (dst == NULL || radiusX == 0 || radiusY == 0 || color.rgba.a == 0 || centerX + radiusX < dst->clip.x || centerX - radiusX > dst->clip.x + dst->clip.width || centerY + radiusY < dst->clip.y || centerY - radiusY > dst->clip.y + dst->clip.height) {
+        return;
+    }
+
+    int x = 0;
+    int radiusXSquared = radiusX * radiusX;
+    int radiusXSquared2 = radiusXSquared * 2;
+    int radiusYSquared = radiusY * radiusY;
+    int radiusYSquared2 = radiusYSquared * 2;
+    int error = radiusYSquared - radiusXSquared * radiusY;
+
+    int top = dst->clip.y;
+    int bottom = dst->clip.y + dst->clip.height - 1;
+
+    // The midpoint steps can widen a row several times, so each row is only filled once it is finished.
+    while (radiusY >= 0) {
+        int rowX = x;
+        if (error <= 0) {
+            x++;
+            error += radiusYSquared2 * x + radiusYSquared;
+        }
+        if (error > 0) {
+            if (centerY + radiusY >= top && centerY + radiusY <= bottom) {
+                _pntr_fill_row(dst, centerX - rowX, centerX + rowX, centerY + radiusY, color);
+            }
+            if (radiusY > 0 && centerY - radiusY >= top && centerY - radiusY <= bottom) {
+                _pntr_fill_row(dst, centerX - rowX, centerX + rowX, centerY - radiusY, color);
+            }
+            radiusY--;
+            error -= radiusXSquared2 * radiusY - radiusXSquared;
+        }
+    }
+}
+
+/**
+ * Draws an ellipse on the given image, with line-thickness.
+ *
+ * @param dst The image to draw the ellipse onto.
+ * @param centerX The center of the ellipse at the X coordinate.
+ * @param centerY The center of the ellipse at the Y coordinate.
+ * @param radiusX The  horizontal radius of the ellipse.
+ * @param radiusY The vertical radius of the ellipse.
+ * @param thickness The thickness of the line
+ * @param color The desired color of the ellipse.
+ *
+ * @see pntr_draw_circle_thick()
+ */
+PNTR_API void pntr_draw_ellipse_thick(pntr_image* dst, int centerX, int centerY, int radiusX, int radiusY, int thickness, pntr_color color) {
+    if (thickness < 1) {
+        return;
+    }
+    if (thickness == 1) {
+        pntr_draw_ellipse(dst, centerX, centerY, radiusX, radiusY, color);
+        return;
+    }
+    if (dst == NULL || radiusX == 0 || radiusY == 0 || color.rgba.a == 0) {
+        return;
+    }
+
+    if (radiusX < 0) {
+        radiusX = -radiusX;
+    }
+    if (radiusY < 0) {
+        radiusY = -radiusY;
+    }
+
+    // The line reaches half of its thickness to either side of the ellipse.
+    float half = (float)thickness / 2.0f;
+    _pntr_rounded_box outer;
+    _pntr_rounded_box inner;
+    _pntr_rounded_box_ellipse(&outer, centerX, centerY, (float)radiusX + half, (float)radiusY + half);
+    _pntr_rounded_box_ellipse(&inner, centerX, centerY, (float)radiusX - half, (float)radiusY - half);
+    _pntr_draw_ring(dst, &outer, (inner.left < inner.right && inner.top < inner.bottom) ? &inner : NULL, color);
+}
+
+/**
+ * Draw a triangle using vectors.
+ *
+ * @param dst Where to draw the triangle.
+ * @param point1 The first point in the triangle.
+ * @param point2 The second point in the triangle.
+ * @param point3 The third point in the triangle.
+ * @param color What color to draw the triangle.
+ */
+PNTR_API void pntr_draw_triangle_vec(pntr_image* dst, pntr_vector point1, pntr_vector point2, pntr_vector point3, pntr_color color) {
+    pntr_draw_triangle(dst, point1.x, point1.y, point2.x, point2.y, point3.x, point3.y, color);
+}
+
+/**
+ * Draw a triangle using vectors, with line-thickness.
+ *
+ * @param dst Where to draw the triangle.
+ * @param point1 The first point in the triangle.
+ * @param point2 The second point in the triangle.
+ * @param point3 The third point in the triangle.
+ * @param thickness The thickness of the line
+ * @param color What color to draw the triangle.
+ */
+PNTR_API void pntr_draw_triangle_thick_vec(pntr_image *dst, pntr_vector point1, pntr_vector point2, pntr_vector point3, int thickness, pntr_color color) {
+    pntr_vector points[3];
+    points[0] = point1;
+    points[1] = point2;
+    points[2] = point3;
+    pntr_draw_polygon_thick(dst, points, 3, thickness, color);
+}
+
+/**
+ * Draw a triangle on an image.
+ *
+ * @param dst The image of which to draw the triangle.
+ * @param x1 The x coordinate of the first point.
+ * @param y1 The y coordinate of the first point.
+ * @param x2 The x coordinate of the second point.
+ * @param y2 The y coordinate of the second point.
+ * @param x3 The x coordinate of the third point.
+ * @param y3 The y coordinate of the third point.
+ * @param color The line color for the triangle.
+ */
+PNTR_API void pntr_draw_triangle(pntr_image* dst, int x1, int y1, int x2, int y2, int x3, int y3, pntr_color color) {
+    pntr_draw_line(dst, x1, y1, x2, y2, color);
+    pntr_draw_line(dst, x2, y2, x3, y3, color);
+    pntr_draw_line(dst, x3, y3, x1, y1, color);
+}
+
+/**
+ * Draw a triangle on an image, with line-thickness.
+ *
+ * @param dst The image of which to draw the triangle.
+ * @param x1 The x coordinate of the first point.
+ * @param y1 The y coordinate of the first point.
+ * @param x2 The x coordinate of the second point.
+ * @param y2 The y coordinate of the second point.
+ * @param x3 The x coordinate of the third point.
+ * @param y3 The y coordinate of the third point.
+ * @param thickness The thickness of the line
+ * @param color The line color for the triangle.
+ */
+PNTR_API void pntr_draw_triangle_thick(pntr_image* dst, int x1, int y1, int x2, int y2, int x3, int y3, int thickness, pntr_color color) {
+    pntr_draw_triangle_thick_vec(dst, PNTR_CLITERAL(pntr_vector) { x1, y1 }, PNTR_CLITERAL(pntr_vector) { x2, y2 }, PNTR_CLITERAL(pntr_vector) { x3, y3 }, thickness, color);
+}
+
+
+/**
+ * Draw a filled triangle on an image.
+ *
+ * @param dst The image of which to draw the triangle.
+ * @param x1 The x coordinate of the first point.
+ * @param y1 The y coordinate of the first point.
+ * @param x2 The x coordinate of the second point.
+ * @param y2 The y coordinate of the second point.
+ * @param x3 The x coordinate of the third point.
+ * @param y3 The y coordinate of the third point.
+ * @param color The fill color of the triangle.
+ */
+PNTR_API void pntr_draw_triangle_fill(pntr_image* dst, int x1, int y1, int x2, int y2, int x3, int y3, pntr_color color) {
+    pntr_draw_triangle_fill_vec(dst,
+        PNTR_CLITERAL(pntr_vector) { .x = x1, .y = y1 },
+        PNTR_CLITERAL(pntr_vector) { .x = x2, .y = y2 },
+        PNTR_CLITERAL(pntr_vector) { .x = x3, .y = y3 },
+        color
+    );
+}
+
+PNTR_API void pntr_draw_line_vec(pntr_image* dst, pntr_vector start, pntr_vector end, pntr_color color) {
+    pntr_draw_line(dst, start.x, start.y, end.x, end.y, color);
+}
+
+PNTR_API void pntr_draw_line_thick_vec(pntr_image* dst, pntr_vector start, pntr_vector end, int thickness, pntr_color color) {
+    pntr_draw_line_thick(dst, start.x, start.y, end.x, end.y, thickness, color);
+}
+
+PNTR_API void pntr_draw_polygon(pntr_image* dst, pntr_vector* points, int numPoints, pntr_color color) {
+    if (dst == NULL || color.rgba.a == 0 || numPoints <= 0 || points == NULL) {
+        return;
+    }
+
+    int nextPointIndex;
+    for (int i = 0; i < numPoints; i++) {
+        if (i < numPoints - 1) {
+            nextPointIndex = i + 1;
+        }
+        else {
+            nextPointIndex = 0;
+        }
+
+        pntr_draw_line(dst, points[i].x, points[i].y, points[nextPointIndex].x, points[nextPointIndex].y, color);
+   }
+}
+
+/**
+ * Draws the outline of a polygon with thickness, and round corners.
+ *
+ * @see pntr_draw_polygon_thick_ex()
+ */
+PNTR_API void pntr_draw_polygon_thick(pntr_image* dst, pntr_vector* points, int numPoints, int thickness, pntr_color color) {
+    pntr_draw_polygon_thick_ex(dst, points, numPoints, thickness, PNTR_LINE_JOIN_ROUND, color);
+}
+
+/**
+ * Draws the outline of a polygon with thickness, and the given corners.
+ *
+ * The whole outline is filled in one pass, so every pixel is drawn once, even at the corners.
+ *
+ * @param dst The image to draw the polygon on.
+ * @param points The points of the polygon.
+ * @param numPoints How many points there are.
+ * @param thickness How thick the outline is, in pixels.
+ * @param join How the corners are drawn.
+ * @param color The color of the outline.
+ *
+ * @see pntr_line_join
+ */
+PNTR_API void pntr_draw_polygon_thick_ex(pntr_image* dst, pntr_vector* points, int numPoints, int thickness, pntr_line_join join, pntr_color color) {
+    if (dst == NULL || color.rgba.a == 0 || numPoints <= 0 || points == NULL || thickness < 1) {
+        return;
+    }
+
+    if (thickness == 1) {
+        pntr_draw_polygon(dst, points, numPoints, color);
+        return;
+    }
+
+    _pntr_draw_stroke_vectors(dst, points, numPoints, true, thickness, join, PNTR_LINE_CAP_ROUND, color);
+}
+
+/**
+ * An edge of a polygon being filled, stepping one scanline at a time.
+ *
+ * @internal
+ */
+typedef struct _pntr_polygon_edge {
+    int yStart; /** The first scanline the edge crosses. */
+    int yEnd; /** The last scanline the edge crosses. */
+    int x; /** The whole part of the edge's x coordinate on the current scanline. */
+    int error; /** The fractional part of the edge's x coordinate, out of dy. */
+    int step; /** The whole amount x changes each scanline. */
+    int remainder; /** The fractional amount x changes each scanline, out of dy. */
+    int dy; /** The height of the edge. */
+} _pntr_polygon_edge;
+
+/**
+ * The amount of points a polygon can have before pntr_draw_polygon_fill() allocates memory.
+ *
+ * @internal
+ */
+#define _PNTR_POLYGON_STACK_POINTS 64
+
+/**
+ * Fills a polygon with either a color, or a gradient when one is given.
+ *
+ * @internal
+ */
+static void _pntr_draw_polygon_fill(pntr_image* dst, pntr_vector* points, int numPoints, pntr_color color, pntr_gradient* gradient) {
+    if (dst == NULL || points == NULL || numPoints < 3 || (gradient == NULL && color.rgba.a == 0)) {
+        return;
+    }
+
+    int clipTop = dst->clip.y;
+    int clipBottom = dst->clip.y + dst->clip.height - 1;
+    int clipLeft = dst->clip.x;
+    int clipRight = dst->clip.x + dst->clip.width;
+
+    // Small polygons don't need any memory allocated.
+    _pntr_polygon_edge edgesStack[_PNTR_POLYGON_STACK_POINTS];
+    int activeStack[_PNTR_POLYGON_STACK_POINTS];
+    _pntr_polygon_edge* edges = edgesStack;
+    int* active = activeStack;
+    if (numPoints > _PNTR_POLYGON_STACK_POINTS) {
+        edges = (_pntr_polygon_edge*)PNTR_MALLOC((sizeof(_pntr_polygon_edge) + sizeof(int)) * (size_t)numPoints);
+        if (edges == NULL) {
+            pntr_set_error(PNTR_ERROR_NO_MEMORY);
+            return;
+        }
+        active = (int*)(void*)(edges + numPoints);
+    }
+
+    // Build the edge table, skipping horizontal edges and those outside of the clip.
+    // An edge covers the scanlines below its top point, down to and including its bottom point.
+    int edgesCount = 0;
+    for (int i = 0, j = numPoints - 1; i < numPoints; j = i++) {
+        pntr_vector top = points[i];
+        pntr_vector bottom = points[j];
+        if (top.y == bottom.y) {
+            continue;
+        }
+        if (top.y > bottom.y) {
+            top = points[j];
+            bottom = points[i];
+        }
+
+        _pntr_polygon_edge* edge = &edges[edgesCount];
+        edge->yStart = PNTR_MAX(top.y + 1, clipTop);
+        edge->yEnd = PNTR_MIN(bottom.y, clipBottom);
+        if (edge->yStart > edge->yEnd) {
+            continue;
+        }
+
+        // Step with integers, keeping the fraction as a remainder so that there is no drift.
+        int dx = bottom.x - top.x;
+        edge->dy = bottom.y - top.y;
+        edge->step = dx / edge->dy;
+        edge->remainder = dx % edge->dy;
+        if (edge->remainder < 0) {
+            edge->step--;
+            edge->remainder += edge->dy;
+        }
+
+        int64_t offset = (int64_t)(edge->yStart - top.y) * dx;
+        int64_t whole = offset / edge->dy;
+        int64_t fraction = offset % edge->dy;
+        if (fraction < 0) {
+            whole--;
+            fraction += edge->dy;
+        }
+        edge->x = top.x + (int)whole;
+        edge->error = (int)fraction;
+
+        // Keep the edge table sorted by the first scanline.
+        int k = edgesCount++;
+        _pntr_polygon_edge inserted = *edge;
+        while (k > 0 && edges[k - 1].yStart > inserted.yStart) {
+            edges[k] = edges[k - 1];
+            k--;
+        }
+        edges[k] = inserted;
+    }
+
+    int nextEdge = 0;
+    int activeCount = 0;
+    int y = (edgesCount > 0) ? edges[0].yStart : 0;
+    while (nextEdge < edgesCount || activeCount > 0) {
+        // Add the edges starting on this scanline, and remove the ones that ended.
+        while (nextEdge < edgesCount && edges[nextEdge].yStart == y) {
+            active[activeCount++] = nextEdge++;
+        }
+        int kept = 0;
+        for (int i = 0; i < activeCount; i++) {
+            if (edges[active[i]].yEnd >= y) {
+                active[kept++] = active[i];
+            }
+        }
+        activeCount = kept;
+
+        // Jump to the next edge when nothing is active.
+        if (activeCount == 0) {
+            if (nextEdge < edgesCount) {
+                y = edges[nextEdge].yStart;
+            }
+            continue;
+        }
+
+        // The active edges stay nearly sorted between scanlines, so an insertion sort is quick.
+        for (int i = 1; i < activeCount; i++) {
+            int index = active[i];
+            int k = i;
+            while (k > 0 && edges[active[k - 1]].x > edges[index].x) {
+                active[k] = active[k - 1];
+                k--;
+            }
+            active[k] = index;
+        }
+
+        // Fill the spans between each pair of edges.
+        for (int i = 0; i + 1 < activeCount; i += 2) {
+            int left = PNTR_MAX(edges[active[i]].x, clipLeft);
+            int right = PNTR_MIN(edges[active[i + 1]].x, clipRight);
+            if (left >= right) {
+                continue;
+            }
+            if (gradient != NULL) {
+                _pntr_gradient_span(dst, gradient, left, y, right - left);
+            }
+            else {
+                _pntr_fill_span(dst, left, y, right - left, color);
+            }
+        }
+
+        // Step the edges to the next scanline.
+        for (int i = 0; i < activeCount; i++) {
+            _pntr_polygon_edge* edge = &edges[active[i]];
+            edge->x += edge->step;
+            edge->error += edge->remainder;
+            if (edge->error >= edge->dy) {
+                edge->x++;
+                edge->error -= edge->dy;
+            }
+        }
+        y++;
+    }
+
+    if (edges != edgesStack) {
+        PNTR_FREE(edges);
+    }
+}
+
+PNTR_API void pntr_draw_polygon_fill(pntr_image* dst, pntr_vector* points, int numPoints, pntr_color color) {
+    _pntr_draw_polygon_fill(dst, points, numPoints, color, NULL);
+}
+
+/**
+ * Draws a filled polygon, filled with the given gradient.
+ *
+ * @param dst The image to draw the polygon onto.
+ * @param points The points of the polygon.
+ * @param numPoints The number of points.
+ * @param gradient The gradient to fill the polygon with, in the coordinates of the image.
+ *
+ * @see pntr_draw_polygon_fill()
+ * @see pntr_new_gradient_linear()
+ */
+PNTR_API void pntr_draw_polygon_fill_gradient(pntr_image* dst, pntr_vector* points, int numPoints, pntr_gradient* gradient) {
+    if (gradient == NULL) {
+        return;
+    }
+
+    _pntr_draw_polygon_fill(dst, points, numPoints, PNTR_BLANK, gradient);
+}
+
+/**
+ * Divides two integers, rounding down rather than towards zero.
+ *
+ * @internal
+ */
+static int64_t _pntr_floor_div(int64_t numerator, int64_t denominator) {
+    int64_t quotient = numerator / denominator;
+    if (numerator % denominator != 0 && ((numerator < 0) != (denominator < 0))) {
+        quotient--;
+    }
+    return quotient;
+}
+
+/**
+ * A triangle being filled one scanline at a time, through the edge functions of each of its edges.
+ *
+ * Each edge function is `stepX * x + stepY * y + row`, which is positive inside of the triangle. The row value is kept
+ * for x = 0 on the current scanline, and stepped from one scanline to the next. Pixels exactly on an edge are only
+ * inside on the top and left edges, so that triangles sharing an edge neither overlap nor leave a gap.
+ *
+ * @see _pntr_triangle_init()
+ * @internal
+ */
+typedef struct _pntr_triangle {
+    int order[3]; /** Which of the given points each wound point is. */
+    int64_t area; /** Twice the area of the triangle. */
+    int left; /** The left of the clipped bounds. */
+    int right; /** The right of the clipped bounds, inclusive. */
+    int top; /** The top of the clipped bounds. */
+    int bottom; /** The bottom of the clipped bounds, inclusive. */
+    int64_t stepX[3]; /** How much each edge function changes from one pixel to the next. */
+    int64_t stepY[3]; /** How much each edge function changes from one scanline to the next. */
+    int64_t row[3]; /** The value of each edge function at x = 0 on the current scanline. */
+    int64_t bias[3]; /** The value each edge function must reach for a pixel to be inside. */
+} _pntr_triangle;
+
+/**
+ * Sets up the edge functions of a triangle, starting on its top clipped scanline.
+ *
+ * @return False when the triangle has no area, or is outside of the clip.
+ *
+ * @internal
+ */
+static bool _pntr_triangle_init(_pntr_triangle* triangle, pntr_image* dst, pntr_vector point1, pntr_vector point2, pntr_vector point3) {
+    pntr_vector points[3];
+    points[0] = point1;
+    points[1] = point2;
+    points[2] = point3;
+    triangle->order[0] = 0;
+    triangle->order[1] = 1;
+    triangle->order[2] = 2;
+
+    // Wind the points so that the edge functions are positive inside the triangle.
+    triangle->area = (int64_t)(point2.x - point1.x) * (point3.y - point1.y) - (int64_t)(point2.y - point1.y) * (point3.x - point1.x);
+    if (triangle->area == 0) {
+        return false;
+    }
+    if (triangle->area < 0) {
+        points[1] = point3;
+        points[2] = point2;
+        triangle->order[1] = 2;
+        triangle->order[2] = 1;
+        triangle->area = -triangle->area;
+    }
+
+    // Clip the bounds of the triangle.
+    triangle->left = PNTR_MAX(PNTR_MIN(PNTR_MIN(point1.x, point2.x), point3.x), dst->clip.x);
+    triangle->right = PNTR_MIN(PNTR_MAX(PNTR_MAX(point1.x, point2.x), point3.x), dst->clip.x + dst->clip.width - 1);
+    triangle->top = PNTR_MAX(PNTR_MIN(PNTR_MIN(point1.y, point2.y), point3.y), dst->clip.y);
+    triangle->bottom = PNTR_MIN(PNTR_MAX(PNTR_MAX(point1.y, point2.y), point3.y), dst->clip.y + dst->clip.height - 1);
+    if (triangle->left > triangle->right || triangle->top > triangle->bottom) {
+        return false;
+    }
+
+    for (int i = 0; i < 3; i++) {
+        pntr_vector a = points[i];
+        pntr_vector b = points[(i + 1) % 3];
+        triangle->stepX[i] = -(int64_t)(b.y - a.y);
+        triangle->stepY[i] = (int64_t)(b.x - a.x);
+        triangle->row[i] = -triangle->stepX[i] * a.x + triangle->stepY[i] * (triangle->top - a.y);
+
+        // Top-left rule: pixels on the top or left edges are inside, while those on the others are not.
+        triangle->bias[i] = (b.y < a.y || (b.y == a.y && b.x > a.x)) ? 0 : 1;
+    }
+
+    return true;
+}
+
+/**
+ * Solves the edge functions for the span of the current scanline that is inside of the triangle.
+ *
+ * @return False when no pixels of the scanline are inside.
+ *
+ * @internal
+ */
+static bool _pntr_triangle_span(const _pntr_triangle* triangle, int* x, int* width) {
+    int64_t spanLeft = triangle->left;
+    int64_t spanRight = triangle->right;
+    for (int i = 0; i < 3; i++) {
+        if (triangle->stepX[i] > 0) {
+            spanLeft = PNTR_MAX(spanLeft, -_pntr_floor_div(triangle->row[i] - triangle->bias[i], triangle->stepX[i]));
+        }
+        else if (triangle->stepX[i] < 0) {
+            spanRight = PNTR_MIN(spanRight, _pntr_floor_div(triangle->bias[i] - triangle->row[i], triangle->stepX[i]));
+        }
+        else if (triangle->row[i] < triangle->bias[i]) {
+            return false;
+        }
+    }
+
+    if (spanLeft > spanRight) {
+        return false;
+    }
+
+    *x = (int)spanLeft;
+    *width = (int)(spanRight - spanLeft) + 1;
+    return true;
+}
+
+/**
+ * Steps the edge functions of the triangle to the next scanline.
+ *
+ * @internal
+ */
+static void _pntr_triangle_next_row(_pntr_triangle* triangle) {
+    triangle->row[0] += triangle->stepY[0];
+    triangle->row[1] += triangle->stepY[1];
+    triangle->row[2] += triangle->stepY[2];
+}
+
+/**
+ * Interpolates a value given at each point of the triangle, on the current scanline.
+ *
+ * The weight of each point is the edge function of the edge opposite to it.
+ *
+ * @param triangle The triangle.
+ * @param values The value at each of the given points, in the order they were given.
+ * @param x The x coordinate on the current scanline.
+ * @param step Receives how much the value changes from one pixel to the next, in 16.16 fixed point.
+ *
+ * @return The value at the given x coordinate, in 16.16 fixed point.
+ *
+ * @internal
+ */
+static int64_t _pntr_triangle_interpolate(const _pntr_triangle* triangle, const int64_t* values, int x, int64_t* step) {
+    int64_t weighted = 0;
+    int64_t weightedStep = 0;
+    for (int i = 0; i < 3; i++) {
+        int64_t value = values[triangle->order[(i + 2) % 3]];
+        weighted += (triangle->row[i] + triangle->stepX[i] * x) * value;
+        weightedStep += triangle->stepX[i] * value;
+    }
+
+    *step = (weightedStep * 65536) / triangle->area;
+    return (weighted * 65536) / triangle->area;
+}
+
+/**
+ * Fills a triangle with a solid color, or with the interpolated colors of its points.
+ *
+ * @param dst Where to draw the triangle.
+ * @param point1 The first point in the triangle.
+ * @param point2 The second point in the triangle.
+ * @param point3 The third point in the triangle.
+ * @param colors The colors of each point to interpolate, or NULL to fill with the given color.
+ * @param color The color to fill the triangle with, when there are no colors to interpolate.
+ *
+ * @see _pntr_triangle
+ * @internal
+ */
+static void _pntr_draw_triangle(pntr_image* dst, pntr_vector point1, pntr_vector point2, pntr_vector point3, const pntr_color* colors, pntr_color color) {
+    _pntr_triangle triangle;
+    if (!_pntr_triangle_init(&triangle, dst, point1, point2, point3)) {
+        return;
+    }
+
+    int x, width;
+    if (colors == NULL) {
+        for (int y = triangle.top; y <= triangle.bottom; y++, _pntr_triangle_next_row(&triangle)) {
+            if (_pntr_triangle_span(&triangle, &x, &width)) {
+                _pntr_fill_span(dst, x, y, width, color);
+            }
+        }
+        return;
+    }
+
+    int64_t channels[4][3];
+    for (int i = 0; i < 3; i++) {
+        channels[0][i] = colors[i].rgba.r;
+        channels[1][i] = colors[i].rgba.g;
+        channels[2][i] = colors[i].rgba.b;
+        channels[3][i] = colors[i].rgba.a;
+    }
+
+    _pntr_image_modified(dst);
+    pntr_color span[64];
+    int64_t value[4], step[4];
+    for (int y = triangle.top; y <= triangle.bottom; y++, _pntr_triangle_next_row(&triangle)) {
+        if (!_pntr_triangle_span(&triangle, &x, &width)) {
+            continue;
+        }
+
+        // Colors are interpolated as 16.16 fixed point, stepping along the span.
+        for (int channel = 0; channel < 4; channel++) {
+            value[channel] = _pntr_triangle_interpolate(&triangle, channels[channel], x, &step[channel]);
+        }
+
+        pntr_color* pixel = &PNTR_PIXEL(dst, x, y);
+        while (width > 0) {
+            int chunk = PNTR_MIN(width, 64);
+            for (int i = 0; i < chunk; i++) {
+                span[i] = pntr_new_color(
+                    (unsigned char)PNTR_MIN(PNTR_MAX(value[0] >> 16, 0), 255),
+                    (unsigned char)PNTR_MIN(PNTR_MAX(value[1] >> 16, 0), 255),
+                    (unsigned char)PNTR_MIN(PNTR_MAX(value[2] >> 16, 0), 255),
+                    (unsigned char)PNTR_MIN(PNTR_MAX(value[3] >> 16, 0), 255)
+                );
+                if (dst->premultiplied) {
+                    span[i] = pntr_color_alpha_premultiply(span[i]);
+                }
+                for (int channel = 0; channel < 4; channel++) {
+                    value[channel] += step[channel];
+                }
+            }
+            _pntr_blend_image_row(dst, pixel, span, chunk);
+            pixel += chunk;
+            width -= chunk;
+        }
+    }
+}
+
+/**
+ * Samples a color from an image, with texture coordinates in 16.16 fixed point that are clamped to its edges.
+ *
+ * @param image The image to sample.
+ * @param u The x coordinate in the image, in 16.16 fixed point.
+ * @param v The y coordinate in the image, in 16.16 fixed point.
+ * @param filter Either PNTR_FILTER_NEARESTNEIGHBOR, or any other filter to blend the four nearest pixels.
+ *
+ * @return The sampled color, in the same alpha representation as the image.
+ *
+ * @internal
+ */
+static pntr_color _pntr_image_sample(pntr_image* image, int64_t u, int64_t v, pntr_filter filter) {
+    u = PNTR_MIN(PNTR_MAX(u, 0), (int64_t)(image->width - 1) << 16);
+    v = PNTR_MIN(PNTR_MAX(v, 0), (int64_t)(image->height - 1) << 16);
+    int x = (int)(u >> 16);
+    int y = (int)(v >> 16);
+    if (filter == PNTR_FILTER_NEARESTNEIGHBOR) {
+        return PNTR_PIXEL(image, x, y);
+    }
+
+    // Blend the four nearest pixels with 8 bit weights.
+    unsigned int fx = (unsigned int)(u >> 8) & 0xFF;
+    unsigned int fy = (unsigned int)(v >> 8) & 0xFF;
+    int x1 = PNTR_MIN(x + 1, image->width - 1);
+    int y1 = PNTR_MIN(y + 1, image->height - 1);
+    pntr_color c00 = PNTR_PIXEL(image, x, y);
+    pntr_color c10 = PNTR_PIXEL(image, x1, y);
+    pntr_color c01 = PNTR_PIXEL(image, x, y1);
+    pntr_color c11 = PNTR_PIXEL(image, x1, y1);
+    #define _PNTR_BILINEAR_CHANNEL(channel) (unsigned char)(( \
+        (c00.rgba.channel * (256 - fx) + c10.rgba.channel * fx) * (256 - fy) + \
+        (c01.rgba.channel * (256 - fx) + c11.rgba.channel * fx) * fy) >> 16)
+    pntr_color output = PNTR_NEW_COLOR(
+        _PNTR_BILINEAR_CHANNEL(r),
+        _PNTR_BILINEAR_CHANNEL(g),
+        _PNTR_BILINEAR_CHANNEL(b),
+        _PNTR_BILINEAR_CHANNEL(a)
+    );
+    #undef _PNTR_BILINEAR_CHANNEL
+    return output;
+}
+
+/**
+ * Fills a triangle with a texture, stepping its texture coordinates along each span.
+ *
+ * @param table Lookup tables for the tint, to share between triangles. When NULL, they are built as needed.
+ *
+ * @see pntr_draw_triangle_textured()
+ * @internal
+ */
+static void _pntr_draw_triangle_textured(pntr_image* dst, pntr_image* texture, pntr_vector point1, pntr_vector point2, pntr_vector point3, pntr_vector uv1, pntr_vector uv2, pntr_vector uv3, pntr_color tint, pntr_filter filter, _pntr_tint_table* table) {
+    _pntr_triangle triangle;
+    if (!_pntr_triangle_init(&triangle, dst, point1, point2, point3)) {
+        return;
+    }
+
+    // Tinting a premultiplied color needs the tint to be premultiplied too.
+    if (texture->premultiplied) {
+        tint = pntr_color_alpha_premultiply(tint);
+    }
+
+    // Building the tint tables only pays off when enough pixels are tinted.
+    _pntr_tint_table localTable;
+    if (table == NULL && tint.value != PNTR_WHITE_VALUE && (triangle.area >> 1) >= 256) {
+        localTable.ready = false;
+        table = &localTable;
+    }
+    if (table != NULL && tint.value != PNTR_WHITE_VALUE) {
+        _pntr_tint_table_init(table, tint);
+    }
+
+    int64_t us[3] = {uv1.x, uv2.x, uv3.x};
+    int64_t vs[3] = {uv1.y, uv2.y, uv3.y};
+
+    _pntr_image_modified(dst);
+    pntr_color span[64];
+    int x, width;
+    int64_t u, v, stepU, stepV;
+    for (int y = triangle.top; y <= triangle.bottom; y++, _pntr_triangle_next_row(&triangle)) {
+        if (!_pntr_triangle_span(&triangle, &x, &width)) {
+            continue;
+        }
+
+        // The texture coordinates are 16.16 fixed point, stepped along the span.
+        u = _pntr_triangle_interpolate(&triangle, us, x, &stepU);
+        v = _pntr_triangle_interpolate(&triangle, vs, x, &stepV);
+
+        pntr_color* pixel = &PNTR_PIXEL(dst, x, y);
+        while (width > 0) {
+            int chunk = PNTR_MIN(width, 64);
+            for (int i = 0; i < chunk; i++) {
+                span[i] = _pntr_image_sample(texture, u, v, filter);
+                u += stepU;
+                v += stepV;
+            }
+
+            if (table != NULL && tint.value != PNTR_WHITE_VALUE) {
+                _pntr_color_map_row(span, span, chunk, table->r, table->g, table->b, table->a);
+            }
+            else if (tint.value != PNTR_WHITE_VALUE) {
+                for (int i = 0; i < chunk; i++) {
+                    span[i] = pntr_color_tint(span[i], tint);
+                }
+            }
+            if (texture->premultiplied != dst->premultiplied) {
+                for (int i = 0; i < chunk; i++) {
+                    span[i] = texture->premultiplied ? pntr_color_alpha_unpremultiply(span[i]) : pntr_color_alpha_premultiply(span[i]);
+                }
+            }
+
+            _pntr_blend_image_row(dst, pixel, span, chunk);
+            pixel += chunk;
+            width -= chunk;
+        }
+    }
+}
+
+/**
+ * Draw a triangle filled with a texture, mapping each point of the triangle to a point on the texture.
+ *
+ * The texture is mapped affinely, stepping the texture coordinates along each scanline. Texture coordinates outside of
+ * the texture are clamped to its edges.
+ *
+ * @param dst Where to draw the triangle.
+ * @param texture The image to fill the triangle with.
+ * @param point1 The first point in the triangle.
+ * @param point2 The second point in the triangle.
+ * @param point3 The third point in the triangle.
+ * @param uv1 The pixel coordinate in the texture for the first point.
+ * @param uv2 The pixel coordinate in the texture for the second point.
+ * @param uv3 The pixel coordinate in the texture for the third point.
+ * @param tint The color to tint the texture with. Use PNTR_WHITE for no tint.
+ * @param filter How to sample the texture. PNTR_FILTER_NEARESTNEIGHBOR and PNTR_FILTER_BILINEAR are supported.
+ *
+ * @see pntr_draw_quad_textured()
+ */
+PNTR_API void pntr_draw_triangle_textured(pntr_image* dst, pntr_image* texture, pntr_vector point1, pntr_vector point2, pntr_vector point3, pntr_vector uv1, pntr_vector uv2, pntr_vector uv3, pntr_color tint, pntr_filter filter) {
+    if (dst == NULL || texture == NULL || tint.rgba.a == 0) {
+        return;
+    }
+
+    // Subimages rely on the opacity of the image they reference.
+    if (pntr_image_get_opacity(texture->subimage ? texture->parent : texture) == PNTR_OPACITY_TRANSPARENT) {
+        return;
+    }
+
+    _pntr_draw_triangle_textured(dst, texture, point1, point2, point3, uv1, uv2, uv3, tint, filter, NULL);
+}
+
+/**
+ * Draw a section of a texture onto any four sided shape, like a rotated, skewed, or scaled sprite.
+ *
+ * The quad is drawn as two triangles, from the first point to the third. Each triangle maps the texture affinely, so
+ * shapes that aren't parallelograms will show a seam along that diagonal.
+ *
+ * @code
+ * pntr_vector corners[4] = {{20, 10}, {90, 30}, {70, 100}, {0, 80}};
+ * pntr_draw_quad_textured(canvas, sprite, PNTR_CLITERAL(pntr_rectangle) {0, 0, 0, 0}, corners[0], corners[1], corners[2], corners[3], PNTR_WHITE, PNTR_FILTER_BILINEAR);
+ * @endcode
+ *
+ * @param dst Where to draw the quad.
+ * @param texture The image to fill the quad with.
+ * @param srcRect The section of the texture to draw. Use a width and height of 0 for the whole texture.
+ * @param point1 Where to draw the top left of the section.
+ * @param point2 Where to draw the top right of the section.
+ * @param point3 Where to draw the bottom right of the section.
+ * @param point4 Where to draw the bottom left of the section.
+ * @param tint The color to tint the texture with. Use PNTR_WHITE for no tint.
+ * @param filter How to sample the texture. PNTR_FILTER_NEARESTNEIGHBOR and PNTR_FILTER_BILINEAR are supported.
+ *
+ * @see pntr_draw_triangle_textured()
+ */
+PNTR_API void pntr_draw_quad_textured(pntr_image* dst, pntr_image* texture, pntr_rectangle srcRect, pntr_vector point1, pntr_vector point2, pntr_vector point3, pntr_vector point4, pntr_color tint, pntr_filter filter) {
+    if (dst == NULL || texture == NULL || tint.rgba.a == 0) {
+        return;
+    }
+
+    if (pntr_image_get_opacity(texture->subimage ? texture->parent : texture) == PNTR_OPACITY_TRANSPARENT) {
+        return;
+    }
+
+    if (srcRect.width <= 0 || srcRect.height <= 0) {
+        srcRect = PNTR_CLITERAL(pntr_rectangle) { 0, 0, texture->width, texture->height };
+    }
+
+    pntr_vector topLeft = PNTR_CLITERAL(pntr_vector) { srcRect.x, srcRect.y };
+    pntr_vector topRight = PNTR_CLITERAL(pntr_vector) { srcRect.x + srcRect.width, srcRect.y };
+    pntr_vector bottomRight = PNTR_CLITERAL(pntr_vector) { srcRect.x + srcRect.width, srcRect.y + srcRect.height };
+    pntr_vector bottomLeft = PNTR_CLITERAL(pntr_vector) { srcRect.x, srcRect.y + srcRect.height };
+
+    // Both triangles share the same tint tables.
+    _pntr_tint_table table;
+    table.ready = false;
+    _pntr_draw_triangle_textured(dst, texture, point1, point2, point3, topLeft, topRight, bottomRight, tint, filter, &table);
+    _pntr_draw_triangle_textured(dst, texture, point1, point3, point4, topLeft, bottomRight, bottomLeft, tint, filter, &table);
+}
+
+/**
+ * Draw a filled triangle using vectors.
+ *
+ * @param dst Where to draw the triangle.
+ * @param point1 The first point in the triangle.
+ * @param point2 The second point in the triangle.
+ * @param point3 The third point in the triangle.
+ * @param color What color to draw the triangle.
+ */
+PNTR_API void pntr_draw_triangle_fill_vec(pntr_image* dst, pntr_vector point1, pntr_vector point2, pntr_vector point3, pntr_color color) {
+    if (dst == NULL || color.rgba.a == 0) {
+        return;
+    }
+
+    _pntr_draw_triangle(dst, point1, point2, point3, NULL, color);
+}
+
+/**
+ * Draw a triangle, interpolating the colors of each of its points.
+ *
+ * @param dst Where to draw the triangle.
+ * @param x1 The x coordinate of the first point.
+ * @param y1 The y coordinate of the first point.
+ * @param x2 The x coordinate of the second point.
+ * @param y2 The y coordinate of the second point.
+ * @param x3 The x coordinate of the third point.
+ * @param y3 The y coordinate of the third point.
+ * @param color1 The color of the first point.
+ * @param color2 The color of the second point.
+ * @param color3 The color of the third point.
+ *
+ * @see pntr_draw_triangles()
+ */
+PNTR_API void pntr_draw_triangle_gradient(pntr_image* dst, int x1, int y1, int x2, int y2, int x3, int y3, pntr_color color1, pntr_color color2, pntr_color color3) {
+    pntr_draw_triangle_gradient_vec(dst,
+        PNTR_CLITERAL(pntr_vector) { .x = x1, .y = y1 },
+        PNTR_CLITERAL(pntr_vector) { .x = x2, .y = y2 },
+        PNTR_CLITERAL(pntr_vector) { .x = x3, .y = y3 },
+        color1, color2, color3
+    );
+}
+
+/**
+ * Draw a triangle using vectors, interpolating the colors of each of its points.
+ *
+ * @param dst Where to draw the triangle.
+ * @param point1 The first point in the triangle.
+ * @param point2 The second point in the triangle.
+ * @param point3 The third point in the triangle.
+ * @param color1 The color of the first point.
+ * @param color2 The color of the second point.
+ * @param color3 The color of the third point.
+ */
+PNTR_API void pntr_draw_triangle_gradient_vec(pntr_image* dst, pntr_vector point1, pntr_vector point2, pntr_vector point3, pntr_color color1, pntr_color color2, pntr_color color3) {
+    if (dst == NULL || (color1.rgba.a == 0 && color2.rgba.a == 0 && color3.rgba.a == 0)) {
+        return;
+    }
+
+    pntr_color colors[3];
+    colors[0] = color1;
+    colors[1] = color2;
+    colors[2] = color3;
+    _pntr_draw_triangle(dst, point1, point2, point3, colors, PNTR_BLANK);
+}
+
+/**
+ * Draws a mesh of filled triangles in one call.
+ *
+ * Triangles that share an edge neither overlap nor leave a gap between them, so translucent meshes blend evenly.
+ *
+ * @code
+ * pntr_vector vertices[] = {{10, 10}, {90, 10}, {90, 90}, {10, 90}};
+ * int indices[] = {0, 1, 2, 0, 2, 3};
+ * pntr_draw_triangles(image, vertices, indices, 6, NULL, PNTR_RED);
+ * @endcode
+ *
+ * @param dst Where to draw the triangles.
+ * @param vertices The points of the mesh.
+ * @param indices Three indices into the vertices for each triangle. When NULL, every three vertices make a triangle.
+ * @param count The number of indices, or the number of vertices when there are no indices. Three for each triangle.
+ * @param colors A color for each vertex, which are interpolated across each triangle. When NULL, the given color is used.
+ * @param color The color to fill the triangles with when there are no vertex colors.
+ *
+ * @see pntr_draw_triangle_fill()
+ * @see pntr_draw_triangle_gradient()
+ */
+PNTR_API void pntr_draw_triangles(pntr_image* dst, pntr_vector* vertices, int* indices, int count, pntr_color* colors, pntr_color color) {
+    if (dst == NULL || vertices == NULL || count < 3 || (colors == NULL && color.rgba.a == 0)) {
+        return;
+    }
+
+    pntr_color vertexColors[3];
+    for (int i = 0; i + 2 < count; i += 3) {
+        int index0 = (indices != NULL) ? indices[i] : i;
+        int index1 = (indices != NULL) ? indices[i + 1] : i + 1;
+        int index2 = (indices != NULL) ? indices[i + 2] : i + 2;
+
+        if (colors == NULL) {
+            _pntr_draw_triangle(dst, vertices[index0], vertices[index1], vertices[index2], NULL, color);
+            continue;
+        }
+
+        vertexColors[0] = colors[index0];
+        vertexColors[1] = colors[index1];
+        vertexColors[2] = colors[index2];
+        _pntr_draw_triangle(dst, vertices[index0], vertices[index1], vertices[index2], vertexColors, color);
+    }
+}
+
+/**
+ * The angles an arc sweeps through, as the directions it starts and ends in.
+ *
+ * @see _pntr_arc_init()
+ * @internal
+ */
+typedef struct _pntr_arc {
+    float startX; /** The x of the direction the arc starts in. */
+    float startY; /** The y of the direction the arc starts in. */
+    float endX; /** The x of the direction the arc ends in. */
+    float endY; /** The y of the direction the arc ends in. */
+    bool wide; /** Whether the arc sweeps through more than half of a turn. */
+    bool full; /** Whether the arc is a whole circle. */
+} _pntr_arc;
+
+/**
+ * How far outside of an arc's angles a pixel can be while still being counted inside, to make up for float error.
+ *
+ * @internal
+ */
+#define _PNTR_ARC_EPSILON 0.001f
+
+/**
+ * Sets up the angles of an arc, in degrees. This is the only trigonometry used to draw it.
+ *
+ * @internal
+ */
+static void _pntr_arc_init(_pntr_arc* arc, float startAngle, float endAngle) {
+    if (endAngle < startAngle) {
+        float swap = startAngle;
+        startAngle = endAngle;
+        endAngle = swap;
+    }
+
+    arc->full = endAngle - startAngle >= 360.0f;
+    arc->wide = endAngle - startAngle > 180.0f;
+    arc->startX = PNTR_COSF(startAngle * PNTR_PI / 180.0f);
+    arc->startY = PNTR_SINF(startAngle * PNTR_PI / 180.0f);
+    arc->endX = PNTR_COSF(endAngle * PNTR_PI / 180.0f);
+    arc->endY = PNTR_SINF(endAngle * PNTR_PI / 180.0f);
+
+    // Snap the directions along the axes, so that pixels right on them are inside.
+    arc->startX = (PNTR_FABSF(arc->startX) < 0.00001f) ? 0.0f : arc->startX;
+    arc->startY = (PNTR_FABSF(arc->startY) < 0.00001f) ? 0.0f : arc->startY;
+    arc->endX = (PNTR_FABSF(arc->endX) < 0.00001f) ? 0.0f : arc->endX;
+    arc->endY = (PNTR_FABSF(arc->endY) < 0.00001f) ? 0.0f : arc->endY;
+}
+
+/**
+ * Checks whether the direction from the center to a pixel is within the angles of an arc, including its edges.
+ *
+ * The arc turns from its start towards its end, so a pixel is inside when it is to that side of both the start and
+ * end directions, or of either of them for arcs wider than half of a turn.
+ *
+ * @internal
+ */
+static bool _pntr_arc_contains(const _pntr_arc* arc, int x, int y) {
+    if (arc->full) {
+        return true;
+    }
+
+    bool afterStart = arc->startX * (float)y - arc->startY * (float)x >= -_PNTR_ARC_EPSILON;
+    bool beforeEnd = (float)x * arc->endY - (float)y * arc->endX >= -_PNTR_ARC_EPSILON;
+    return arc->wide ? (afterStart || beforeEnd) : (afterStart && beforeEnd);
+}
+
+/**
+ * Finds which x offsets on a row satisfy a * x + b >= 0, which is one side of the start or end direction of an arc.
+ *
+ * @param limit How far the offsets can reach, to keep the range within integers.
+ * @param first Where to store the first offset, or a value greater than last when there are none.
+ * @param last Where to store the last offset.
+ *
+ * @internal
+ */
+static void _pntr_arc_side(float a, float b, int limit, int* first, int* last) {
+    *first = -limit;
+    *last = limit;
+    if (a > 0.0f) {
+        float edge = PNTR_MAX((-_PNTR_ARC_EPSILON - b) / a, (float)-limit);
+        *first = (int)PNTR_CEILF(PNTR_MIN(edge, (float)(limit + 1)));
+    }
+    else if (a < 0.0f) {
+        float edge = PNTR_MIN((-_PNTR_ARC_EPSILON - b) / a, (float)limit);
+        *last = -(int)PNTR_CEILF(-PNTR_MAX(edge, (float)(-limit - 1)));
+    }
+    else if (b < -_PNTR_ARC_EPSILON) {
+        *first = limit + 1;
+    }
+}
+
+/**
+ * Draws a point of an arc's outline when it is within its angles.
+ *
+ * @internal
+ */
+static void _pntr_draw_arc_point(pntr_image* dst, int centerX, int centerY, int x, int y, const _pntr_arc* arc, pntr_color color) {
+    if (_pntr_arc_contains(arc, x, y)) {
+        pntr_draw_point(dst, centerX + x, centerY + y, color);
+    }
+}
+
+/**
+ * Draws an arc of a circle's outline on the given image.
+ *
+ * The outline is the same as the one of pntr_draw_circle(), restricted to the pixels within the arc's angles. Each
+ * pixel is only drawn once.
+ *
+ * @param dst The image to draw the arc onto.
+ * @param centerX The center of the arc at the X coordinate.
+ * @param centerY The center of the arc at the Y coordinate.
+ * @param radius The radius of the arc.
+ * @param startAngle The angle in degrees where the arc starts. 0 points right, and angles turn clockwise.
+ * @param endAngle The angle in degrees where the arc ends.
+ * @param segments Unused, as arcs are drawn exactly.
+ * @param color The color of the arc.
+ *
+ * @see pntr_draw_arc_fill()
+ */
+PNTR_API void pntr_draw_arc(pntr_image* dst, int centerX, int centerY, float radius, float startAngle, float endAngle, int segments, pntr_color color) {
+    (void)segments;
+    if (radius <= 0.0f) {
+        pntr_draw_point(dst, centerX, centerY, color);
+        return;
+    }
+    if (dst == NULL || color.rgba.a == 0) {
+        return;
+    }
+
+    int circleRadius = (int)(radius + 0.5f);
+    if (centerX + circleRadius < dst->clip.x || centerX - circleRadius >= dst->clip.x + dst->clip.width || centerY + circleRadius < dst->clip.y || centerY - circleRadius >= dst->clip.y + dst->clip.height) {
+        return;
+    }
+
+    _pntr_arc arc;
+    _pntr_arc_init(&arc, startAngle, endAngle);
+
+    // Each row has the outermost pixel within the radius, along with the pixels of the columns whose outermost pixel is
+    // on the row, which fills the gaps where the circle is steep. Rows are mirrored up and down, and left and right.
+    int radiusSquared = circleRadius * circleRadius;
+    int x = circleRadius;
+    int next = circleRadius;
+    for (int y = 0; y <= circleRadius; y++) {
+        while (x * x + y * y > radiusSquared) {
+            x--;
+        }
+        int first = 0;
+        if (y < circleRadius) {
+            while (next * next + (y + 1) * (y + 1) > radiusSquared) {
+                next--;
+            }
+            first = PNTR_MIN(next + 1, x);
+        }
+
+        for (int column = first; column <= x; column++) {
+            _pntr_draw_arc_point(dst, centerX, centerY, column, y, &arc, color);
+            if (column > 0) {
+                _pntr_draw_arc_point(dst, centerX, centerY, -column, y, &arc, color);
+            }
+            if (y > 0) {
+                _pntr_draw_arc_point(dst, centerX, centerY, column, -y, &arc, color);
+                if (column > 0) {
+                    _pntr_draw_arc_point(dst, centerX, centerY, -column, -y, &arc, color);
+                }
+            }
+        }
+    }
+}
+
+PNTR_API void pntr_draw_arc_thick(pntr_image* dst, int centerX, int centerY, float radius, float startAngle, float endAngle, int segments, int thickness, pntr_color color) {
+    if (radius <= 0.0f) {
+        pntr_draw_point(dst, centerX, centerY, color);
+        return;
+    }
+    if (segments <= 0) {
+        return;
+    }
+
+    float startAngleRad = startAngle * PNTR_PI / 180.0f;
+    float endAngleRad = endAngle * PNTR_PI / 180.0f;
+
+    // Calculate how much distance between each segment
+    float stepAngle = (endAngleRad - startAngleRad) / (float)(segments);
+
+    // Draw the arc with line segments
+    int x1 = centerX + (int)((float)radius * PNTR_COSF(startAngleRad));
+    int y1 = centerY + (int)((float)radius * PNTR_SINF(startAngleRad));
+    float angle;
+    for (int i = 1; i < segments; i++) {
+        angle = startAngleRad + (float)i * stepAngle;
+        int x2 = centerX + (int)((float)radius * PNTR_COSF(angle));
+        int y2 = centerY + (int)((float)radius * PNTR_SINF(angle));
+        pntr_draw_line_thick(dst, x1, y1, x2, y2, thickness, color);
+        x1 = x2;
+        y1 = y2;
+    }
+}
+
+/**
+ * Draws a filled sector of a circle on the given image.
+ *
+ * Each row is filled with the pixels within the radius that are within the arc's angles, with at most two spans.
+ *
+ * @param dst The image to draw the sector onto.
+ * @param centerX The center of the sector at the X coordinate.
+ * @param centerY The center of the sector at the Y coordinate.
+ * @param radius The radius of the sector.
+ * @param startAngle The angle in degrees where the sector starts. 0 points right, and angles turn clockwise.
+ * @param endAngle The angle in degrees where the sector ends.
+ * @param segments Unused, as sectors are drawn exactly.
+ * @param color The fill color of the sector.
+ *
+ * @see pntr_draw_arc()
+ */
+PNTR_API void pntr_draw_arc_fill(pntr_image* dst, int centerX, int centerY, float radius, float startAngle, float endAngle, int segments, pntr_color color) {
+    (void)segments;
+    if (radius <= 0.0f) {
+        pntr_draw_point(dst, centerX, centerY, color);
+        return;
+    }
+    if (dst == NULL || color.rgba.a == 0) {
+        return;
+    }
+
+    _pntr_arc arc;
+    _pntr_arc_init(&arc, startAngle, endAngle);
+
+    int limit = (int)radius;
+    int top = PNTR_MAX(-limit, dst->clip.y - centerY);
+    int bottom = PNTR_MIN(limit, dst->clip.y + dst->clip.height - 1 - centerY);
+    float radiusSquared = radius * radius;
+    for (int y = top; y <= bottom; y++) {
+        int reach = (int)PNTR_SQRTF(radiusSquared - (float)(y * y));
+        if (arc.full) {
+            _pntr_fill_row(dst, centerX - reach, centerX + reach + 1, centerY + y, color);
+            continue;
+        }
+
+        // Each direction of the arc keeps one side of the row.
+        int startFirst;
+        int startLast;
+        int endFirst;
+        int endLast;
+        _pntr_arc_side(-arc.startY, arc.startX * (float)y, reach, &startFirst, &startLast);
+        _pntr_arc_side(arc.endY, -arc.endX * (float)y, reach, &endFirst, &endLast);
+
+        if (!arc.wide) {
+            int first = PNTR_MAX(startFirst, endFirst);
+            int last = PNTR_MIN(startLast, endLast);
+            _pntr_fill_row(dst, centerX + first, centerX + last + 1, centerY + y, color);
+        }
+        else if (startFirst > startLast || endFirst > endLast || startLast + 1 < endFirst || endLast + 1 < startFirst) {
+            // The sides don't overlap, so they are filled separately.
+            if (startFirst <= startLast) {
+                _pntr_fill_row(dst, centerX + startFirst, centerX + startLast + 1, centerY + y, color);
+            }
+            if (endFirst <= endLast) {
+                _pntr_fill_row(dst, centerX + endFirst, centerX + endLast + 1, centerY + y, color);
+            }
+        }
+        else {
+            int first = PNTR_MIN(startFirst, endFirst);
+            int last = PNTR_MAX(startLast, endLast);
+            _pntr_fill_row(dst, centerX + first, centerX + last + 1, centerY + y, color);
+        }
+    }
+}
+
+PNTR_API void pntr_draw_rectangle_rounded(pntr_image* dst, int x, int y, int width, int height, int topLeftRadius, int topRightRadius, int bottomLeftRadius, int bottomRightRadius, pntr_color color) {
+    if (topLeftRadius == 0 && topRightRadius == 0 && bottomLeftRadius == 0 && bottomRightRadius == 0) {
+        pntr_draw_rectangle(dst, x, y, width, height, color);
+        return;
+    }
+
+    pntr_draw_line_horizontal(dst, x + topLeftRadius, y, width - topLeftRadius - topRightRadius, color); // Top
+    pntr_draw_line_horizontal(dst, x + bottomLeftRadius, y + height, width - bottomLeftRadius - bottomRightRadius - 1, color); // Bottom
+    pntr_draw_line_vertical(dst, x, y + topLeftRadius, height - topLeftRadius - bottomLeftRadius, color); // Left
+    pntr_draw_line_vertical(dst, x + width - 1, y + topRightRadius, height - topRightRadius - bottomRightRadius, color); // Right
+
+    // TODO: pntr_draw_rectangle_rounded(): Do the angles here make sense?
+    pntr_draw_arc(dst, x + topLeftRadius, y + topLeftRadius, (float)topLeftRadius, 180.0f, 270.0f, topLeftRadius * 2, color); // Top Left
+    pntr_draw_arc(dst, x + width - topRightRadius - 1, y + topRightRadius, (float)topRightRadius, 0.0f, -90.0f, topRightRadius * 2, color); // Top Right
+    pntr_draw_arc(dst, x + bottomLeftRadius, y + height - bottomLeftRadius, (float)bottomLeftRadius, -180.0f, -270.0f, bottomLeftRadius * 2, color); // Bottom Left
+    pntr_draw_arc(dst, x + width - bottomRightRadius - 1, y + height - bottomRightRadius, (float)bottomRightRadius, 0.0f, 90.0f, bottomRightRadius * 2, color); // Bottom Right
+}
+
+/**
+ * Draws the outline of a rectangle with rounded corners, with line-thickness.
+ *
+ * The line is inside of the rectangle, and each row of it is filled with at most two spans.
+ *
+ * @param thickness The thickness of the line.
+ *
+ * @see pntr_draw_rectangle_rounded()
+ */
+PNTR_API void pntr_draw_rectangle_thick_rounded(pntr_image* dst, int x, int y, int width, int height, int topLeftRadius, int topRightRadius, int bottomLeftRadius, int bottomRightRadius, int thickness, pntr_color color) {
+    if (thickness < 1) {
+        return;
+    }
+    if (thickness == 1) {
+        pntr_draw_rectangle_rounded(dst, x, y, width, height, topLeftRadius, topRightRadius, bottomLeftRadius, bottomRightRadius, color);
+        return;
+    }
+    if (width <= 0 || height <= 0) {
+        return;
+    }
+
+    // The corners can't be larger than the rectangle, and the inside follows them with radii shrunk by the thickness.
+    int radii[4] = {topLeftRadius, topRightRadius, bottomLeftRadius, bottomRightRadius};
+    int largest = PNTR_MIN(width, height) / 2;
+    _pntr_rounded_box outer;
+    _pntr_rounded_box inner;
+    outer.left = (float)x;
+    outer.top = (float)y;
+    outer.right = (float)(x + width);
+    outer.bottom = (float)(y + height);
+    inner.left = outer.left + (float)thickness;
+    inner.top = outer.top + (float)thickness;
+    inner.right = outer.right - (float)thickness;
+    inner.bottom = outer.bottom - (float)thickness;
+    for (int i = 0; i < 4; i++) {
+        int radius = PNTR_MAX(0, PNTR_MIN(radii[i], largest));
+        outer.radiusX[i] = outer.radiusY[i] = (float)radius;
+        inner.radiusX[i] = inner.radiusY[i] = (float)PNTR_MAX(0, radius - thickness);
+    }
+    _pntr_draw_ring(dst, &outer, (inner.left < inner.right && inner.top < inner.bottom) ? &inner : NULL, color);
+}
+
+/**
+ * Draws a filled rectangle with rounded corners on the given image.
+ *
+ * @param cornerRadius The radius of all four corners.
+ *
+ * @see pntr_draw_rectangle_rounded_fill_ex()
+ */
+PNTR_API void pntr_draw_rectangle_rounded_fill(pntr_image* dst, int x, int y, int width, int height, int cornerRadius, pntr_color color) {
+    pntr_draw_rectangle_rounded_fill_ex(dst, x, y, width, height, cornerRadius, cornerRadius, cornerRadius, cornerRadius, color);
+}
+
+/**
+ * Draws a filled rectangle with a different radius for each corner on the given image.
+ *
+ * Each row is filled with one span, inset by the corners it passes through, so every pixel is only drawn once.
+ *
+ * @param dst The image to draw the rectangle onto.
+ * @param x The x coordinate of the rectangle.
+ * @param y The y coordinate of the rectangle.
+ * @param width The width of the rectangle.
+ * @param height The height of the rectangle.
+ * @param topLeftRadius The radius of the top left corner.
+ * @param topRightRadius The radius of the top right corner.
+ * @param bottomLeftRadius The radius of the bottom left corner.
+ * @param bottomRightRadius The radius of the bottom right corner.
+ * @param color The fill color of the rectangle.
+ *
+ * @see pntr_draw_rectangle_rounded()
+ */
+PNTR_API void pntr_draw_rectangle_rounded_fill_ex(pntr_image* dst, int x, int y, int width, int height, int topLeftRadius, int topRightRadius, int bottomLeftRadius, int bottomRightRadius, pntr_color color) {
+    if (topLeftRadius <= 0 && topRightRadius <= 0 && bottomLeftRadius <= 0 && bottomRightRadius <= 0) {
+        pntr_draw_rectangle_fill(dst, x, y, width, height, color);
+        return;
+    }
+    if (width <= 0 || height <= 0) {
+        return;
+    }
+
+    // The corners can't be larger than the rectangle.
+    int radii[4] = {topLeftRadius, topRightRadius, bottomLeftRadius, bottomRightRadius};
+    int largest = PNTR_MIN(width, height) / 2;
+    _pntr_rounded_box box;
+    box.left = (float)x;
+    box.top = (float)y;
+    box.right = (float)(x + width);
+    box.bottom = (float)(y + height);
+    for (int i = 0; i < 4; i++) {
+        box.radiusX[i] = box.radiusY[i] = (float)PNTR_MAX(0, PNTR_MIN(radii[i], largest));
+    }
+    _pntr_draw_ring(dst, &box, NULL, color);
+}
+
+/**
+ * Get image pixel color at (x, y) position.
+ *
+ * @param image The image to get the color from.
+ * @param x The x position of the pixel.
+ * @param y The y position of the pixel.
+ *
+ * @return The color at (x, y) position from the image.
+ */
+PNTR_API pntr_color pntr_image_get_color(pntr_image* image, int x, int y) {
+    if (image == NULL || x < 0 || y < 0 || x >= image->width || y >= image->height) {
+        return PNTR_BLANK;
+    }
+
+    return PNTR_PIXEL(image, x, y);
+}
+
+/**
+ * Get the file type of the given image, based on its filename.
+ *
+ * @param filePath The file path to the image.
+ *
+ * @return The type of the image, based on its file extension, or `PNTR_IMAGE_TYPE_UNKNOWN` if it's unknown.
+ *
+ * @see PNTR_IMAGE_TYPE_UNKNOWN
+ * @see PNTR_IMAGE_TYPE_PNG
+ * @see PNTR_IMAGE_TYPE_BMP
+ * @see PNTR_IMAGE_TYPE_JPG
+ */
+PNTR_API pntr_image_type pntr_get_file_image_type(const char* filePath) {
+    if (filePath == NULL) {
+        return PNTR_IMAGE_TYPE_UNKNOWN;
+    }
+
+    if (PNTR_STRSTR(filePath, ".png") != NULL || PNTR_STRSTR(filePath, ".PNG") != NULL) {
+        return PNTR_IMAGE_TYPE_PNG;
+    }
+
+    if (PNTR_STRSTR(filePath, ".bmp") != NULL || PNTR_STRSTR(filePath, ".BMP") != NULL) {
+        return PNTR_IMAGE_TYPE_BMP;
+    }
+
+    if (PNTR_STRSTR(filePath, ".jpg") != NULL || PNTR_STRSTR(filePath, ".jpeg") != NULL || PNTR_STRSTR(filePath, ".JPG") != NULL || PNTR_STRSTR(filePath, ".JPEG") != NULL) {
+        return PNTR_IMAGE_TYPE_JPG;
+    }
+
+    return PNTR_IMAGE_TYPE_UNKNOWN;
+}
+
+// Load stb_image or cute_png.
+#ifndef PNTR_LOAD_IMAGE_FROM_MEMORY
+    #ifdef PNTR_STB_IMAGE
+        #include "extensions/pntr_stb_image.h"
+    #elif defined(PNTR_CUTE_PNG)
+        #include "extensions/pntr_cute_png.h"
+    #else
+        // Allow disabling image loading.
+        #ifdef PNTR_NO_LOAD_IMAGE
+            #define PNTR_LOAD_IMAGE_FROM_MEMORY(type, fileData, dataSize) NULL
+        #else
+            // Default to stb_image.
+            #include "extensions/pntr_stb_image.h"
+        #endif
+    #endif
+#endif
+
+#ifndef PNTR_SAVE_IMAGE_TO_MEMORY
+    #ifdef PNTR_STB_IMAGE
+        #include "extensions/pntr_stb_image_write.h"
+    #elif defined(PNTR_CUTE_PNG)
+        #include "extensions/pntr_cute_png.h"
+    #else
+        // Allow disabling image saving.
+        #ifdef PNTR_NO_SAVE_IMAGE
+            #define PNTR_SAVE_IMAGE_TO_MEMORY(image, type, dataSize) NULL
+        #else
+            // Default to stb_image_write.
+            #include "extensions/pntr_stb_image_write.h"
+        #endif
+    #endif
+#endif
+
+/**
+ * Load an image from memory buffer.
+ *
+ * @note This can be overloaded by defining \c PNTR_LOAD_IMAGE_FROM_MEMORY .
+ *
+ * @param type The type of image to load.
+ * @param fileData The data of the file to be loaded.
+ * @param dataSize The size of the file data.
+ *
+ * @return A newly loaded image, or NULL on failure.
+ *
+ * @see PNTR_LOAD_IMAGE_FROM_MEMORY
+ * @see PNTR_NO_LOAD_IMAGE
+ */
+PNTR_API pntr_image* pntr_load_image_from_memory(pntr_image_type type, const unsigned char *fileData, unsigned int dataSize) {
+    if (fileData == NULL || dataSize == 0) {
+        return (pntr_image*)pntr_set_error(PNTR_ERROR_INVALID_ARGS);
+    }
+
+    return PNTR_LOAD_IMAGE_FROM_MEMORY(type, fileData, dataSize);
+}
+
+/**
+ * Load an image from memory buffer, with its alpha premultiplied.
+ *
+ * @param type The type of image to load.
+ * @param fileData The data of the file to be loaded.
+ * @param dataSize The size of the file data.
+ *
+ * @return A newly loaded premultiplied image, or NULL on failure.
+ *
+ * @see pntr_load_image_from_memory()
+ * @see pntr_image_alpha_premultiply()
+ */
+PNTR_API pntr_image* pntr_load_image_from_memory_premultiplied(pntr_image_type type, const unsigned char *fileData, unsigned int dataSize) {
+    pntr_image* image = pntr_load_image_from_memory(type, fileData, dataSize);
+    pntr_image_alpha_premultiply(image);
+    return image;
+}
+
+/**
+ * Load an image from file.
+ *
+ * @param fileName The name of the file to load from the file system.
+ *
+ * @return The newly loaded file.
+ *
+ * @see PNTR_NO_LOAD_IMAGE
+ */
+PNTR_API pntr_image* pntr_load_image(const char* fileName) {
+    if (fileName == NULL) {
+        return (pntr_image*)pntr_set_error(PNTR_ERROR_INVALID_ARGS);
+    }
+
+    unsigned int bytesRead;
+    const unsigned char* fileData = pntr_load_file(fileName, &bytesRead);
+    if (fileData == NULL) {
+        return (pntr_image*)pntr_set_error(PNTR_ERROR_FAILED_TO_OPEN);
+    }
+
+    pntr_image_type type = pntr_get_file_image_type(fileName);
+    pntr_image* output = pntr_load_image_from_memory(type, fileData, bytesRead);
+    pntr_unload_file((unsigned char*)fileData);
+
+    return output;
+}
+
+/**
+ * Draw an image onto the destination image, with tint.
+ *
+ * @param dst The destination image where the source image will be drawn.
+ * @param src The source image to be drawn.
+ * @param posX The x-coordinate of the position where the source image will be drawn.
+ * @param posY The y-coordinate of the position where the source image will be drawn.
+ * @param tint The color to tint the image when drawing.
+ */
+PNTR_API void pntr_draw_image_tint(pntr_image* dst, pntr_image* src, int posX, int posY, pntr_color tint) {
+    if (src == NULL) {
+        return;
+    }
+    pntr_draw_image_tint_rec(dst, src,
+        PNTR_CLITERAL(pntr_rectangle) { 0, 0, src->width, src->height },
+        posX, posY, tint
+    );
+}
+
+/**
+ * Draw an image onto a destination image.
+ *
+ * @param dst The destination image where the source image will be drawn.
+ * @param src The source image to be drawn.
+ * @param posX The x-coordinate of the position where the source image will be drawn.
+ * @param posY The y-coordinate of the position where the source image will be drawn.
+ */
+PNTR_API void pntr_draw_image(pntr_image* dst, pntr_image* src, int posX, int posY) {
+    if (src == NULL) {
+        return;
+    }
+    pntr_draw_image_tint_rec(dst, src,
+        PNTR_CLITERAL(pntr_rectangle) { 0, 0, src->width, src->height },
+        posX, posY, PNTR_WHITE);
+}
+
+/**
+ * Get source alpha-blended into destination color.
+ *
+ * @param dst The destination color.
+ * @param src The source color.
+ *
+ * @return The new alpha-blended color.
+ *
+ * @see PNTR_NO_ALPHABLEND
+ */
+PNTR_API pntr_color pntr_color_alpha_blend(pntr_color dst, pntr_color src) {
+    pntr_blend_color(&dst, src);
+    return dst;
+}
+
+/**
+ * Draw a source image within a destination image.
+ *
+ * @param dst The destination image.
+ * @param src The source image.
+ * @param srcRect The source rectangle of what to draw from the source image.
+ * @param posX Where to draw the image on the x coordinate.
+ * @param posY Where to draw the image on the y coordinate.
+ *
+ * @see pntr_draw_image()
+ */
+PNTR_API void pntr_draw_image_rec(pntr_image* dst, pntr_image* src, pntr_rectangle srcRect, int posX, int posY) {
+    pntr_draw_image_tint_rec(dst, src, srcRect, posX, posY, PNTR_WHITE);
+}
+
+/**
+ * Draws a source image within a destination image, with tint, tinting through the given lookup tables.
+ *
+ * @param table The tint tables to use and build as needed, or NULL to only build them when enough pixels are drawn.
+ *
+ * @see pntr_draw_image_tint_rec()
+ * @internal
+ */
+static void _pntr_draw_image_tint_rec(pntr_image* dst, pntr_image* src, pntr_rectangle srcRect, int posX, int posY, pntr_color tint, _pntr_tint_table* table) {
+    if (dst == NULL || src == NULL || posX >= dst->clip.x + dst->clip.width || posY >= dst->clip.y + dst->clip.height) {
+        return;
+    }
+
+    // Make sure the source rectangle is within bounds.
+    if (!_pntr_rectangle_intersect(srcRect.x, srcRect.y,
+            srcRect.width <= 0 ? src->width : srcRect.width,
+            srcRect.height <= 0 ? src->height : srcRect.height,
+            0, 0,
+            src->width, src->height, &srcRect)) {
+        return;
+    }
+
+    // Update the source coordinates based on the destination
+    if (posX < dst->clip.x) {
+        srcRect.x -= posX - dst->clip.x;
+        srcRect.width += posX - dst->clip.x;
+        posX = dst->clip.x;
+    }
+    if (posY < dst->clip.y) {
+        srcRect.y -= posY - dst->clip.y;
+        srcRect.height += posY - dst->clip.y;
+        posY = dst->clip.y;
+    }
+
+    // Confine the destination.
+    pntr_rectangle dstRect = PNTR_CLITERAL(pntr_rectangle) { posX, posY, srcRect.width, srcRect.height };
+    if (!_pntr_rectangle_intersect(dstRect.x, dstRect.y,
+            srcRect.width,
+            srcRect.height,
+            dst->clip.x, dst->clip.y,
+            dst->clip.width, dst->clip.height, &dstRect)) {
+        return;
+    }
+
+    // Subimages rely on the opacity of the image they reference, which is only useful when the whole image is uniform.
+    pntr_opacity opacity = pntr_image_get_opacity(src->subimage ? src->parent : src);
+
+    // Nothing to draw from a fully transparent image, even when tinted.
+    if (opacity == PNTR_OPACITY_TRANSPARENT) {
+        return;
+    }
+
+    _pntr_image_modified(dst);
+
+    // Determine how many bits to skip for each line.
+    int dst_skip = dst->pitch >> 2;
+    int src_skip = src->pitch >> 2;
+
+    // Find the first pixel to render.
+    pntr_color *dstPixel = dst->data + dst_skip * dstRect.y + dstRect.x;
+    pntr_color *srcPixel = src->data + src_skip * srcRect.y + srcRect.x;
+
+    // Tinting a premultiplied color needs the tint to be premultiplied too.
+    if (src->premultiplied) {
+        tint = pntr_color_alpha_premultiply(tint);
+    }
+
+    // Opaque pixels are the same whether premultiplied or not, so they can be copied directly.
+    if (tint.value == PNTR_WHITE_VALUE && opacity == PNTR_OPACITY_OPAQUE) {
+        while (dstRect.height-- > 0) {
+            PNTR_MEMCPY(dstPixel, srcPixel, (size_t)dstRect.width * sizeof(pntr_color));
+
+            dstPixel += dst_skip;
+            srcPixel += src_skip;
+        }
+    }
+    else if (tint.value == PNTR_WHITE_VALUE && src->premultiplied == dst->premultiplied) {
+        while (dstRect.height-- > 0) {
+            _pntr_blend_image_row(dst, dstPixel, srcPixel, dstRect.width);
+
+            dstPixel += dst_skip;
+            srcPixel += src_skip;
+        }
+    }
+    else {
+        // Building the tint tables only pays off when enough pixels are tinted.
+        _pntr_tint_table localTable;
+        if (table == NULL && tint.value != PNTR_WHITE_VALUE && dstRect.width * dstRect.height >= 256) {
+            localTable.ready = false;
+            table = &localTable;
+        }
+        if (table != NULL && tint.value != PNTR_WHITE_VALUE) {
+            _pntr_tint_table_init(table, tint);
+        }
+
+        // Tint and convert a chunk of the row at a time, and then blend the chunk as a whole.
+        pntr_color tinted[64];
+        while (dstRect.height-- > 0) {
+            for (int x = 0; x < dstRect.width; x += 64) {
+                int chunk = PNTR_MIN(64, dstRect.width - x);
+                if (tint.value == PNTR_WHITE_VALUE) {
+                    PNTR_MEMCPY(tinted, srcPixel + x, (size_t)chunk * sizeof(pntr_color));
+                }
+                else if (table != NULL) {
+                    _pntr_color_map_row(tinted, srcPixel + x, chunk, table->r, table->g, table->b, table->a);
+                }
+                else {
+                    for (int i = 0; i < chunk; i++) {
+                        tinted[i] = pntr_color_tint(srcPixel[x + i], tint);
+                    }
+                }
+                if (src->premultiplied != dst->premultiplied) {
+                    for (int i = 0; i < chunk; i++) {
+                        tinted[i] = src->premultiplied ? pntr_color_alpha_unpremultiply(tinted[i]) : pntr_color_alpha_premultiply(tinted[i]);
+                    }
+                }
+                _pntr_blend_image_row(dst, dstPixel + x, tinted, chunk);
+            }
+
+            dstPixel += dst_skip;
+            srcPixel += src_skip;
+        }
+    }
+}
+
+/**
+ * Draw a source image within a destination image, with tint.
+ *
+ * @param dst The destination image.
+ * @param src The source image.
+ * @param srcRect The source rectangle of what to draw from the source image.
+ * @param posX Where to draw the image on the x coordinate.
+ * @param posY Where to draw the image on the y coordinate.
+ * @param tint The color to tint the image when drawing.
+ *
+ * @see pntr_draw_image()
+ */
+PNTR_API void pntr_draw_image_tint_rec(pntr_image* dst, pntr_image* src, pntr_rectangle srcRect, int posX, int posY, pntr_color tint) {
+    _pntr_draw_image_tint_rec(dst, src, srcRect, posX, posY, tint, NULL);
+}
+
+/**
+ * Compiles an image into a run-length encoded sprite.
+ *
+ * Each row is split into runs of transparent pixels, which are skipped, opaque pixels, which are copied, and
+ * translucent pixels, which are blended. The sprite no longer references the image once it is built.
+ *
+ * @param image The image to build the sprite from.
+ *
+ * @return The new sprite, which must be unloaded with pntr_unload_sprite_rle(). NULL on failure.
+ *
+ * @see pntr_draw_sprite_rle()
+ * @see pntr_unload_sprite_rle()
+ */
+PNTR_API pntr_sprite_rle* pntr_load_sprite_rle(pntr_image* image) {
+    if (image == NULL) {
+        return (pntr_sprite_rle*)pntr_set_error(PNTR_ERROR_INVALID_ARGS);
+    }
+
+    // Count the runs and visible pixels first, so that everything is allocated once.
+    int runsCount = 0;
+    int pixelsCount = 0;
+    for (int y = 0; y < image->height; y++) {
+        pntr_color* pixel = &PNTR_PIXEL(image, 0, y);
+        for (int x = 0; x < image->width; x++) {
+            if (pixel[x].rgba.a == 0) {
+                continue;
+            }
+            if (x == 0 || pixel[x - 1].rgba.a == 0 || (pixel[x - 1].rgba.a == 255) != (pixel[x].rgba.a == 255)) {
+                runsCount++;
+            }
+            pixelsCount++;
+        }
     }
 
-    int i = 0;
-    // Big numbers to find the max/min values
-    int left = points[0].x, top = points[0].y, bottom = points[0].y, right = points[0].x;
-    int nodes, pixelX, pixelY, j, swap;
-    int* nodeX = (int*)PNTR_MALLOC(sizeof(int) * (size_t)numPoints);
-    if (nodeX == NULL) {
-        return;
+    pntr_sprite_rle* sprite = (pntr_sprite_rle*)PNTR_MALLOC(sizeof(pntr_sprite_rle));
+    if (sprite == NULL) {
+        return (pntr_sprite_rle*)pntr_set_error(PNTR_ERROR_NO_MEMORY);
     }
 
-    // Get polygon dimensions
-    for (i = 0; i < numPoints; i++) {
-        if (left > points[i].x)
-            left = points[i].x;
-        if (right < points[i].x)
-            right = points[i].x;
-        if (top > points[i].y)
-            top = points[i].y;
-        if (bottom < points[i].y)
-            bottom = points[i].y;
+    sprite->width = image->width;
+    sprite->height = image->height;
+    sprite->premultiplied = image->premultiplied;
+    sprite->rows = (int*)PNTR_MALLOC(sizeof(int) * (size_t)(image->height + 1));
+    sprite->runs = (pntr_sprite_rle_run*)PNTR_MALLOC(sizeof(pntr_sprite_rle_run) * (size_t)PNTR_MAX(runsCount, 1));
+    sprite->pixels = (pntr_color*)PNTR_MALLOC(sizeof(pntr_color) * (size_t)PNTR_MAX(pixelsCount, 1));
+    if (sprite->rows == NULL || sprite->runs == NULL || sprite->pixels == NULL) {
+        pntr_unload_sprite_rle(sprite);
+        return (pntr_sprite_rle*)pntr_set_error(PNTR_ERROR_NO_MEMORY);
     }
-    bottom++;
-    right++;
-
-    // Polygon scanline algorithm released under public-domain by Darel Rex Finley, 2007.
-    // Loop through the rows of the image.
-    for (pixelY = top; pixelY < bottom; pixelY ++) {
-        nodes = 0; /*  Build a list of nodes. */
-        j = numPoints - 1;
-        for (i = 0; i < numPoints; i++) {
-            if (((points[i].y < pixelY) && (points[j].y >= pixelY)) ||
-                ((points[j].y < pixelY) && (points[i].y >= pixelY))) {
-                nodeX[nodes++]= (int)((float)points[i].x
-                     + ((float)pixelY - (float)points[i].y) / ((float)points[j].y - (float)points[i].y)
-                     * ((float)points[j].x - (float)points[i].x));
-            } j = i;
-        }
 
-        // Sort the nodes, via a simple “Bubble” sort.
-        i = 0;
-        while (i < nodes - 1) {
-            if (nodeX[i] > nodeX[i+1]) {
-                swap = nodeX[i];
-                nodeX[i] = nodeX[i+1];
-                nodeX[i+1] = swap;
-                if (i) i--;
-            } else i++;
-        }
-        // Fill the pixels between node pairs.
-        for (i = 0; i < nodes; i += 2) {
-            if (nodeX[i+0] >= right) break;
-            if (nodeX[i+1] > left) {
-                if (nodeX[i+0] < left) nodeX[i+0] = left ;
-                if (nodeX[i+1] > right) nodeX[i+1] = right;
-                for (pixelX = nodeX[i]; pixelX < nodeX[i + 1]; pixelX++)
-                    pntr_draw_point(dst, pixelX, pixelY, color);
+    pntr_sprite_rle_run* run = NULL;
+    int runIndex = 0;
+    int pixelIndex = 0;
+    for (int y = 0; y < image->height; y++) {
+        sprite->rows[y] = runIndex;
+        pntr_color* pixel = &PNTR_PIXEL(image, 0, y);
+        for (int x = 0; x < image->width; x++) {
+            if (pixel[x].rgba.a == 0) {
+                continue;
             }
+            if (x == 0 || pixel[x - 1].rgba.a == 0 || (pixel[x - 1].rgba.a == 255) != (pixel[x].rgba.a == 255)) {
+                run = &sprite->runs[runIndex++];
+                run->x = x;
+                run->length = 0;
+                run->offset = pixelIndex;
+                run->opaque = pixel[x].rgba.a == 255;
+            }
+            run->length++;
+            sprite->pixels[pixelIndex++] = pixel[x];
         }
     }
+    sprite->rows[image->height] = runIndex;
 
-    PNTR_FREE(nodeX);
+    return sprite;
 }
 
 /**
- * Draw a filled triangle using vectors.
+ * Unloads the given run-length encoded sprite from memory.
  *
- * @param dst Where to draw the triangle.
- * @param point1 The first point in the triangle.
- * @param point2 The second point in the triangle.
- * @param point3 The third point in the triangle.
- * @param color What color to draw the triangle.
+ * @param sprite The sprite to unload.
+ *
+ * @see pntr_load_sprite_rle()
  */
-PNTR_API void pntr_draw_triangle_fill_vec(pntr_image* dst, pntr_vector point1, pntr_vector point2, pntr_vector point3, pntr_color color) {
-    pntr_vector points[3];
-    points[0] = point1;
-    points[1] = point2;
-    points[2] = point3;
-    pntr_draw_polygon_fill(dst, points, 3, color);
-}
-
-PNTR_API void pntr_draw_arc(pntr_image* dst, int centerX, int centerY, float radius, float startAngle, float endAngle, int segments, pntr_color color) {
-    if (radius <= 0.0f) {
-        pntr_draw_point(dst, centerX, centerY, color);
-        return;
-    }
-    if (segments <= 0) {
+PNTR_API void pntr_unload_sprite_rle(pntr_sprite_rle* sprite) {
+    if (sprite == NULL) {
         return;
     }
 
-    float startAngleRad = startAngle * PNTR_PI / 180.0f;
-    float endAngleRad = endAngle * PNTR_PI / 180.0f;
-
-    // Calculate how much distance between each segment
-    float stepAngle = (endAngleRad - startAngleRad) / (float)(segments);
-
-    // Draw the arc with line segments
-    /*
-    int x1 = centerX + (int)((float)radius * PNTR_COSF(startAngleRad));
-    int y1 = centerY + (int)((float)radius * PNTR_SINF(startAngleRad));
-    float angle;
-    for (int i = 1; i < segments; i++) {
-        angle = startAngleRad + (float)i * stepAngle;
-        int x2 = centerX + (int)((float)radius * PNTR_COSF(angle));
-        int y2 = centerY + (int)((float)radius * PNTR_SINF(angle));
-        pntr_draw_line(dst, x1, y1, x2, y2, color);
-        x1 = x2;
-        y1 = y2;
-    }
-    */
-
-    // Draw each line segment
-    for (int i = 0; i < segments; i++) {
-        endAngleRad = startAngleRad + (float)i * stepAngle;
-        pntr_draw_point(dst,
-            centerX + (int)(radius * PNTR_COSF(endAngleRad)), // TODO: arc angle: Is the - correct here?
-            centerY + (int)(radius * PNTR_SINF(endAngleRad)),
-            color);
-    }
+    PNTR_FREE(sprite->rows);
+    PNTR_FREE(sprite->runs);
+    PNTR_FREE(sprite->pixels);
+    PNTR_FREE(sprite);
 }
 
-PNTR_API void pntr_draw_arc_thick(pntr_image* dst, int centerX, int centerY, float radius, float startAngle, float endAngle, int segments, int thickness, pntr_color color) {
-    if (radius <= 0.0f) {
-        pntr_draw_point(dst, centerX, centerY, color);
+/**
+ * Draws a run-length encoded sprite onto the destination image, respecting its clip.
+ *
+ * Transparent pixels are skipped entirely, opaque runs are copied, and only translucent runs are blended.
+ *
+ * @param dst The destination image.
+ * @param sprite The sprite to draw.
+ * @param posX Where to draw the sprite on the x coordinate.
+ * @param posY Where to draw the sprite on the y coordinate.
+ *
+ * @see pntr_load_sprite_rle()
+ * @see pntr_draw_image()
+ */
+PNTR_API void pntr_draw_sprite_rle(pntr_image* dst, pntr_sprite_rle* sprite, int posX, int posY) {
+    if (dst == NULL || sprite == NULL) {
         return;
     }
-    if (segments <= 0) {
+
+    pntr_rectangle dstRect;
+    if (!_pntr_rectangle_intersect(posX, posY, sprite->width, sprite->height, dst->clip.x, dst->clip.y, dst->clip.width, dst->clip.height, &dstRect)) {
         return;
     }
 
-    float startAngleRad = startAngle * PNTR_PI / 180.0f;
-    float endAngleRad = endAngle * PNTR_PI / 180.0f;
+    _pntr_image_modified(dst);
 
-    // Calculate how much distance between each segment
-    float stepAngle = (endAngleRad - startAngleRad) / (float)(segments);
+    int clipLeft = dstRect.x - posX;
+    int clipRight = clipLeft + dstRect.width;
+    pntr_color converted[64];
+    for (int y = dstRect.y - posY; y < dstRect.y - posY + dstRect.height; y++) {
+        pntr_color* row = &PNTR_PIXEL(dst, 0, posY + y);
+        for (int i = sprite->rows[y]; i < sprite->rows[y + 1]; i++) {
+            pntr_sprite_rle_run* run = &sprite->runs[i];
 
-    // Draw the arc with line segments
-    int x1 = centerX + (int)((float)radius * PNTR_COSF(startAngleRad));
-    int y1 = centerY + (int)((float)radius * PNTR_SINF(startAngleRad));
-    float angle;
-    for (int i = 1; i < segments; i++) {
-        angle = startAngleRad + (float)i * stepAngle;
-        int x2 = centerX + (int)((float)radius * PNTR_COSF(angle));
-        int y2 = centerY + (int)((float)radius * PNTR_SINF(angle));
-        pntr_draw_line_thick(dst, x1, y1, x2, y2, thickness, color);
-        x1 = x2;
-        y1 = y2;
-    }
-}
+            // Confine the run to the clip.
+            int start = PNTR_MAX(run->x, clipLeft);
+            int end = PNTR_MIN(run->x + run->length, clipRight);
+            if (start >= end) {
+                continue;
+            }
 
-PNTR_API void pntr_draw_arc_fill(pntr_image* dst, int centerX, int centerY, float radius, float startAngle, float endAngle, int segments, pntr_color color) {
-    if (radius <= 0.0f) {
-        pntr_draw_point(dst, centerX, centerY, color);
-        return;
-    }
-    if (segments <= 0) {
-        return;
+            pntr_color* src = &sprite->pixels[run->offset + start - run->x];
+            if (run->opaque) {
+                PNTR_MEMCPY(row + posX + start, src, (size_t)(end - start) * sizeof(pntr_color));
+            }
+            else if (sprite->premultiplied == dst->premultiplied) {
+                _pntr_blend_image_row(dst, row + posX + start, src, end - start);
+            }
+            else {
+                for (int x = start; x < end; x += 64) {
+                    int chunk = PNTR_MIN(64, end - x);
+                    for (int j = 0; j < chunk; j++) {
+                        converted[j] = sprite->premultiplied ? pntr_color_alpha_unpremultiply(src[x - start + j]) : pntr_color_alpha_premultiply(src[x - start + j]);
+                    }
+                    _pntr_blend_image_row(dst, row + posX + x, converted, chunk);
+                }
+            }
+        }
     }
-    float startAngleRad = startAngle * PNTR_PI / 180.0f;
-    float endAngleRad = endAngle * PNTR_PI / 180.0f;
-
-    // Calculate how much distance between each segment
-    float stepAngle = (endAngleRad - startAngleRad) / (float)segments;
-    pntr_vector* points = (pntr_vector*)PNTR_MALLOC(sizeof(pntr_vector) * (size_t)segments + (size_t)1);
+}
 
-    // TODO: pntr_draw_arc_fill(): Is pntr_draw_polygon_fill ample here?
-    for (int i = 0; i < segments; i++) {
-        endAngleRad = startAngleRad + (float)i * stepAngle;
-        points[i].x = centerX + (int)(radius * PNTR_COSF(endAngleRad));
-        points[i].y = centerY + (int)(radius * PNTR_SINF(endAngleRad));
+/**
+ * Gets the byte order of a 32-bit pixel format, as the index of the red, green, blue and alpha bytes.
+ *
+ * @return True if the pixel format has 32-bit pixels, false otherwise.
+ *
+ * @internal
+ */
+static bool _pntr_pixelformat_channels(pntr_pixelformat pixelFormat, int* channels) {
+    switch (pixelFormat) {
+        case PNTR_PIXELFORMAT_RGBA8888:
+            channels[0] = 0; channels[1] = 1; channels[2] = 2; channels[3] = 3;
+            return true;
+        case PNTR_PIXELFORMAT_ARGB8888:
+            channels[0] = 1; channels[1] = 2; channels[2] = 3; channels[3] = 0;
+            return true;
+        case PNTR_PIXELFORMAT_BGRA8888:
+            channels[0] = 2; channels[1] = 1; channels[2] = 0; channels[3] = 3;
+            return true;
+        default:
+            return false;
     }
-
-    points[segments].x = centerX;
-    points[segments].y = centerY;
-
-    pntr_draw_polygon_fill(dst, points, segments + 1, color);
-    pntr_unload_memory((void*)points);
 }
 
-PNTR_API void pntr_draw_rectangle_rounded(pntr_image* dst, int x, int y, int width, int height, int topLeftRadius, int topRightRadius, int bottomLeftRadius, int bottomRightRadius, pntr_color color) {
-    if (topLeftRadius == 0 && topRightRadius == 0 && bottomLeftRadius == 0 && bottomRightRadius == 0) {
-        pntr_draw_rectangle(dst, x, y, width, height, color);
-        return;
+/**
+ * Builds the byte shuffle that converts pntr_color pixels to a 32-bit pixel format, or back.
+ *
+ * Each entry of the shuffle is the index of the source byte for that destination byte.
+ *
+ * @internal
+ */
+static bool _pntr_pixelformat_shuffle(pntr_pixelformat pixelFormat, bool toPixelFormat, int* shuffle) {
+    int channels[4];
+    if (!_pntr_pixelformat_channels(pixelFormat, channels)) {
+        return false;
     }
 
-    pntr_draw_line_horizontal(dst, x + topLeftRadius, y, width - topLeftRadius - topRightRadius, color); // Top
-    pntr_draw_line_horizontal(dst, x + bottomLeftRadius, y + height, width - bottomLeftRadius - bottomRightRadius - 1, color); // Bottom
-    pntr_draw_line_vertical(dst, x, y + topLeftRadius, height - topLeftRadius - bottomLeftRadius, color); // Left
-    pntr_draw_line_vertical(dst, x + width - 1, y + topRightRadius, height - topRightRadius - bottomRightRadius, color); // Right
+    // Find where pntr_color keeps each channel in memory.
+    pntr_color probe = PNTR_NEW_COLOR(0, 1, 2, 3);
+    unsigned char* bytes = (unsigned char*)&probe;
+    for (int i = 0; i < 4; i++) {
+        if (toPixelFormat) {
+            shuffle[channels[bytes[i]]] = i;
+        }
+        else {
+            shuffle[i] = channels[bytes[i]];
+        }
+    }
 
-    // TODO: pntr_draw_rectangle_rounded(): Do the angles here make sense?
-    pntr_draw_arc(dst, x + topLeftRadius, y + topLeftRadius, (float)topLeftRadius, 180.0f, 270.0f, topLeftRadius * 2, color); // Top Left
-    pntr_draw_arc(dst, x + width - topRightRadius - 1, y + topRightRadius, (float)topRightRadius, 0.0f, -90.0f, topRightRadius * 2, color); // Top Right
-    pntr_draw_arc(dst, x + bottomLeftRadius, y + height - bottomLeftRadius, (float)bottomLeftRadius, -180.0f, -270.0f, bottomLeftRadius * 2, color); // Bottom Left
-    pntr_draw_arc(dst, x + width - bottomRightRadius - 1, y + height - bottomRightRadius, (float)bottomRightRadius, 0.0f, 90.0f, bottomRightRadius * 2, color); // Bottom Right
+    return true;
 }
 
-PNTR_API void pntr_draw_rectangle_thick_rounded(pntr_image* dst, int x, int y, int width, int height, int topLeftRadius, int topRightRadius, int bottomLeftRadius, int bottomRightRadius, int thickness, pntr_color color) {
-    if (thickness < 1) {
-        return;
+#if defined(PNTR_SIMD_SSE2) || defined(PNTR_SIMD_AVX2)
+/**
+ * The byte shuffles of 32-bit pixels that can be done with shifts.
+ *
+ * @internal
+ */
+typedef enum _pntr_shuffle_kind {
+    _PNTR_SHUFFLE_OTHER = 0,
+    _PNTR_SHUFFLE_SWAP_RB, // Bytes 0 and 2 trade places.
+    _PNTR_SHUFFLE_ROTATE_LEFT, // Every byte moves up one place.
+    _PNTR_SHUFFLE_ROTATE_RIGHT, // Every byte moves down one place.
+    _PNTR_SHUFFLE_REVERSE // The bytes are reversed.
+} _pntr_shuffle_kind;
+
+/**
+ * Gets which kind of shift based shuffle matches the given byte shuffle.
+ *
+ * @internal
+ */
+static _pntr_shuffle_kind _pntr_shuffle_get_kind(const int* shuffle) {
+    if (shuffle[0] == 2 && shuffle[1] == 1 && shuffle[2] == 0 && shuffle[3] == 3) {
+        return _PNTR_SHUFFLE_SWAP_RB;
     }
-    for (int i = 0; i < thickness; i++) {
-        pntr_draw_rectangle_rounded(dst,
-            x + i, y + i, width - i * 2, height - i * 2,
-            topLeftRadius - i > 0 ? topLeftRadius - i : 0,
-            topRightRadius - i > 0 ? topRightRadius - i : 0,
-            bottomLeftRadius - i > 0 ? bottomLeftRadius - i : 0,
-            bottomRightRadius - i > 0 ? bottomRightRadius - i : 0,
-            color);
+    if (shuffle[0] == 3 && shuffle[1] == 0 && shuffle[2] == 1 && shuffle[3] == 2) {
+        return _PNTR_SHUFFLE_ROTATE_LEFT;
+    }
+    if (shuffle[0] == 1 && shuffle[1] == 2 && shuffle[2] == 3 && shuffle[3] == 0) {
+        return _PNTR_SHUFFLE_ROTATE_RIGHT;
+    }
+    if (shuffle[0] == 3 && shuffle[1] == 2 && shuffle[2] == 1 && shuffle[3] == 0) {
+        return _PNTR_SHUFFLE_REVERSE;
     }
+    return _PNTR_SHUFFLE_OTHER;
 }
+#endif
 
-PNTR_API void pntr_draw_rectangle_rounded_fill(pntr_image* dst, int x, int y, int width, int height, int cornerRadius, pntr_color color) {
-    if (cornerRadius == 0) {
-        pntr_draw_rectangle_fill(dst, x, y, width, height, color);
-        return;
+#if defined(PNTR_SIMD_SSE2)
+/**
+ * Shuffles the bytes of four 32-bit pixels, as little-endian integers.
+ *
+ * @internal
+ */
+static __m128i _pntr_shuffle_sse2(__m128i pixels, _pntr_shuffle_kind kind) {
+    switch (kind) {
+        case _PNTR_SHUFFLE_SWAP_RB:
+            return _mm_or_si128(
+                _mm_and_si128(pixels, _mm_set1_epi32((int)0xFF00FF00)),
+                _mm_or_si128(
+                    _mm_and_si128(_mm_srli_epi32(pixels, 16), _mm_set1_epi32(0xFF)),
+                    _mm_slli_epi32(_mm_and_si128(pixels, _mm_set1_epi32(0xFF)), 16)));
+        case _PNTR_SHUFFLE_ROTATE_LEFT:
+            return _mm_or_si128(_mm_slli_epi32(pixels, 8), _mm_srli_epi32(pixels, 24));
+        case _PNTR_SHUFFLE_ROTATE_RIGHT:
+            return _mm_or_si128(_mm_srli_epi32(pixels, 8), _mm_slli_epi32(pixels, 24));
+        default:
+            return _mm_or_si128(
+                _mm_or_si128(_mm_slli_epi32(pixels, 24), _mm_srli_epi32(pixels, 24)),
+                _mm_or_si128(
+                    _mm_and_si128(_mm_slli_epi32(pixels, 8), _mm_set1_epi32(0x00FF0000)),
+                    _mm_and_si128(_mm_srli_epi32(pixels, 8), _mm_set1_epi32(0x0000FF00))));
     }
-
-    // Corners
-    // TODO: Replace this with pntr_draw_arc_fill()
-    pntr_draw_circle_fill(dst, x + cornerRadius, y + cornerRadius, cornerRadius, color); // Top Left
-    pntr_draw_circle_fill(dst, x + width - cornerRadius - 1, y + cornerRadius, cornerRadius, color); // Top Right
-    pntr_draw_circle_fill(dst, x + cornerRadius, y + height - cornerRadius, cornerRadius, color); // Bottom Left
-    pntr_draw_circle_fill(dst, x + width - cornerRadius - 1, y + height - cornerRadius, cornerRadius, color); // Bottom Right
-
-    // Edge bars
-    pntr_draw_rectangle_fill(dst, x, y + cornerRadius, cornerRadius, height - cornerRadius * 2, color); // Left bar
-    pntr_draw_rectangle_fill(dst, x + width - cornerRadius - 1, y + cornerRadius, cornerRadius, height - cornerRadius * 2, color); // Right bar
-    pntr_draw_rectangle_fill(dst, x + cornerRadius, y, width - cornerRadius * 2, cornerRadius, color); // Top bar
-    pntr_draw_rectangle_fill(dst, x + cornerRadius, y + height - cornerRadius, width - cornerRadius * 2, cornerRadius, color); // Bottom bar
-
-    // Center fill
-    pntr_draw_rectangle_fill(dst, x + cornerRadius, y + cornerRadius, width - cornerRadius * 2, height - cornerRadius * 2, color);
 }
+#endif
 
+#if defined(PNTR_SIMD_AVX2)
 /**
- * Get image pixel color at (x, y) position.
- *
- * @param image The image to get the color from.
- * @param x The x position of the pixel.
- * @param y The y position of the pixel.
+ * Shuffles the bytes of eight 32-bit pixels, as little-endian integers.
  *
- * @return The color at (x, y) position from the image.
+ * @internal
  */
-PNTR_API pntr_color pntr_image_get_color(pntr_image* image, int x, int y) {
-    if (image == NULL || x < 0 || y < 0 || x >= image->width || y >= image->height) {
-        return PNTR_BLANK;
+static __m256i _pntr_shuffle_avx2(__m256i pixels, _pntr_shuffle_kind kind) {
+    switch (kind) {
+        case _PNTR_SHUFFLE_SWAP_RB:
+            return _mm256_or_si256(
+                _mm256_and_si256(pixels, _mm256_set1_epi32((int)0xFF00FF00)),
+                _mm256_or_si256(
+                    _mm256_and_si256(_mm256_srli_epi32(pixels, 16), _mm256_set1_epi32(0xFF)),
+                    _mm256_slli_epi32(_mm256_and_si256(pixels, _mm256_set1_epi32(0xFF)), 16)));
+        case _PNTR_SHUFFLE_ROTATE_LEFT:
+            return _mm256_or_si256(_mm256_slli_epi32(pixels, 8), _mm256_srli_epi32(pixels, 24));
+        case _PNTR_SHUFFLE_ROTATE_RIGHT:
+            return _mm256_or_si256(_mm256_srli_epi32(pixels, 8), _mm256_slli_epi32(pixels, 24));
+        default:
+            return _mm256_or_si256(
+                _mm256_or_si256(_mm256_slli_epi32(pixels, 24), _mm256_srli_epi32(pixels, 24)),
+                _mm256_or_si256(
+                    _mm256_and_si256(_mm256_slli_epi32(pixels, 8), _mm256_set1_epi32(0x00FF0000)),
+                    _mm256_and_si256(_mm256_srli_epi32(pixels, 8), _mm256_set1_epi32(0x0000FF00))));
     }
-
-    return PNTR_PIXEL(image, x, y);
 }
+#endif
 
 /**
- * Get the file type of the given image, based on its filename.
+ * Shuffles the bytes of a row of 32-bit pixels.
  *
- * @param filePath The file path to the image.
- *
- * @return The type of the image, based on its file extension, or `PNTR_IMAGE_TYPE_UNKNOWN` if it's unknown.
+ * @param shuffle The index of the source byte for each destination byte.
  *
- * @see PNTR_IMAGE_TYPE_UNKNOWN
- * @see PNTR_IMAGE_TYPE_PNG
- * @see PNTR_IMAGE_TYPE_BMP
- * @see PNTR_IMAGE_TYPE_JPG
+ * @internal
  */
-PNTR_API pntr_image_type pntr_get_file_image_type(const char* filePath) {
-    if (filePath == NULL) {
-        return PNTR_IMAGE_TYPE_UNKNOWN;
+static void _pntr_shuffle_row(unsigned char* dst, const unsigned char* src, int width, const int* shuffle) {
+    if (shuffle[0] == 0 && shuffle[1] == 1 && shuffle[2] == 2 && shuffle[3] == 3) {
+        PNTR_MEMCPY(dst, (void*)src, (size_t)width * 4);
+        return;
     }
 
-    if (PNTR_STRSTR(filePath, ".png") != NULL || PNTR_STRSTR(filePath, ".PNG") != NULL) {
-        return PNTR_IMAGE_TYPE_PNG;
-    }
+    int x = 0;
 
-    if (PNTR_STRSTR(filePath, ".bmp") != NULL || PNTR_STRSTR(filePath, ".BMP") != NULL) {
-        return PNTR_IMAGE_TYPE_BMP;
+    #if defined(PNTR_SIMD_SSE2)
+    _pntr_shuffle_kind kind = _pntr_shuffle_get_kind(shuffle);
+    if (kind != _PNTR_SHUFFLE_OTHER) {
+        #if defined(PNTR_SIMD_AVX2)
+        for (; x + 8 <= width; x += 8) {
+            __m256i pixels = _mm256_loadu_si256((const __m256i*)(const void*)(src + x * 4));
+            _mm256_storeu_si256((__m256i*)(void*)(dst + x * 4), _pntr_shuffle_avx2(pixels, kind));
+        }
+        #endif
+        for (; x + 4 <= width; x += 4) {
+            __m128i pixels = _mm_loadu_si128((const __m128i*)(const void*)(src + x * 4));
+            _mm_storeu_si128((__m128i*)(void*)(dst + x * 4), _pntr_shuffle_sse2(pixels, kind));
+        }
     }
-
-    if (PNTR_STRSTR(filePath, ".jpg") != NULL || PNTR_STRSTR(filePath, ".jpeg") != NULL || PNTR_STRSTR(filePath, ".JPG") != NULL || PNTR_STRSTR(filePath, ".JPEG") != NULL) {
-        return PNTR_IMAGE_TYPE_JPG;
+    #elif defined(PNTR_SIMD_NEON)
+    for (; x + 16 <= width; x += 16) {
+        uint8x16x4_t pixels = vld4q_u8(src + x * 4);
+        uint8x16x4_t shuffled;
+        shuffled.val[0] = pixels.val[shuffle[0]];
+        shuffled.val[1] = pixels.val[shuffle[1]];
+        shuffled.val[2] = pixels.val[shuffle[2]];
+        shuffled.val[3] = pixels.val[shuffle[3]];
+        vst4q_u8(dst + x * 4, shuffled);
     }
+    #endif
 
-    return PNTR_IMAGE_TYPE_UNKNOWN;
+    for (; x < width; x++) {
+        const unsigned char* pixel = src + x * 4;
+        unsigned char* output = dst + x * 4;
+        unsigned char b0 = pixel[shuffle[0]];
+        unsigned char b1 = pixel[shuffle[1]];
+        unsigned char b2 = pixel[shuffle[2]];
+        unsigned char b3 = pixel[shuffle[3]];
+        output[0] = b0;
+        output[1] = b1;
+        output[2] = b2;
+        output[3] = b3;
+    }
 }
 
-// Load stb_image or cute_png.
-#ifndef PNTR_LOAD_IMAGE_FROM_MEMORY
-    #ifdef PNTR_STB_IMAGE
-        #include "extensions/pntr_stb_image.h"
-    #elif defined(PNTR_CUTE_PNG)
-        #include "extensions/pntr_cute_png.h"
-    #else
-        // Allow disabling image loading.
-        #ifdef PNTR_NO_LOAD_IMAGE
-            #define PNTR_LOAD_IMAGE_FROM_MEMORY(type, fileData, dataSize) NULL
-        #else
-            // Default to stb_image.
-            #include "extensions/pntr_stb_image.h"
-        #endif
-    #endif
-#endif
+/**
+ * Converts a row of pixel data in the given pixel format to colors.
+ *
+ * @internal
+ */
+static void _pntr_pixelformat_row_from(pntr_color* dst, const void* src, int width, pntr_pixelformat pixelFormat) {
+    const unsigned char* source = (const unsigned char*)src;
 
-#ifndef PNTR_SAVE_IMAGE_TO_MEMORY
-    #ifdef PNTR_STB_IMAGE
-        #include "extensions/pntr_stb_image_write.h"
-    #elif defined(PNTR_CUTE_PNG)
-        #include "extensions/pntr_cute_png.h"
-    #else
-        // Allow disabling image saving.
-        #ifdef PNTR_NO_SAVE_IMAGE
-            #define PNTR_SAVE_IMAGE_TO_MEMORY(image, type, dataSize) NULL
-        #else
-            // Default to stb_image_write.
-            #include "extensions/pntr_stb_image_write.h"
-        #endif
-    #endif
-#endif
+    // The application's pixel format is the same as pntr_color in memory.
+    if (pixelFormat == PNTR_PIXELFORMAT) {
+        PNTR_MEMCPY(dst, (void*)source, (size_t)width * sizeof(pntr_color));
+        return;
+    }
+
+    int shuffle[4];
+    if (_pntr_pixelformat_shuffle(pixelFormat, false, shuffle)) {
+        _pntr_shuffle_row((unsigned char*)dst, source, width, shuffle);
+        return;
+    }
+
+    switch (pixelFormat) {
+        case PNTR_PIXELFORMAT_GRAYSCALE:
+        case PNTR_PIXELFORMAT_A8:
+            // White, with alpha determining grayscale value. Use tint to change color afterwards.
+            for (int x = 0; x < width; x++) {
+                dst[x] = PNTR_NEW_COLOR(255, 255, 255, source[x]);
+            }
+            break;
+        case PNTR_PIXELFORMAT_RGB565:
+            // Read each value a byte at a time, as rows of buffers may not be aligned to 16 bits.
+            for (int x = 0; x < width; x++) {
+                unsigned int value = (unsigned int)source[x * 2] | ((unsigned int)source[x * 2 + 1] << 8);
+                unsigned int r = (value >> 11) & 0x1F;
+                unsigned int g = (value >> 5) & 0x3F;
+                unsigned int b = value & 0x1F;
+                dst[x] = PNTR_NEW_COLOR((unsigned char)((r << 3) | (r >> 2)), (unsigned char)((g << 2) | (g >> 4)), (unsigned char)((b << 3) | (b >> 2)), 255);
+            }
+            break;
+        case PNTR_PIXELFORMAT_RGB888:
+            for (int x = 0; x < width; x++) {
+                dst[x] = PNTR_NEW_COLOR(source[x * 3], source[x * 3 + 1], source[x * 3 + 2], 255);
+            }
+            break;
+        default:
+            for (int x = 0; x < width; x++) {
+                dst[x] = PNTR_BLANK;
+            }
+            break;
+    }
+}
 
 /**
- * Load an image from memory buffer.
- *
- * @note This can be overloaded by defining \c PNTR_LOAD_IMAGE_FROM_MEMORY .
- *
- * @param type The type of image to load.
- * @param fileData The data of the file to be loaded.
- * @param dataSize The size of the file data.
- *
- * @return A newly loaded image, or NULL on failure.
+ * Converts a row of colors to pixel data in the given pixel format.
  *
- * @see PNTR_LOAD_IMAGE_FROM_MEMORY
- * @see PNTR_NO_LOAD_IMAGE
+ * @internal
  */
-PNTR_API pntr_image* pntr_load_image_from_memory(pntr_image_type type, const unsigned char *fileData, unsigned int dataSize) {
-    if (fileData == NULL || dataSize == 0) {
-        return (pntr_image*)pntr_set_error(PNTR_ERROR_INVALID_ARGS);
+static void _pntr_pixelformat_row_to(void* dst, const pntr_color* src, int width, pntr_pixelformat pixelFormat) {
+    unsigned char* output = (unsigned char*)dst;
+
+    // The application's pixel format is the same as pntr_color in memory.
+    if (pixelFormat == PNTR_PIXELFORMAT) {
+        PNTR_MEMCPY(output, (void*)src, (size_t)width * sizeof(pntr_color));
+        return;
     }
 
-    return PNTR_LOAD_IMAGE_FROM_MEMORY(type, fileData, dataSize);
+    int shuffle[4];
+    if (_pntr_pixelformat_shuffle(pixelFormat, true, shuffle)) {
+        _pntr_shuffle_row(output, (const unsigned char*)src, width, shuffle);
+        return;
+    }
+
+    switch (pixelFormat) {
+        case PNTR_PIXELFORMAT_GRAYSCALE:
+            for (int x = 0; x < width; x++) {
+                float r = (float)src[x].rgba.r / 255.0f;
+                float g = (float)src[x].rgba.g / 255.0f;
+                float b = (float)src[x].rgba.b / 255.0f;
+                output[x] = (unsigned char)((r * 0.299f + g * 0.587f + b * 0.114f) * 255.0f);
+            }
+            break;
+        case PNTR_PIXELFORMAT_A8:
+            for (int x = 0; x < width; x++) {
+                output[x] = src[x].rgba.a;
+            }
+            break;
+        case PNTR_PIXELFORMAT_RGB565:
+            // Write each value a byte at a time, as rows of buffers may not be aligned to 16 bits.
+            for (int x = 0; x < width; x++) {
+                unsigned int value = ((unsigned int)(src[x].rgba.r >> 3) << 11) | ((unsigned int)(src[x].rgba.g >> 2) << 5) | (unsigned int)(src[x].rgba.b >> 3);
+                output[x * 2] = (unsigned char)(value & 0xFF);
+                output[x * 2 + 1] = (unsigned char)(value >> 8);
+            }
+            break;
+        case PNTR_PIXELFORMAT_RGB888:
+            for (int x = 0; x < width; x++) {
+                output[x * 3] = src[x].rgba.r;
+                output[x * 3 + 1] = src[x].rgba.g;
+                output[x * 3 + 2] = src[x].rgba.b;
+            }
+            break;
+        default:
+            break;
+    }
 }
 
 /**
- * Load an image from file.
- *
- * @param fileName The name of the file to load from the file system.
- *
- * @return The newly loaded file.
+ * Creates a new image from the given image data, optionally premultiplying its alpha.
  *
- * @see PNTR_NO_LOAD_IMAGE
+ * @see pntr_image_from_pixelformat()
+ * @see pntr_image_from_pixelformat_premultiplied()
+ * @internal
  */
-PNTR_API pntr_image* pntr_load_image(const char* fileName) {
-    if (fileName == NULL) {
+static pntr_image* _pntr_image_from_pixelformat(const void* imageData, int width, int height, pntr_pixelformat pixelFormat, bool premultiply) {
+    if (imageData == NULL || width <= 0 || height <= 0 || pixelFormat < 0 || pixelFormat > PNTR_PIXELFORMAT_A8) {
         return (pntr_image*)pntr_set_error(PNTR_ERROR_INVALID_ARGS);
     }
 
-    unsigned int bytesRead;
-    const unsigned char* fileData = pntr_load_file(fileName, &bytesRead);
-    if (fileData == NULL) {
-        return (pntr_image*)pntr_set_error(PNTR_ERROR_FAILED_TO_OPEN);
+    pntr_image* output = pntr_new_image(width, height);
+    if (output == NULL) {
+        return NULL;
     }
+    output->premultiplied = premultiply;
 
-    pntr_image_type type = pntr_get_file_image_type(fileName);
-    pntr_image* output = pntr_load_image_from_memory(type, fileData, bytesRead);
-    pntr_unload_file((unsigned char*)fileData);
+    pntr_image_from_pixelformat_buffer(output, imageData, 0, pixelFormat);
 
     return output;
 }
 
 /**
- * Draw an image onto the destination image, with tint.
+ * Replaces the pixels of an image with the given image data, without allocating any memory.
  *
- * @param dst The destination image where the source image will be drawn.
- * @param src The source image to be drawn.
- * @param posX The x-coordinate of the position where the source image will be drawn.
- * @param posY The y-coordinate of the position where the source image will be drawn.
- * @param tint The color to tint the image when drawing.
+ * The data must cover the whole image. Premultiplied images have their alpha premultiplied while converting.
+ *
+ * @param image The image to fill.
+ * @param buffer The image data in memory.
+ * @param stride The amount of bytes between each row of the data. Use 0 when the rows are tightly packed.
+ * @param pixelFormat The pixel format of the image data.
+ *
+ * @return True on success, false otherwise.
+ *
+ * @see pntr_image_to_pixelformat_buffer()
  */
-PNTR_API void pntr_draw_image_tint(pntr_image* dst, pntr_image* src, int posX, int posY, pntr_color tint) {
-    if (src == NULL) {
-        return;
+PNTR_API bool pntr_image_from_pixelformat_buffer(pntr_image* image, const void* buffer, int stride, pntr_pixelformat pixelFormat) {
+    if (image == NULL || buffer == NULL || pixelFormat < 0 || pixelFormat > PNTR_PIXELFORMAT_A8) {
+        pntr_set_error(PNTR_ERROR_INVALID_ARGS);
+        return false;
     }
-    pntr_draw_image_tint_rec(dst, src,
-        PNTR_CLITERAL(pntr_rectangle) { 0, 0, src->width, src->height },
-        posX, posY, tint
-    );
+
+    if (stride <= 0) {
+        stride = pntr_get_pixel_data_size(image->width, 1, pixelFormat);
+    }
+
+    // Keep track of the alpha channels to know the opacity of the image without another pass.
+    unsigned char alphaAll = 255;
+    unsigned char alphaAny = 0;
+    for (int y = 0; y < image->height; y++) {
+        pntr_color* pixel = &PNTR_PIXEL(image, 0, y);
+        _pntr_pixelformat_row_from(pixel, (const unsigned char*)buffer + (size_t)y * (size_t)stride, image->width, pixelFormat);
+        for (int x = 0; x < image->width; x++) {
+            if (image->premultiplied) {
+                pixel[x] = pntr_color_alpha_premultiply(pixel[x]);
+            }
+            alphaAll &= pixel[x].rgba.a;
+            alphaAny |= pixel[x].rgba.a;
+        }
+    }
+
+    if (image->subimage) {
+        _pntr_image_modified(image);
+    }
+    else {
+        image->opacity = (alphaAll == 255) ? PNTR_OPACITY_OPAQUE : (alphaAny == 0) ? PNTR_OPACITY_TRANSPARENT : PNTR_OPACITY_MIXED;
+    }
+
+    return true;
 }
 
 /**
- * Draw an image onto a destination image.
+ * Creates a new image based on the given image data, from the given original pixel format.
  *
- * @param dst The destination image where the source image will be drawn.
- * @param src The source image to be drawn.
- * @param posX The x-coordinate of the position where the source image will be drawn.
- * @param posY The y-coordinate of the position where the source image will be drawn.
+ * This will not clear the original imageData.
+ *
+ * @param imageData The data of the image in memory.
+ * @param width The width of the image.
+ * @param height The height of the image.
+ * @param pixelFormat The pixel format of the image in memory.
+ *
+ * @return A new image built from the given image data.
  */
-PNTR_API void pntr_draw_image(pntr_image* dst, pntr_image* src, int posX, int posY) {
-    if (src == NULL) {
-        return;
-    }
-    pntr_draw_image_tint_rec(dst, src,
-        PNTR_CLITERAL(pntr_rectangle) { 0, 0, src->width, src->height },
-        posX, posY, PNTR_WHITE);
+PNTR_API pntr_image* pntr_image_from_pixelformat(const void* imageData, int width, int height, pntr_pixelformat pixelFormat) {
+    return _pntr_image_from_pixelformat(imageData, width, height, pixelFormat, false);
 }
 
 /**
- * Get source alpha-blended into destination color.
+ * Creates a new premultiplied alpha image based on the given image data, from the given original pixel format.
  *
- * @param dst The destination color.
- * @param src The source color.
+ * The colors are premultiplied while they are converted, rather than in a second pass.
  *
- * @return The new alpha-blended color.
+ * @param imageData The data of the image in memory, with straight alpha.
+ * @param width The width of the image.
+ * @param height The height of the image.
+ * @param pixelFormat The pixel format of the image in memory.
  *
- * @see PNTR_NO_ALPHABLEND
+ * @return A new premultiplied image built from the given image data.
+ *
+ * @see pntr_image_from_pixelformat()
+ * @see pntr_image_alpha_premultiply()
  */
-PNTR_API pntr_color pntr_color_alpha_blend(pntr_color dst, pntr_color src) {
-    pntr_blend_color(&dst, src);
-    return dst;
+PNTR_API pntr_image* pntr_image_from_pixelformat_premultiplied(const void* imageData, int width, int height, pntr_pixelformat pixelFormat) {
+    return _pntr_image_from_pixelformat(imageData, width, height, pixelFormat, true);
 }
 
 /**
- * Draw a source image within a destination image.
+ * Scales an image either up or down.
  *
- * @param dst The destination image.
- * @param src The source image.
- * @param srcRect The source rectangle of what to draw from the source image.
- * @param posX Where to draw the image on the x coordinate.
- * @param posY Where to draw the image on the y coordinate.
+ * @param image The image to scale up or down.
+ * @param scaleX The scale of which to apply to the width of the image.
+ * @param scaleY The scale of which to apply to the height of the image.
+ * @param filter The filter to apply when resizing.
  *
- * @see pntr_draw_image()
+ * @return The newly scaled image.
+ *
+ * @see pntr_image_resize()
  */
-PNTR_API void pntr_draw_image_rec(pntr_image* dst, pntr_image* src, pntr_rectangle srcRect, int posX, int posY) {
-    pntr_draw_image_tint_rec(dst, src, srcRect, posX, posY, PNTR_WHITE);
+PNTR_API pntr_image* pntr_image_scale(pntr_image* image, float scaleX, float scaleY, pntr_filter filter) {
+    if (image == NULL || scaleX <= 0.0f || scaleY <= 0.0f) {
+        return (pntr_image*)pntr_set_error(PNTR_ERROR_INVALID_ARGS);
+    }
+
+    return pntr_image_resize(image, (int)((float)image->width * scaleX), (int)((float)image->height * scaleY), filter);
 }
 
 /**
- * Draw a source image within a destination image, with tint.
+ * The weights that a resampling filter gives to the source pixels of each destination pixel, along one axis.
  *
- * @param dst The destination image.
- * @param src The source image.
- * @param srcRect The source rectangle of what to draw from the source image.
- * @param posX Where to draw the image on the x coordinate.
- * @param posY Where to draw the image on the y coordinate.
- * @param tint The color to tint the image when drawing.
+ * @see _pntr_resample_axis_init()
+ * @internal
+ */
+typedef struct _pntr_resample_axis {
+    int* starts; /** The first source pixel of each destination pixel. */
+    int* counts; /** How many source pixels each destination pixel is made from. */
+    int* weights; /** The weight of each of those source pixels, in 2.14 fixed point, with taps for every destination pixel. */
+    int taps; /** The most source pixels that a destination pixel can be made from. */
+} _pntr_resample_axis;
+
+/**
+ * How far a resampling filter reaches, in source pixels, when it is not stretched.
  *
- * @see pntr_draw_image()
+ * @internal
  */
-PNTR_API void pntr_draw_image_tint_rec(pntr_image* dst, pntr_image* src, pntr_rectangle srcRect, int posX, int posY, pntr_color tint) {
-    if (dst == NULL || src == NULL || posX >= dst->clip.x + dst->clip.width || posY >= dst->clip.y + dst->clip.height) {
-        return;
+static float _pntr_resample_support(pntr_filter filter) {
+    switch (filter) {
+        case PNTR_FILTER_BOX: return 0.5f;
+        case PNTR_FILTER_MITCHELL: return 2.0f;
+        case PNTR_FILTER_LANCZOS3: return 3.0f;
+        default: return 1.0f;
     }
+}
 
-    // Make sure the source rectangle is within bounds.
-    if (!_pntr_rectangle_intersect(srcRect.x, srcRect.y,
-            srcRect.width <= 0 ? src->width : srcRect.width,
-            srcRect.height <= 0 ? src->height : srcRect.height,
-            0, 0,
-            src->width, src->height, &srcRect)) {
-        return;
+/**
+ * The weight of a resampling filter at the given distance from its center.
+ *
+ * @internal
+ */
+static float _pntr_resample_kernel(pntr_filter filter, float x) {
+    // Only include one of the edges, so that neighboring boxes don't overlap.
+    if (filter == PNTR_FILTER_BOX) {
+        return (x >= -0.5f && x < 0.5f) ? 1.0f : 0.0f;
     }
 
-    // Update the source coordinates based on the destination
-    if (posX < dst->clip.x) {
-        srcRect.x -= posX - dst->clip.x;
-        srcRect.width += posX - dst->clip.x;
-        posX = dst->clip.x;
-    }
-    if (posY < dst->clip.y) {
-        srcRect.y -= posY - dst->clip.y;
-        srcRect.height += posY - dst->clip.y;
-        posY = dst->clip.y;
+    x = PNTR_FABSF(x);
+    switch (filter) {
+        case PNTR_FILTER_MITCHELL: {
+            // Mitchell-Netravali, with B and C both a third.
+            if (x < 1.0f) {
+                return (7.0f * x * x * x - 12.0f * x * x + 16.0f / 3.0f) / 6.0f;
+            }
+            if (x < 2.0f) {
+                return (-7.0f / 3.0f * x * x * x + 12.0f * x * x - 20.0f * x + 32.0f / 3.0f) / 6.0f;
+            }
+            return 0.0f;
+        }
+        case PNTR_FILTER_LANCZOS3: {
+            if (x < 0.0001f) {
+                return 1.0f;
+            }
+            if (x >= 3.0f) {
+                return 0.0f;
+            }
+            float angle = PNTR_PI * x;
+            return 3.0f * PNTR_SINF(angle) * PNTR_SINF(angle / 3.0f) / (angle * angle);
+        }
+        default:
+            return (x < 1.0f) ? 1.0f - x : 0.0f;
     }
+}
 
-    // Confine the destination.
-    pntr_rectangle dstRect = PNTR_CLITERAL(pntr_rectangle) { posX, posY, srcRect.width, srcRect.height };
-    if (!_pntr_rectangle_intersect(dstRect.x, dstRect.y,
-            srcRect.width,
-            srcRect.height,
-            dst->clip.x, dst->clip.y,
-            dst->clip.width, dst->clip.height, &dstRect)) {
-        return;
+/**
+ * Computes the weights of a resampling filter along one axis.
+ *
+ * When shrinking, the filter is stretched to cover every source pixel, rather than skipping some of them. Weights that
+ * would fall outside of the image are left out, and the rest are scaled back up to add up to one.
+ *
+ * @return True on success, or false when out of memory.
+ *
+ * @internal
+ */
+static bool _pntr_resample_axis_init(_pntr_resample_axis* axis, int srcSize, int dstSize, pntr_filter filter) {
+    float ratio = (float)srcSize / (float)dstSize;
+    float scale = PNTR_MAX(ratio, 1.0f);
+    float support = _pntr_resample_support(filter) * scale;
+    axis->taps = (int)PNTR_CEILF(support) * 2 + 1;
+
+    axis->starts = (int*)PNTR_MALLOC(sizeof(int) * (size_t)dstSize * (size_t)(axis->taps + 2));
+    float* values = (float*)PNTR_MALLOC(sizeof(float) * (size_t)axis->taps);
+    if (axis->starts == NULL || values == NULL) {
+        PNTR_FREE(axis->starts);
+        PNTR_FREE(values);
+        pntr_set_error(PNTR_ERROR_NO_MEMORY);
+        return false;
     }
+    axis->counts = axis->starts + dstSize;
+    axis->weights = axis->counts + dstSize;
 
-    // Determine how many bits to skip for each line.
-    int dst_skip = dst->pitch >> 2;
-    int src_skip = src->pitch >> 2;
-
-    // Find the first pixel to render.
-    pntr_color *dstPixel = dst->data + dst_skip * dstRect.y + dstRect.x;
-    pntr_color *srcPixel = src->data + src_skip * srcRect.y + srcRect.x;
+    for (int i = 0; i < dstSize; i++) {
+        float center = ((float)i + 0.5f) * ratio;
+        int first = PNTR_MAX((int)(center - support + 0.5f), 0);
+        int last = PNTR_MIN((int)(center + support + 0.5f), srcSize);
+        int count = PNTR_MIN(last - first, axis->taps);
+        int* weights = &axis->weights[i * axis->taps];
 
-    if (tint.value == PNTR_WHITE_VALUE) {
-        while (dstRect.height-- > 0) {
-            for (int x = 0; x < dstRect.width; ++x) {
-                pntr_blend_color(dstPixel + x, srcPixel[x]);
-            }
+        float total = 0.0f;
+        for (int k = 0; k < count; k++) {
+            values[k] = _pntr_resample_kernel(filter, ((float)(first + k) - center + 0.5f) / scale);
+            total += values[k];
+        }
 
-            dstPixel += dst_skip;
-            srcPixel += src_skip;
+        // Fall back to the nearest pixel when nothing has any weight.
+        if (count <= 0 || total == 0.0f) {
+            axis->starts[i] = PNTR_MIN((int)center, srcSize - 1);
+            axis->counts[i] = 1;
+            weights[0] = 1 << 14;
+            continue;
         }
-    }
-    else {
-        while (dstRect.height-- > 0) {
-            for (int x = 0; x < dstRect.width; ++x) {
-                pntr_blend_color(dstPixel + x, pntr_color_tint(srcPixel[x], tint));
-            }
 
-            dstPixel += dst_skip;
-            srcPixel += src_skip;
+        // Round the weights to fixed point, giving any rounding error to the largest one so that they add up exactly.
+        int sum = 0;
+        int largest = 0;
+        for (int k = 0; k < count; k++) {
+            float weight = values[k] / total * 16384.0f;
+            weights[k] = (int)(weight + ((weight < 0.0f) ? -0.5f : 0.5f));
+            sum += weights[k];
+            if (weights[k] > weights[largest]) {
+                largest = k;
+            }
         }
+        weights[largest] += (1 << 14) - sum;
+        axis->starts[i] = first;
+        axis->counts[i] = count;
     }
+
+    PNTR_FREE(values);
+    return true;
 }
 
 /**
- * Creates a new image based on the given image data, from the given original pixel format.
+ * Converts an accumulated channel from 2.14 fixed point, keeping it between 0 and the given limit.
  *
- * This will not clear the original imageData.
+ * @internal
+ */
+static unsigned char _pntr_resample_channel(int value, int limit) {
+    if (value <= 0) {
+        return 0;
+    }
+    value = (value + (1 << 13)) >> 14;
+    return (unsigned char)PNTR_MIN(value, limit);
+}
+
+/**
+ * Resizes an image in two passes, first across each row and then down each column.
  *
- * @param imageData The data of the image in memory.
- * @param width The width of the image.
- * @param height The height of the image.
- * @param pixelFormat The pixel format of the image in memory.
+ * The pixels are filtered with premultiplied alpha, so that the colors of transparent pixels don't bleed into the
+ * pixels around them.
  *
- * @return A new image built from the given image data.
+ * @internal
  */
-PNTR_API pntr_image* pntr_image_from_pixelformat(const void* imageData, int width, int height, pntr_pixelformat pixelFormat) {
-    if (imageData == NULL || width <= 0 || height <= 0 || pixelFormat < 0) {
-        return (pntr_image*)pntr_set_error(PNTR_ERROR_INVALID_ARGS);
+static bool _pntr_image_resample(pntr_image* output, pntr_image* image, pntr_filter filter) {
+    int srcWidth = image->width;
+    int srcHeight = image->height;
+    int newWidth = output->width;
+    int newHeight = output->height;
+
+    _pntr_resample_axis columns;
+    _pntr_resample_axis rows;
+    if (!_pntr_resample_axis_init(&columns, srcWidth, newWidth, filter)) {
+        return false;
+    }
+    if (!_pntr_resample_axis_init(&rows, srcHeight, newHeight, filter)) {
+        PNTR_FREE(columns.starts);
+        return false;
     }
 
-    // Check how we are to convert the pixel format.
-    switch (pixelFormat) {
-        case PNTR_PIXELFORMAT_GRAYSCALE: {
-            pntr_image* output = pntr_new_image(width, height);
-            if (output == NULL) {
-                return NULL;
-            }
+    // The rows that were resized horizontally, a row of source pixels with premultiplied alpha, and the sums of a row.
+    pntr_color* resized = (pntr_color*)PNTR_MALLOC(sizeof(pntr_color) * ((size_t)newWidth * (size_t)srcHeight + (size_t)srcWidth));
+    int* sums = (int*)PNTR_MALLOC(sizeof(int) * 4 * (size_t)newWidth);
+    if (resized == NULL || sums == NULL) {
+        PNTR_FREE(resized);
+        PNTR_FREE(sums);
+        PNTR_FREE(columns.starts);
+        PNTR_FREE(rows.starts);
+        pntr_set_error(PNTR_ERROR_NO_MEMORY);
+        return false;
+    }
+    pntr_color* premultiplied = resized + (size_t)newWidth * (size_t)srcHeight;
 
-            unsigned char* source = (unsigned char*)imageData;
-            for (size_t i = 0; i < (size_t)width * (size_t)height; i++) {
-                output->data[i] = pntr_get_pixel_color((void*)(source + i), pixelFormat);
+    for (int y = 0; y < srcHeight; y++) {
+        pntr_color* src = &PNTR_PIXEL(image, 0, y);
+        if (!image->premultiplied) {
+            for (int x = 0; x < srcWidth; x++) {
+                premultiplied[x] = pntr_color_alpha_premultiply(src[x]);
             }
-
-            return output;
+            src = premultiplied;
         }
 
-        case PNTR_PIXELFORMAT_ARGB8888:
-        case PNTR_PIXELFORMAT_RGBA8888: {
-            pntr_image* output = pntr_new_image(width, height);
-
-            pntr_color* source = (pntr_color*)imageData;
-            for (size_t i = 0; i < (size_t)width * (size_t)height; i++) {
-                output->data[i] = pntr_get_pixel_color((void*)(source + i), pixelFormat);
+        pntr_color* row = resized + (size_t)y * (size_t)newWidth;
+        for (int x = 0; x < newWidth; x++) {
+            const pntr_color* pixel = src + columns.starts[x];
+            const int* weights = &columns.weights[x * columns.taps];
+            int r = 0, g = 0, b = 0, a = 0;
+            for (int k = 0; k < columns.counts[x]; k++) {
+                r += weights[k] * pixel[k].rgba.r;
+                g += weights[k] * pixel[k].rgba.g;
+                b += weights[k] * pixel[k].rgba.b;
+                a += weights[k] * pixel[k].rgba.a;
             }
-
-            return output;
+            unsigned char alpha = _pntr_resample_channel(a, 255);
+            row[x] = PNTR_NEW_COLOR(_pntr_resample_channel(r, alpha), _pntr_resample_channel(g, alpha), _pntr_resample_channel(b, alpha), alpha);
         }
+    }
 
-        default: {
-            return (pntr_image*)pntr_set_error(PNTR_ERROR_INVALID_ARGS);
+    // Sum whole rows at a time, so that the resized rows are read in order.
+    for (int y = 0; y < newHeight; y++) {
+        PNTR_MEMSET(sums, 0, sizeof(int) * 4 * (size_t)newWidth);
+        const int* weights = &rows.weights[y * rows.taps];
+        for (int k = 0; k < rows.counts[y]; k++) {
+            const pntr_color* row = resized + (size_t)(rows.starts[y] + k) * (size_t)newWidth;
+            int weight = weights[k];
+            for (int x = 0; x < newWidth; x++) {
+                sums[x * 4] += weight * row[x].rgba.r;
+                sums[x * 4 + 1] += weight * row[x].rgba.g;
+                sums[x * 4 + 2] += weight * row[x].rgba.b;
+                sums[x * 4 + 3] += weight * row[x].rgba.a;
+            }
         }
-    }
-}
 
-/**
- * Scales an image either up or down.
- *
- * @param image The image to scale up or down.
- * @param scaleX The scale of which to apply to the width of the image.
- * @param scaleY The scale of which to apply to the height of the image.
- * @param filter The filter to apply when resizing.
- *
- * @return The newly scaled image.
- *
- * @see pntr_image_resize()
- */
-PNTR_API pntr_image* pntr_image_scale(pntr_image* image, float scaleX, float scaleY, pntr_filter filter) {
-    if (image == NULL || scaleX <= 0.0f || scaleY <= 0.0f) {
-        return (pntr_image*)pntr_set_error(PNTR_ERROR_INVALID_ARGS);
+        pntr_color* dst = &PNTR_PIXEL(output, 0, y);
+        for (int x = 0; x < newWidth; x++) {
+            unsigned char alpha = _pntr_resample_channel(sums[x * 4 + 3], 255);
+            dst[x] = PNTR_NEW_COLOR(
+                _pntr_resample_channel(sums[x * 4], alpha),
+                _pntr_resample_channel(sums[x * 4 + 1], alpha),
+                _pntr_resample_channel(sums[x * 4 + 2], alpha),
+                alpha
+            );
+            if (!image->premultiplied) {
+                dst[x] = pntr_color_alpha_unpremultiply(dst[x]);
+            }
+        }
     }
 
-    return pntr_image_resize(image, (int)((float)image->width * scaleX), (int)((float)image->height * scaleY), filter);
+    PNTR_FREE(sums);
+    PNTR_FREE(resized);
+    PNTR_FREE(columns.starts);
+    PNTR_FREE(rows.starts);
+    return true;
 }
 
 /**
  * Resize an image.
  *
+ * Every filter other than PNTR_FILTER_NEARESTNEIGHBOR resamples the image in two passes, with weights that are computed
+ * once for each row and column. When shrinking, the filters cover every pixel of the original image, so large
+ * reductions don't alias.
+ *
  * @param image The image to resize.
  * @param newWidth The desired width of the new image.
  * @param newHeight THe desired height of the new image.
@@ -3460,29 +8654,17 @@ PNTR_API pntr_image* pntr_image_resize(pntr_image* image, int newWidth, int newH
     if (output == NULL) {
         return NULL;
     }
+    output->premultiplied = image->premultiplied;
 
     switch (filter) {
-        case PNTR_FILTER_BILINEAR: {
-            float xRatio = (float)image->width / (float)newWidth;
-            float yRatio = (float)image->height / (float)newHeight;
-
-            for (int y = 0; y < newHeight; y++) {
-                float srcY = (float)y * yRatio;
-                int srcYPixel = (int)srcY;
-                int srcYPixelPlusOne = y == newHeight - 1 ? (int)srcY : (int)srcY + 1;
-                for (int x = 0; x < newWidth; x++) {
-                    float srcX = (float)x * xRatio;
-                    int srcXPixel = (int)srcX;
-                    int srcXPixelPlusOne = x == newWidth - 1 ? (int)srcX : (int)srcX + 1;
-                    PNTR_PIXEL(output, x, y) = pntr_color_bilinear_interpolate(
-                        image->data[srcYPixel * (image->pitch >> 2) + srcXPixel],
-                        image->data[srcYPixelPlusOne * (image->pitch >> 2) + srcXPixel],
-                        image->data[srcYPixel * (image->pitch >> 2) + srcXPixelPlusOne],
-                        image->data[srcYPixelPlusOne * (image->pitch >> 2) + srcXPixelPlusOne],
-                        srcX - PNTR_FLOORF(srcX),
-                        srcY - PNTR_FLOORF(srcY)
-                    );
-                }
+        case PNTR_FILTER_BILINEAR:
+        case PNTR_FILTER_BOX:
+        case PNTR_FILTER_TRIANGLE:
+        case PNTR_FILTER_MITCHELL:
+        case PNTR_FILTER_LANCZOS3: {
+            if (!_pntr_image_resample(output, image, (filter == PNTR_FILTER_BILINEAR) ? PNTR_FILTER_TRIANGLE : filter)) {
+                pntr_unload_image(output);
+                return NULL;
             }
         }
         break;
@@ -3546,14 +8728,22 @@ PNTR_API void pntr_image_flip(pntr_image* image, bool horizontal, bool vertical)
  * Replace the given color with another color on an image.
  *
  * @param image The image to process.
- * @param color The color to search for.
- * @param replace The color that will replace the original color.
+ * @param color The color to search for, with straight alpha.
+ * @param replace The color that will replace the original color, with straight alpha.
  */
 PNTR_API void pntr_image_color_replace(pntr_image* image, pntr_color color, pntr_color replace) {
     if (image == NULL) {
         return;
     }
 
+    _pntr_image_modified(image);
+
+    // Premultiplied images hold premultiplied colors.
+    if (image->premultiplied) {
+        color = pntr_color_alpha_premultiply(color);
+        replace = pntr_color_alpha_premultiply(replace);
+    }
+
     for (int y = image->clip.y; y < image->clip.y + image->clip.height; y++) {
         pntr_color* pixel = &PNTR_PIXEL(image, 0, y);
         for (int x = image->clip.x; x < image->clip.x + image->clip.width; x++) {
@@ -3625,26 +8815,414 @@ PNTR_API pntr_color pntr_color_brightness(pntr_color color, float factor) {
  * @param color The color that you would like to fade.
  * @param factor The factor of which to fade the color, from -1.0f to 1.0f.
  *
- * @return The faded new color.
+ * @return The faded new color.
+ *
+ * @see pntr_image_color_fade()
+ */
+PNTR_API pntr_color pntr_color_fade(pntr_color color, float factor) {
+    if (factor < -1.0f) {
+        factor = -1.0f;
+    }
+    else if (factor > 1.0f) {
+        factor = 1.0f;
+    }
+
+    if (factor < 0.0f) {
+        color.rgba.a = (unsigned char)((float)color.rgba.a * (1.0f + factor));
+    }
+    else {
+        color.rgba.a = (unsigned char)(((float)(255 - color.rgba.a) * factor) + color.rgba.a);
+    }
+
+    return color;
+}
+
+/**
+ * Creates a new, empty color pipeline.
+ *
+ * Add adjustments to it with functions like pntr_color_pipeline_brightness(), and then apply all of them at once with
+ * pntr_image_color_pipeline().
+ *
+ * @code
+ * pntr_color_pipeline* pipeline = pntr_new_color_pipeline();
+ * pntr_color_pipeline_brightness(pipeline, 0.2f);
+ * pntr_color_pipeline_saturation(pipeline, -0.5f);
+ * pntr_image_color_pipeline(image, pipeline);
+ * pntr_unload_color_pipeline(pipeline);
+ * @endcode
+ *
+ * @return The new pipeline, which must be unloaded with pntr_unload_color_pipeline(). NULL on failure.
+ *
+ * @see pntr_unload_color_pipeline()
+ * @see pntr_image_color_pipeline()
+ */
+PNTR_API pntr_color_pipeline* pntr_new_color_pipeline(void) {
+    pntr_color_pipeline* pipeline = (pntr_color_pipeline*)PNTR_MALLOC(sizeof(pntr_color_pipeline));
+    if (pipeline == NULL) {
+        return (pntr_color_pipeline*)pntr_set_error(PNTR_ERROR_NO_MEMORY);
+    }
+
+    pipeline->stages = NULL;
+    pipeline->stagesCount = 0;
+    pipeline->stagesCapacity = 0;
+
+    return pipeline;
+}
+
+/**
+ * Unloads the given color pipeline from memory.
+ *
+ * @param pipeline The pipeline to unload.
+ *
+ * @see pntr_new_color_pipeline()
+ */
+PNTR_API void pntr_unload_color_pipeline(pntr_color_pipeline* pipeline) {
+    if (pipeline == NULL) {
+        return;
+    }
+
+    if (pipeline->stages != NULL) {
+        PNTR_FREE(pipeline->stages);
+    }
+
+    PNTR_FREE(pipeline);
+}
+
+/**
+ * Sets up a pipeline with a single stage on the stack, for adjustments that only need one lookup table stage.
+ *
+ * @internal
+ */
+static void _pntr_color_pipeline_local(pntr_color_pipeline* pipeline, pntr_color_pipeline_stage* stage) {
+    pipeline->stages = stage;
+    pipeline->stagesCount = 0;
+    pipeline->stagesCapacity = 1;
+}
+
+/**
+ * Updates the fixed point factors of a matrix stage from its float factors.
+ *
+ * @internal
+ */
+static void _pntr_color_pipeline_stage_fixed(pntr_color_pipeline_stage* stage) {
+    for (int i = 0; i < 9; i++) {
+        float factor = stage->factors[i] * 65536.0f;
+        stage->fixed[i] = (int)(factor < 0.0f ? factor - 0.5f : factor + 0.5f);
+    }
+}
+
+/**
+ * Gets the stage to add an adjustment to, adding a new stage when the last one is of the other kind.
+ *
+ * @param matrix Whether the adjustment mixes channels through the matrix.
+ *
+ * @return The stage to fold the adjustment into, or NULL on failure.
+ *
+ * @internal
+ */
+static pntr_color_pipeline_stage* _pntr_color_pipeline_stage(pntr_color_pipeline* pipeline, bool matrix) {
+    if (pipeline == NULL) {
+        return NULL;
+    }
+
+    // Consecutive adjustments of the same kind are folded into the same stage.
+    if (pipeline->stagesCount > 0 && pipeline->stages[pipeline->stagesCount - 1].matrix == matrix) {
+        return &pipeline->stages[pipeline->stagesCount - 1];
+    }
+
+    if (pipeline->stagesCount == pipeline->stagesCapacity) {
+        int capacity = pipeline->stagesCapacity > 0 ? pipeline->stagesCapacity * 2 : 2;
+        pntr_color_pipeline_stage* stages = (pntr_color_pipeline_stage*)PNTR_REALLOC(pipeline->stages, sizeof(pntr_color_pipeline_stage) * (size_t)capacity);
+        if (stages == NULL) {
+            pntr_set_error(PNTR_ERROR_NO_MEMORY);
+            return NULL;
+        }
+        pipeline->stages = stages;
+        pipeline->stagesCapacity = capacity;
+    }
+
+    pntr_color_pipeline_stage* stage = &pipeline->stages[pipeline->stagesCount++];
+    stage->matrix = matrix;
+    for (int value = 0; value < 256; value++) {
+        stage->r[value] = stage->g[value] = stage->b[value] = stage->a[value] = (unsigned char)value;
+    }
+    for (int i = 0; i < 9; i++) {
+        stage->factors[i] = (i % 4 == 0) ? 1.0f : 0.0f;
+    }
+    _pntr_color_pipeline_stage_fixed(stage);
+
+    return stage;
+}
+
+/**
+ * Gets the color at the given index of the lookup tables of a stage.
+ *
+ * @internal
+ */
+static pntr_color _pntr_color_pipeline_stage_get(pntr_color_pipeline_stage* stage, int value) {
+    return PNTR_NEW_COLOR(stage->r[value], stage->g[value], stage->b[value], stage->a[value]);
+}
+
+/**
+ * Sets the color at the given index of the lookup tables of a stage.
+ *
+ * @internal
+ */
+static void _pntr_color_pipeline_stage_set(pntr_color_pipeline_stage* stage, int value, pntr_color color) {
+    stage->r[value] = color.rgba.r;
+    stage->g[value] = color.rgba.g;
+    stage->b[value] = color.rgba.b;
+    stage->a[value] = color.rgba.a;
+}
+
+/**
+ * Folds a 3x3 color matrix into the pipeline.
+ *
+ * @internal
+ */
+static void _pntr_color_pipeline_matrix(pntr_color_pipeline* pipeline, const float* factors) {
+    pntr_color_pipeline_stage* stage = _pntr_color_pipeline_stage(pipeline, true);
+    if (stage == NULL) {
+        return;
+    }
+
+    float result[9];
+    for (int row = 0; row < 3; row++) {
+        for (int column = 0; column < 3; column++) {
+            result[row * 3 + column] =
+                factors[row * 3 + 0] * stage->factors[0 * 3 + column] +
+                factors[row * 3 + 1] * stage->factors[1 * 3 + column] +
+                factors[row * 3 + 2] * stage->factors[2 * 3 + column];
+        }
+    }
+
+    for (int i = 0; i < 9; i++) {
+        stage->factors[i] = result[i];
+    }
+    _pntr_color_pipeline_stage_fixed(stage);
+}
+
+/**
+ * Adds a brightness adjustment to the pipeline.
+ *
+ * @param pipeline The pipeline to add the adjustment to.
+ * @param factor The factor in which to change the brightness from -1.0f to 1.0f.
+ *
+ * @see pntr_color_brightness()
+ */
+PNTR_API void pntr_color_pipeline_brightness(pntr_color_pipeline* pipeline, float factor) {
+    pntr_color_pipeline_stage* stage = _pntr_color_pipeline_stage(pipeline, false);
+    if (stage == NULL) {
+        return;
+    }
+
+    for (int value = 0; value < 256; value++) {
+        _pntr_color_pipeline_stage_set(stage, value, pntr_color_brightness(_pntr_color_pipeline_stage_get(stage, value), factor));
+    }
+}
+
+/**
+ * Adds a contrast adjustment to the pipeline.
+ *
+ * @param pipeline The pipeline to add the adjustment to.
+ * @param contrast The factor of contrast to apply, from -1.0f to 1.0f.
+ *
+ * @see pntr_color_contrast()
+ */
+PNTR_API void pntr_color_pipeline_contrast(pntr_color_pipeline* pipeline, float contrast) {
+    pntr_color_pipeline_stage* stage = _pntr_color_pipeline_stage(pipeline, false);
+    if (stage == NULL) {
+        return;
+    }
+
+    for (int value = 0; value < 256; value++) {
+        _pntr_color_pipeline_stage_set(stage, value, pntr_color_contrast(_pntr_color_pipeline_stage_get(stage, value), contrast));
+    }
+}
+
+/**
+ * Adds a fade to the pipeline. Fully transparent pixels stay transparent.
+ *
+ * @param pipeline The pipeline to add the adjustment to.
+ * @param factor The factor of which to fade, from -1.0f to 1.0f.
+ *
+ * @see pntr_color_fade()
+ */
+PNTR_API void pntr_color_pipeline_fade(pntr_color_pipeline* pipeline, float factor) {
+    pntr_color_pipeline_stage* stage = _pntr_color_pipeline_stage(pipeline, false);
+    if (stage == NULL) {
+        return;
+    }
+
+    for (int value = 0; value < 256; value++) {
+        if (stage->a[value] > 0) {
+            _pntr_color_pipeline_stage_set(stage, value, pntr_color_fade(_pntr_color_pipeline_stage_get(stage, value), factor));
+        }
+    }
+}
+
+/**
+ * Adds a tint to the pipeline.
+ *
+ * @param pipeline The pipeline to add the adjustment to.
+ * @param tint The color to tint by.
+ *
+ * @see pntr_color_tint()
+ */
+PNTR_API void pntr_color_pipeline_tint(pntr_color_pipeline* pipeline, pntr_color tint) {
+    pntr_color_pipeline_stage* stage = _pntr_color_pipeline_stage(pipeline, false);
+    if (stage == NULL) {
+        return;
+    }
+
+    for (int value = 0; value < 256; value++) {
+        _pntr_color_pipeline_stage_set(stage, value, pntr_color_tint(_pntr_color_pipeline_stage_get(stage, value), tint));
+    }
+}
+
+/**
+ * Adds a color inversion to the pipeline.
+ *
+ * @param pipeline The pipeline to add the adjustment to.
+ *
+ * @see pntr_color_invert()
+ */
+PNTR_API void pntr_color_pipeline_invert(pntr_color_pipeline* pipeline) {
+    pntr_color_pipeline_stage* stage = _pntr_color_pipeline_stage(pipeline, false);
+    if (stage == NULL) {
+        return;
+    }
+
+    for (int value = 0; value < 256; value++) {
+        _pntr_color_pipeline_stage_set(stage, value, pntr_color_invert(_pntr_color_pipeline_stage_get(stage, value)));
+    }
+}
+
+/**
+ * Adds a saturation adjustment to the pipeline.
+ *
+ * @param pipeline The pipeline to add the adjustment to.
+ * @param factor How much to change the saturation, from -1.0f for grayscale to 1.0f for double the saturation.
+ */
+PNTR_API void pntr_color_pipeline_saturation(pntr_color_pipeline* pipeline, float factor) {
+    if (factor < -1.0f) {
+        factor = -1.0f;
+    }
+    else if (factor > 1.0f) {
+        factor = 1.0f;
+    }
+
+    // Keeps the luminance, using the same weights as the CSS saturate() filter.
+    float s = 1.0f + factor;
+    float factors[9] = {
+        0.213f + 0.787f * s, 0.715f - 0.715f * s, 0.072f - 0.072f * s,
+        0.213f - 0.213f * s, 0.715f + 0.285f * s, 0.072f - 0.072f * s,
+        0.213f - 0.213f * s, 0.715f - 0.715f * s, 0.072f + 0.928f * s
+    };
+    _pntr_color_pipeline_matrix(pipeline, factors);
+}
+
+/**
+ * Adds a hue rotation to the pipeline.
+ *
+ * @param pipeline The pipeline to add the adjustment to.
+ * @param degrees How many degrees to rotate the hue by.
+ */
+PNTR_API void pntr_color_pipeline_hue(pntr_color_pipeline* pipeline, float degrees) {
+    // Keeps the luminance, using the same weights as the CSS hue-rotate() filter.
+    float c = PNTR_COSF(degrees * PNTR_DEG2RAD);
+    float s = PNTR_SINF(degrees * PNTR_DEG2RAD);
+    float factors[9] = {
+        0.213f + c * 0.787f - s * 0.213f, 0.715f - c * 0.715f - s * 0.715f, 0.072f - c * 0.072f + s * 0.928f,
+        0.213f - c * 0.213f + s * 0.143f, 0.715f + c * 0.285f + s * 0.140f, 0.072f - c * 0.072f - s * 0.283f,
+        0.213f - c * 0.213f - s * 0.787f, 0.715f - c * 0.715f + s * 0.715f, 0.072f + c * 0.928f + s * 0.072f
+    };
+    _pntr_color_pipeline_matrix(pipeline, factors);
+}
+
+/**
+ * Runs a straight alpha color through all of the stages.
+ *
+ * @internal
+ */
+static pntr_color _pntr_color_pipeline_stages(const pntr_color_pipeline_stage* stages, int stagesCount, pntr_color color) {
+    for (int i = 0; i < stagesCount; i++) {
+        const pntr_color_pipeline_stage* stage = &stages[i];
+        if (!stage->matrix) {
+            color.rgba.r = stage->r[color.rgba.r];
+            color.rgba.g = stage->g[color.rgba.g];
+            color.rgba.b = stage->b[color.rgba.b];
+            color.rgba.a = stage->a[color.rgba.a];
+            continue;
+        }
+
+        int channels[3] = { color.rgba.r, color.rgba.g, color.rgba.b };
+        unsigned char result[3];
+        for (int row = 0; row < 3; row++) {
+            int value = stage->fixed[row * 3] * channels[0] + stage->fixed[row * 3 + 1] * channels[1] + stage->fixed[row * 3 + 2] * channels[2];
+            result[row] = (value <= 0) ? 0 : (value >= (255 << 16)) ? 255 : (unsigned char)((value + 32768) >> 16);
+        }
+        color.rgba.r = result[0];
+        color.rgba.g = result[1];
+        color.rgba.b = result[2];
+    }
+
+    return color;
+}
+
+/**
+ * Applies all the adjustments of the pipeline to a single color.
+ *
+ * @param pipeline The pipeline to apply.
+ * @param color The color to adjust.
+ *
+ * @return The adjusted color.
+ */
+PNTR_API pntr_color pntr_color_pipeline_apply(pntr_color_pipeline* pipeline, pntr_color color) {
+    if (pipeline == NULL) {
+        return color;
+    }
+
+    return _pntr_color_pipeline_stages(pipeline->stages, pipeline->stagesCount, color);
+}
+
+/**
+ * Applies all the adjustments of the pipeline to the image, in a single pass over its clip.
+ *
+ * Premultiplied images are adjusted in straight alpha, and premultiplied again.
  *
- * @see pntr_image_color_fade()
+ * @param image The image to adjust.
+ * @param pipeline The pipeline to apply.
+ *
+ * @see pntr_new_color_pipeline()
  */
-PNTR_API pntr_color pntr_color_fade(pntr_color color, float factor) {
-    if (factor < -1.0f) {
-        factor = -1.0f;
-    }
-    else if (factor > 1.0f) {
-        factor = 1.0f;
+PNTR_API void pntr_image_color_pipeline(pntr_image* image, pntr_color_pipeline* pipeline) {
+    if (image == NULL || pipeline == NULL || pipeline->stagesCount <= 0) {
+        return;
     }
 
-    if (factor < 0.0f) {
-        color.rgba.a = (unsigned char)((float)color.rgba.a * (1.0f + factor));
-    }
-    else {
-        color.rgba.a = (unsigned char)(((float)(255 - color.rgba.a) * factor) + color.rgba.a);
-    }
+    _pntr_image_modified(image);
 
-    return color;
+    const pntr_color_pipeline_stage* stages = pipeline->stages;
+    int stagesCount = pipeline->stagesCount;
+    for (int y = image->clip.y; y < image->clip.y + image->clip.height; y++) {
+        pntr_color* pixel = &PNTR_PIXEL(image, image->clip.x, y);
+
+        // A single set of lookup tables maps whole rows at once.
+        if (stagesCount == 1 && !stages[0].matrix && !image->premultiplied) {
+            _pntr_color_map_row(pixel, pixel, image->clip.width, stages[0].r, stages[0].g, stages[0].b, stages[0].a);
+            continue;
+        }
+
+        for (int x = 0; x < image->clip.width; x++) {
+            if (image->premultiplied) {
+                pixel[x] = pntr_color_alpha_premultiply(_pntr_color_pipeline_stages(stages, stagesCount, pntr_color_alpha_unpremultiply(pixel[x])));
+            }
+            else {
+                pixel[x] = _pntr_color_pipeline_stages(stages, stagesCount, pixel[x]);
+            }
+        }
+    }
 }
 
 /**
@@ -3660,22 +9238,11 @@ PNTR_API void pntr_image_color_fade(pntr_image* image, float factor) {
         return;
     }
 
-    if (factor < -1.0f) {
-        factor = -1.0f;
-    }
-    else if (factor > 1.0f) {
-        factor = 1.0f;
-    }
-
-    for (int y = image->clip.y; y < image->clip.y + image->clip.height; y++) {
-        pntr_color* pixel = &PNTR_PIXEL(image, image->clip.x, y);
-        for (int x = 0; x < image->clip.width; x++) {
-            if (pixel->rgba.a > 0) {
-                *pixel = pntr_color_fade(*pixel, factor);
-            }
-            pixel++;
-        }
-    }
+    pntr_color_pipeline_stage stage;
+    pntr_color_pipeline pipeline;
+    _pntr_color_pipeline_local(&pipeline, &stage);
+    pntr_color_pipeline_fade(&pipeline, factor);
+    pntr_image_color_pipeline(image, &pipeline);
 }
 
 /**
@@ -3686,26 +9253,7 @@ PNTR_API void pntr_image_color_fade(pntr_image* image, float factor) {
  * @param color The color to apply.
  */
 PNTR_API void pntr_set_pixel_color(void* dstPtr, pntr_pixelformat dstPixelFormat, pntr_color color) {
-    if (PNTR_PIXELFORMAT == dstPixelFormat) {
-        *((pntr_color*)dstPtr) = color;
-        return;
-    }
-
-    switch (dstPixelFormat) {
-        case PNTR_PIXELFORMAT_RGBA8888:
-            *((uint32_t*)(dstPtr)) = ((uint32_t)color.rgba.a << 24) | ((uint32_t)color.rgba.b << 16) | ((uint32_t)color.rgba.g << 8) | (uint32_t)color.rgba.r;
-        break;
-        case PNTR_PIXELFORMAT_ARGB8888:
-            *((uint32_t*)(dstPtr)) = ((uint32_t)color.rgba.b << 24) | ((uint32_t)color.rgba.g << 16) | ((uint32_t)color.rgba.r << 8) | (uint32_t)color.rgba.a;
-        break;
-        case PNTR_PIXELFORMAT_GRAYSCALE: {
-            float r = (float)color.rgba.r / 255.0f;
-            float g = (float)color.rgba.g / 255.0f;
-            float b = (float)color.rgba.b / 255.0f;
-            ((unsigned char *)dstPtr)[0] = (unsigned char)((r * 0.299f + g * 0.587f + b * 0.114f) * 255.0f);
-        }
-        break;
-    }
+    _pntr_pixelformat_row_to(dstPtr, &color, 1, dstPixelFormat);
 }
 
 /**
@@ -3717,27 +9265,9 @@ PNTR_API void pntr_set_pixel_color(void* dstPtr, pntr_pixelformat dstPixelFormat
  * @return The color of the pixel in memory.
  */
 PNTR_API pntr_color pntr_get_pixel_color(void* srcPtr, pntr_pixelformat srcPixelFormat) {
-    switch (srcPixelFormat) {
-        case PNTR_PIXELFORMAT_RGBA8888:
-            return PNTR_NEW_COLOR(
-                ((unsigned char *)srcPtr)[0],
-                ((unsigned char *)srcPtr)[1],
-                ((unsigned char *)srcPtr)[2],
-                ((unsigned char *)srcPtr)[3]
-            );
-        case PNTR_PIXELFORMAT_ARGB8888:
-            return PNTR_NEW_COLOR(
-                ((unsigned char *)srcPtr)[1],
-                ((unsigned char *)srcPtr)[2],
-                ((unsigned char *)srcPtr)[3],
-                ((unsigned char *)srcPtr)[0]
-            );
-        case PNTR_PIXELFORMAT_GRAYSCALE:
-            // White, with alpha determining grayscale value. Use tint to change color afterwards.
-            return PNTR_NEW_COLOR(255, 255, 255, ((unsigned char*)srcPtr)[0]);
-    }
-
-    return PNTR_BLANK;
+    pntr_color color;
+    _pntr_pixelformat_row_from(&color, srcPtr, 1, srcPixelFormat);
+    return color;
 }
 
 /**
@@ -3753,12 +9283,23 @@ PNTR_API void pntr_image_color_tint(pntr_image* image, pntr_color tint) {
         return;
     }
 
+    _pntr_image_modified(image);
+
+    if (image->premultiplied) {
+        tint = pntr_color_alpha_premultiply(tint);
+    }
+
+    if (tint.value == PNTR_WHITE_VALUE) {
+        return;
+    }
+
+    _pntr_tint_table table;
+    table.ready = false;
+    _pntr_tint_table_init(&table, tint);
+
     for (int y = image->clip.y; y < image->clip.y + image->clip.height; y++) {
         pntr_color* pixel = &PNTR_PIXEL(image, image->clip.x, y);
-        for (int x = 0; x < image->clip.width; x++) {
-            *pixel = pntr_color_tint(*pixel, tint);
-            pixel++;
-        }
+        _pntr_color_map_row(pixel, pixel, image->clip.width, table.r, table.g, table.b, table.a);
     }
 }
 
@@ -4109,6 +9650,10 @@ PNTR_API void pntr_draw_text_len(pntr_image* dst, pntr_font* font, const char* t
     int y = posY;
     int tallestCharacter = 0;
 
+    // Every glyph shares the same tint tables.
+    _pntr_tint_table table;
+    table.ready = false;
+
     // Iterate through each character.
     pntr_codepoint_t codepoint;
     int count = 0;
@@ -4143,7 +9688,7 @@ PNTR_API void pntr_draw_text_len(pntr_image* dst, pntr_font* font, const char* t
 
         // Draw the character, unless it's a space.
         if (codepoint != ' ')  {
-            pntr_draw_image_tint_rec(dst, font->atlas, font->srcRects[i], x + font->glyphRects[i].x, y + font->glyphRects[i].y, tint);
+            _pntr_draw_image_tint_rec(dst, font->atlas, font->srcRects[i], x + font->glyphRects[i].x, y + font->glyphRects[i].y, tint, &table);
         }
 
         x += font->glyphRects[i].x + font->glyphRects[i].width;
@@ -4669,13 +10214,11 @@ PNTR_API void pntr_image_color_invert(pntr_image* image) {
         return;
     }
 
-    for (int y = image->clip.y; y < image->clip.y + image->clip.height; y++) {
-        pntr_color* pixel = &PNTR_PIXEL(image, image->clip.x, y);
-        for (int x = 0; x < image->clip.width; x++) {
-            *pixel = pntr_color_invert(*pixel);
-            pixel++;
-        }
-    }
+    pntr_color_pipeline_stage stage;
+    pntr_color_pipeline pipeline;
+    _pntr_color_pipeline_local(&pipeline, &stage);
+    pntr_color_pipeline_invert(&pipeline);
+    pntr_image_color_pipeline(image, &pipeline);
 }
 
 /**
@@ -4691,20 +10234,11 @@ PNTR_API void pntr_image_color_brightness(pntr_image* image, float factor) {
         return;
     }
 
-    if (factor < -1.0f) {
-        factor = -1.0f;
-    }
-    else if (factor > 1.0f) {
-        factor = 1.0f;
-    }
-
-    for (int y = image->clip.y; y < image->clip.y + image->clip.height; y++) {
-        pntr_color* pixel = &PNTR_PIXEL(image, image->clip.x, y);
-        for (int x = 0; x < image->clip.width; x++) {
-            *pixel = pntr_color_brightness(*pixel, factor);
-            pixel++;
-        }
-    }
+    pntr_color_pipeline_stage stage;
+    pntr_color_pipeline pipeline;
+    _pntr_color_pipeline_local(&pipeline, &stage);
+    pntr_color_pipeline_brightness(&pipeline, factor);
+    pntr_image_color_pipeline(image, &pipeline);
 }
 
 #ifndef PNTR_LOAD_FILE
@@ -4893,9 +10427,17 @@ PNTR_API int pntr_get_pixel_data_size(int width, int height, pntr_pixelformat pi
     switch (pixelFormat) {
         case PNTR_PIXELFORMAT_RGBA8888:
         case PNTR_PIXELFORMAT_ARGB8888:
+        case PNTR_PIXELFORMAT_BGRA8888:
             bitsPerPixel = (int)sizeof(pntr_color) * bitsPerByte;
             break;
+        case PNTR_PIXELFORMAT_RGB888:
+            bitsPerPixel = 3 * bitsPerByte;
+            break;
+        case PNTR_PIXELFORMAT_RGB565:
+            bitsPerPixel = 2 * bitsPerByte;
+            break;
         case PNTR_PIXELFORMAT_GRAYSCALE:
+        case PNTR_PIXELFORMAT_A8:
             bitsPerPixel = (int)sizeof(unsigned char) * bitsPerByte;
             break;
         default:
@@ -4931,17 +10473,9 @@ PNTR_API void* pntr_image_to_pixelformat(pntr_image* image, unsigned int* dataSi
         return pntr_set_error(PNTR_ERROR_NO_MEMORY);
     }
 
-    int pixelSize = pntr_get_pixel_data_size(1, 1, pixelFormat);
-
-    int i = 0;
-    for (int y = 0; y < image->height; y++) {
-        for (int x = 0; x < image->width; x++) {
-            pntr_set_pixel_color(
-                ((unsigned char*)data) + (i++ * pixelSize),
-                pixelFormat,
-                PNTR_PIXEL(image, x, y)
-            );
-        }
+    if (!pntr_image_to_pixelformat_buffer(image, data, 0, pixelFormat)) {
+        PNTR_FREE(data);
+        return NULL;
     }
 
     // Output the data size
@@ -4952,6 +10486,55 @@ PNTR_API void* pntr_image_to_pixelformat(pntr_image* image, unsigned int* dataSi
     return data;
 }
 
+/**
+ * Converts the given image into a buffer you provide, using the provided pixel format.
+ *
+ * Rows are converted as a whole, so this is well suited to sending an image to a display or encoder every frame
+ * without allocating any memory.
+ *
+ * @param image The image to convert.
+ * @param buffer Where to write the image data. Must hold the height of the image times the stride.
+ * @param stride The amount of bytes between each row in the buffer. Use 0 when the rows are tightly packed.
+ * @param pixelFormat The desired pixel format of the image data.
+ *
+ * @return True on success, false otherwise.
+ *
+ * @see pntr_image_to_pixelformat()
+ * @see pntr_image_from_pixelformat_buffer()
+ */
+PNTR_API bool pntr_image_to_pixelformat_buffer(pntr_image* image, void* buffer, int stride, pntr_pixelformat pixelFormat) {
+    if (image == NULL || buffer == NULL || pixelFormat < 0 || pixelFormat > PNTR_PIXELFORMAT_A8) {
+        pntr_set_error(PNTR_ERROR_INVALID_ARGS);
+        return false;
+    }
+
+    int pixelSize = pntr_get_pixel_data_size(1, 1, pixelFormat);
+    if (stride <= 0) {
+        stride = image->width * pixelSize;
+    }
+
+    pntr_color converted[64];
+    for (int y = 0; y < image->height; y++) {
+        unsigned char* row = (unsigned char*)buffer + (size_t)y * (size_t)stride;
+        pntr_color* pixel = &PNTR_PIXEL(image, 0, y);
+        if (!image->premultiplied) {
+            _pntr_pixelformat_row_to(row, pixel, image->width, pixelFormat);
+            continue;
+        }
+
+        // Premultiplied images are always stored with straight alpha.
+        for (int x = 0; x < image->width; x += 64) {
+            int chunk = PNTR_MIN(64, image->width - x);
+            for (int i = 0; i < chunk; i++) {
+                converted[i] = pntr_color_alpha_unpremultiply(pixel[x + i]);
+            }
+            _pntr_pixelformat_row_to(row + x * pixelSize, converted, chunk, pixelFormat);
+        }
+    }
+
+    return true;
+}
+
 /**
  * Gets a PNG representation of the given image in memory.
  *
@@ -4973,6 +10556,19 @@ PNTR_API unsigned char* pntr_save_image_to_memory(pntr_image* image, pntr_image_
         return (unsigned char*)pntr_set_error(PNTR_ERROR_INVALID_ARGS);
     }
 
+    // Image encoders expect straight alpha.
+    if (image->premultiplied) {
+        pntr_image* straight = pntr_image_copy(image);
+        if (straight == NULL) {
+            return NULL;
+        }
+
+        pntr_image_alpha_unpremultiply(straight);
+        unsigned char* output = PNTR_SAVE_IMAGE_TO_MEMORY(straight, type, dataSize);
+        pntr_unload_image(straight);
+        return output;
+    }
+
     return PNTR_SAVE_IMAGE_TO_MEMORY(image, type, dataSize);
 }
 
@@ -5084,16 +10680,19 @@ PNTR_API bool pntr_image_crop(pntr_image* image, int x, int y, int width, int he
         return false;
     }
 
-    // Clear the data if it isn't owned by another image.
-    if (!image->subimage) {
-        PNTR_FREE(image->data);
-    }
+    // Clear the data if it's owned by the image.
+    _pntr_image_free_data(image);
+    pntr_image_unload_mipmaps(image);
 
     image->data = newImage->data;
     image->width = newImage->width;
     image->height = newImage->height;
     image->pitch = newImage->pitch;
     image->subimage = false;
+    image->owned = true;
+    image->aligned = newImage->aligned;
+    image->opacity = newImage->opacity;
+    image->parent = NULL;
     pntr_image_reset_clip(image);
 
     PNTR_FREE(newImage);
@@ -5189,20 +10788,11 @@ PNTR_API void pntr_image_color_contrast(pntr_image* image, float contrast) {
         return;
     }
 
-    if (contrast < -1.0f) {
-        contrast = -1.0f;
-    }
-    else if (contrast > 1.0f) {
-        contrast = 1.0f;
-    }
-
-    for (int y = image->clip.y; y < image->clip.y + image->clip.height; y++) {
-        pntr_color* pixel = &PNTR_PIXEL(image, image->clip.x, y);
-        for (int x = 0; x < image->clip.width; x++) {
-            *pixel = pntr_color_contrast(*pixel, contrast);
-            pixel++;
-        }
-    }
+    pntr_color_pipeline_stage stage;
+    pntr_color_pipeline pipeline;
+    _pntr_color_pipeline_local(&pipeline, &stage);
+    pntr_color_pipeline_contrast(&pipeline, contrast);
+    pntr_image_color_pipeline(image, &pipeline);
 }
 
 /**
@@ -5220,6 +10810,8 @@ PNTR_API void pntr_image_alpha_mask(pntr_image* image, pntr_image* alphaMask, in
         return;
     }
 
+    _pntr_image_modified(image);
+
     pntr_rectangle srcRect = PNTR_CLITERAL(pntr_rectangle) { 0, 0, alphaMask->width, alphaMask->height };
     pntr_rectangle dstRect = PNTR_CLITERAL(pntr_rectangle) { posX, posY, alphaMask->width, alphaMask->height };
 
@@ -5245,13 +10837,73 @@ PNTR_API void pntr_image_alpha_mask(pntr_image* image, pntr_image* alphaMask, in
         pntr_color* pixel = &PNTR_PIXEL(image, dstRect.x, dstRect.y + y);
         for (int x = 0; x < dstRect.width; x++) {
             if (pixel->rgba.a > 0) {
-                pixel->rgba.a = PNTR_PIXEL(alphaMask, x, y).rgba.a;
+                unsigned char alpha = PNTR_PIXEL(alphaMask, x, y).rgba.a;
+                if (image->premultiplied) {
+                    // Scale the color channels along with the alpha.
+                    pntr_color color = pntr_color_alpha_unpremultiply(*pixel);
+                    color.rgba.a = alpha;
+                    *pixel = pntr_color_alpha_premultiply(color);
+                }
+                else {
+                    pixel->rgba.a = alpha;
+                }
             }
             pixel++;
         }
     }
 }
 
+/**
+ * Premultiplies the color channels of the image by their alpha.
+ *
+ * This applies to the whole image, ignoring clipping. Blending premultiplied images into each other avoids a division
+ * for every translucent pixel.
+ *
+ * @param image The image to premultiply. Does nothing if the image is already premultiplied.
+ *
+ * @see pntr_image_alpha_unpremultiply()
+ * @see pntr_color_alpha_premultiply()
+ */
+PNTR_API void pntr_image_alpha_premultiply(pntr_image* image) {
+    if (image == NULL || image->premultiplied) {
+        return;
+    }
+
+    for (int y = 0; y < image->height; y++) {
+        pntr_color* pixel = &PNTR_PIXEL(image, 0, y);
+        for (int x = 0; x < image->width; x++) {
+            pixel[x] = pntr_color_alpha_premultiply(pixel[x]);
+        }
+    }
+
+    image->premultiplied = true;
+    pntr_image_alpha_premultiply(image->mipmap);
+}
+
+/**
+ * Converts a premultiplied image back to straight alpha.
+ *
+ * @param image The image to convert. Does nothing if the image is not premultiplied.
+ *
+ * @see pntr_image_alpha_premultiply()
+ * @see pntr_color_alpha_unpremultiply()
+ */
+PNTR_API void pntr_image_alpha_unpremultiply(pntr_image* image) {
+    if (image == NULL || !image->premultiplied) {
+        return;
+    }
+
+    for (int y = 0; y < image->height; y++) {
+        pntr_color* pixel = &PNTR_PIXEL(image, 0, y);
+        for (int x = 0; x < image->width; x++) {
+            pixel[x] = pntr_color_alpha_unpremultiply(pixel[x]);
+        }
+    }
+
+    image->premultiplied = false;
+    pntr_image_alpha_unpremultiply(image->mipmap);
+}
+
 /**
  * Resize the canvas of the given image.
  *
@@ -5270,17 +10922,17 @@ PNTR_API bool pntr_image_resize_canvas(pntr_image* image, int newWidth, int newH
         return false;
     }
 
-    pntr_image* newImage = pntr_gen_image_color(newWidth, newHeight, fill);
+    pntr_image* newImage = pntr_gen_image_color(newWidth, newHeight, image->premultiplied ? pntr_color_alpha_premultiply(fill) : fill);
     if (newImage == NULL) {
         return false;
     }
 
+    newImage->premultiplied = image->premultiplied;
     pntr_draw_image(newImage, image, offsetX, offsetY);
 
-    // Clear the image if it's not a subimage
-    if (!image->subimage) {
-        PNTR_FREE(image->data);
-    }
+    // Clear the image data if it's owned by the image
+    _pntr_image_free_data(image);
+    pntr_image_unload_mipmaps(image);
 
     image->data = newImage->data;
     image->width = newImage->width;
@@ -5290,6 +10942,10 @@ PNTR_API bool pntr_image_resize_canvas(pntr_image* image, int newWidth, int newH
     // TODO: pntr_image_resize_canvas - Adust the new image clip with the original one.
     pntr_image_reset_clip(image);
     image->subimage = false;
+    image->owned = true;
+    image->aligned = newImage->aligned;
+    image->opacity = newImage->opacity;
+    image->parent = NULL;
 
     PNTR_FREE(newImage);
     return true;
@@ -5324,6 +10980,7 @@ PNTR_API void pntr_draw_image_flipped_rec(pntr_image* dst, pntr_image* src, pntr
         return;
     }
 
+    _pntr_image_modified(dst);
     int dstX, dstY;
     for (int y = 0; y < srcRec.height; y++) {
         for (int x = 0; x < srcRec.width; x++) {
@@ -5337,7 +10994,7 @@ PNTR_API void pntr_draw_image_flipped_rec(pntr_image* dst, pntr_image* src, pntr
                 dstX = flipHorizontal ? srcRec.width - x - 1 : x;
             }
 
-            pntr_draw_point(dst, posX + dstX, posY + dstY,
+            _pntr_draw_sample(dst, posX + dstX, posY + dstY, src,
                 pntr_image_get_color(src, x, y)
             );
         }
@@ -5355,7 +11012,10 @@ PNTR_API void pntr_draw_image_flipped_rec(pntr_image* dst, pntr_image* src, pntr
  * @param scaleY The scale of which to apply to the height of the image.
  * @param offsetX How much to offset the X drawing of the image, relative from its original source size.
  * @param offsetY How much to offset the Y drawing of the image, relative from its original source size.
- * @param filter Filter to be applied during the rotation.
+ * @param filter Filter to be applied during the scaling.
+ *
+ * @see pntr_draw_image_scaled_rec()
+ * @see pntr_image_gen_mipmaps()
  */
 PNTR_API void pntr_draw_image_scaled(pntr_image* dst, pntr_image* src, int posX, int posY, float scaleX, float scaleY, float offsetX, float offsetY, pntr_filter filter) {
     if (dst == NULL || src == NULL) {
@@ -5370,6 +11030,78 @@ PNTR_API void pntr_draw_image_scaled(pntr_image* dst, pntr_image* src, int posX,
         filter);
 }
 
+/**
+ * Picks the levels of an image's mipmap chain to sample a portion of it drawn at the given scale.
+ *
+ * The levels are returned as views of the portion within each level, so that sampling clamps to its edges. Nearest
+ * neighbor filtering picks the closest level, while the other filters blend the two levels around the scale.
+ *
+ * @param src The image, which may not have a mipmap chain.
+ * @param srcRect The portion of the image, within its bounds.
+ * @param scale The scale the portion is drawn at.
+ * @param filter The filter to sample with.
+ * @param levels Where to store the views of the levels to sample.
+ *
+ * @return The weight of the second level out of 256, or 0 when only the first level is sampled.
+ *
+ * @see pntr_image_gen_mipmaps()
+ * @internal
+ */
+static int _pntr_mipmap_select(pntr_image* src, pntr_rectangle srcRect, float scale, pntr_filter filter, pntr_image levels[2]) {
+    // Nearest neighbor switches levels halfway between them, in powers of two.
+    float threshold = filter == PNTR_FILTER_NEARESTNEIGHBOR ? 0.70710678f : 0.5f;
+    int right = srcRect.x + srcRect.width;
+    int bottom = srcRect.y + srcRect.height;
+    pntr_image* level = src;
+    while (level->mipmap != NULL && scale <= threshold) {
+        level = level->mipmap;
+        scale *= 2.0f;
+        srcRect.x >>= 1;
+        srcRect.y >>= 1;
+        right = (right + 1) >> 1;
+        bottom = (bottom + 1) >> 1;
+    }
+
+    for (int i = 0; i < 2; i++) {
+        levels[i] = *level;
+        levels[i].data = &PNTR_PIXEL(level, srcRect.x, srcRect.y);
+        levels[i].width = right - srcRect.x;
+        levels[i].height = bottom - srcRect.y;
+        if (filter == PNTR_FILTER_NEARESTNEIGHBOR || level->mipmap == NULL || scale >= 1.0f) {
+            return 0;
+        }
+
+        level = level->mipmap;
+        srcRect.x >>= 1;
+        srcRect.y >>= 1;
+        right = (right + 1) >> 1;
+        bottom = (bottom + 1) >> 1;
+    }
+
+    // Between the two levels, the inverse of the scale goes from 1 to 2, which is close enough to the level of detail.
+    return (int)((1.0f / scale - 1.0f) * 256.0f);
+}
+
+/**
+ * Draw a scaled portion of an image.
+ *
+ * When the image has a mipmap chain and is drawn smaller than its size, the levels that match the scale are sampled
+ * instead. Nearest neighbor filtering picks the closest level, while the other filters blend the two nearest levels.
+ *
+ * @param dst Pointer to the destination image where the output will be stored.
+ * @param src Pointer to the source image that will be drawn onto the destination image.
+ * @param srcRect The portion of the source image to draw.
+ * @param posX Where to draw the scaled image, at the X coordinate.
+ * @param posY Where to draw the scaled image, at the Y coordinate.
+ * @param scaleX The scale of which to apply to the width of the image.
+ * @param scaleY The scale of which to apply to the height of the image.
+ * @param offsetX How much to offset the X drawing of the image, relative from its original source size.
+ * @param offsetY How much to offset the Y drawing of the image, relative from its original source size.
+ * @param filter Filter to be applied during the scaling.
+ *
+ * @see pntr_draw_image_scaled()
+ * @see pntr_image_gen_mipmaps()
+ */
 PNTR_API void pntr_draw_image_scaled_rec(pntr_image* dst, pntr_image* src, pntr_rectangle srcRect, int posX, int posY, float scaleX, float scaleY, float offsetX, float offsetY, pntr_filter filter) {
     if (dst == NULL || src == NULL || scaleX <= 0.0f || scaleY <= 0.0f) {
         return;
@@ -5381,68 +11113,82 @@ PNTR_API void pntr_draw_image_scaled_rec(pntr_image* dst, pntr_image* src, pntr_
 
     int newWidth = (int)((float)srcRect.width * scaleX);
     int newHeight = (int)((float)srcRect.height * scaleY);
+    if (newWidth <= 0 || newHeight <= 0) {
+        return;
+    }
+
     int offsetXRatio = (int)(offsetX / (float)srcRect.width * (float)newWidth);
     int offsetYRatio = (int)(offsetY / (float)srcRect.height * (float)newHeight);
 
-    switch (filter) {
-        case PNTR_FILTER_BILINEAR: {
-            float xRatio = (float)srcRect.width / (float)newWidth;
-            float yRatio = (float)srcRect.height / (float)newHeight;
+    // Only visit the pixels within the clip.
+    int left = posX - offsetXRatio;
+    int top = posY - offsetYRatio;
+    int startX = PNTR_MAX(dst->clip.x - left, 0);
+    int startY = PNTR_MAX(dst->clip.y - top, 0);
+    int endX = PNTR_MIN(dst->clip.x + dst->clip.width - left, newWidth);
+    int endY = PNTR_MIN(dst->clip.y + dst->clip.height - top, newHeight);
+    if (startX >= endX || startY >= endY) {
+        return;
+    }
 
-            for (int y = 0; y < newHeight; y++) {
-                int yPosition = posY + y - offsetYRatio;
-                if (yPosition < dst->clip.y || yPosition >= dst->clip.y + dst->clip.height) {
-                    continue;
-                }
-                float srcY = (float)y * yRatio;
-                int srcYPixel = srcRect.y + (int)srcY;
-                int srcYPixelPlusOne = y == newHeight - 1 ? (int)srcYPixel : (int)srcYPixel + 1;
-                for (int x = 0; x < newWidth; x++) {
-                    int xPosition = posX + x - offsetXRatio;
-                    if (xPosition < dst->clip.x || xPosition >= dst->clip.x + dst->clip.width) {
-                        continue;
-                    }
-                    float srcX = (float)x * xRatio;
-                    int srcXPixel = srcRect.y + (int)srcX;
-                    int srcXPixelPlusOne = x == newWidth - 1 ? (int)srcXPixel : (int)srcXPixel + 1;
-                    pntr_draw_point_unsafe(dst, xPosition, yPosition, pntr_color_bilinear_interpolate(
-                        src->data[srcYPixel * (src->pitch >> 2) + srcXPixel],
-                        src->data[srcYPixelPlusOne * (src->pitch >> 2) + srcXPixel],
-                        src->data[srcYPixel * (src->pitch >> 2) + srcXPixelPlusOne],
-                        src->data[srcYPixelPlusOne * (src->pitch >> 2) + srcXPixelPlusOne],
-                        srcX - PNTR_FLOORF(srcX),
-                        srcY - PNTR_FLOORF(srcY)
-                    ));
-                }
+    _pntr_image_modified(dst);
+
+    // Minified images sample the levels of their mipmap chain that match the scale.
+    pntr_image levels[2];
+    int blend = _pntr_mipmap_select(src, srcRect, PNTR_MIN(scaleX, scaleY), filter, levels);
+
+    if (filter == PNTR_FILTER_NEARESTNEIGHBOR) {
+        // The level may be smaller than the output on one axis, so the steps are exact and clamped to its edges.
+        pntr_image* level = &levels[0];
+        int xRatio = (level->width << 16) / newWidth;
+        int yRatio = (level->height << 16) / newHeight;
+
+        for (int y = startY; y < endY; y++) {
+            pntr_color* row = &PNTR_PIXEL(level, 0, PNTR_MIN((y * yRatio) >> 16, level->height - 1));
+            for (int x = startX; x < endX; x++) {
+                _pntr_draw_sample_unsafe(dst, left + x, top + y, src, row[PNTR_MIN((x * xRatio) >> 16, level->width - 1)]);
             }
         }
-        break;
-        case PNTR_FILTER_NEARESTNEIGHBOR:
-        default: {
-            int xRatio = (srcRect.width << 16) / newWidth + 1;
-            int yRatio = (srcRect.height << 16) / newHeight + 1;
 
-            for (int y = 0; y < newHeight; y++) {
-                int yPosition = posY + y - offsetYRatio;
-                if (yPosition < dst->clip.y || yPosition >= dst->clip.y + dst->clip.height) {
-                    continue;
-                }
-                int y2 = (y * yRatio) >> 16;
-                for (int x = 0; x < newWidth; x++) {
-                    int xPosition = posX + x - offsetXRatio;
-                    if (xPosition < dst->clip.x || xPosition >= dst->clip.x + dst->clip.width) {
-                        continue;
-                    }
-                    int x2 = (x * xRatio) >> 16;
-                    pntr_draw_point_unsafe(dst,
-                        xPosition,
-                        yPosition,
-                        PNTR_PIXEL(src, srcRect.x + x2, srcRect.y + y2)
-                    );
-                }
+        return;
+    }
+
+    // The texture coordinates of each level are 16.16 fixed point, aligned to the centers of the pixels.
+    int count = blend > 0 ? 2 : 1;
+    int64_t stepU[2], stepV[2], startU[2], v[2];
+    for (int i = 0; i < count; i++) {
+        stepU[i] = ((int64_t)levels[i].width << 16) / newWidth;
+        stepV[i] = ((int64_t)levels[i].height << 16) / newHeight;
+        startU[i] = stepU[i] / 2 - 0x8000 + stepU[i] * startX;
+        v[i] = stepV[i] / 2 - 0x8000 + stepV[i] * startY;
+    }
+
+    for (int y = startY; y < endY; y++) {
+        int64_t u0 = startU[0];
+        int64_t u1 = startU[1];
+        for (int x = startX; x < endX; x++) {
+            pntr_color color = _pntr_image_sample(&levels[0], u0, v[0], filter);
+            u0 += stepU[0];
+            if (count == 2) {
+                // Blend the two levels together, for trilinear filtering.
+                pntr_color next = _pntr_image_sample(&levels[1], u1, v[1], filter);
+                u1 += stepU[1];
+                #define _PNTR_MIPMAP_BLEND(channel) (unsigned char)((color.rgba.channel * (256 - blend) + next.rgba.channel * blend) >> 8)
+                color = PNTR_NEW_COLOR(
+                    _PNTR_MIPMAP_BLEND(r),
+                    _PNTR_MIPMAP_BLEND(g),
+                    _PNTR_MIPMAP_BLEND(b),
+                    _PNTR_MIPMAP_BLEND(a)
+                );
+                #undef _PNTR_MIPMAP_BLEND
             }
+
+            _pntr_draw_sample_unsafe(dst, left + x, top + y, src, color);
+        }
+
+        for (int i = 0; i < count; i++) {
+            v[i] += stepV[i];
         }
-        break;
     }
 }
 
@@ -5497,6 +11243,7 @@ PNTR_API pntr_image* pntr_image_rotate(pntr_image* image, float degrees, pntr_fi
             return NULL;
         }
 
+        output->premultiplied = image->premultiplied;
         pntr_draw_image_rotated(output, image, 0, 0, degrees, 0.0f, 0.0f, filter);
 
         return output;
@@ -5514,6 +11261,7 @@ PNTR_API pntr_image* pntr_image_rotate(pntr_image* image, float degrees, pntr_fi
         return NULL;
     }
 
+    rotatedImage->premultiplied = image->premultiplied;
     pntr_draw_image_rotated(rotatedImage, image, 0, 0, degrees, 0.0f, 0.0f, filter);
 
     return rotatedImage;
@@ -5601,6 +11349,8 @@ PNTR_API void pntr_draw_image_rotated_rec(pntr_image* dst, pntr_image* src, pntr
         return;
     }
 
+    _pntr_image_modified(dst);
+
     // Clean up the source rectangle.
     if (srcRect.x < 0) {
         srcRect.x = 0;
@@ -5639,22 +11389,25 @@ PNTR_API void pntr_draw_image_rotated_rec(pntr_image* dst, pntr_image* src, pntr
         for (int y = 0; y < srcRect.height; y++) {
             for (int x = 0; x < srcRect.width; x++) {
                 if (degrees == 90.0f) {
-                    pntr_draw_point(dst,
+                    _pntr_draw_sample(dst,
                         dstRect.x + y,
                         dstRect.y + srcRect.width - x,
+                        src,
                         PNTR_PIXEL(src, srcRect.x + x, srcRect.y + y)
                     );
                 } else if (degrees == 180.0f) {
-                    pntr_draw_point(dst,
+                    _pntr_draw_sample(dst,
                         dstRect.x + srcRect.width - x,
                         dstRect.y + srcRect.height - y,
+                        src,
                         PNTR_PIXEL(src, srcRect.x + x, srcRect.y + y)
                     );
                 }
                 else {
-                    pntr_draw_point(dst,
+                    _pntr_draw_sample(dst,
                         dstRect.x + srcRect.height - y,
                         dstRect.y + x,
+                        src,
                         PNTR_PIXEL(src, srcRect.x + x, srcRect.y + y)
                     );
                 }
@@ -5710,9 +11463,10 @@ PNTR_API void pntr_draw_image_rotated_rec(pntr_image* dst, pntr_image* src, pntr
             srcYint = (int)srcY + srcRect.y;
 
             if (filter == PNTR_FILTER_NEARESTNEIGHBOR) {
-                pntr_draw_point_unsafe(dst,
+                _pntr_draw_sample_unsafe(dst,
                     destX,
                     destY,
+                    src,
                     PNTR_PIXEL(src, srcXint, srcYint)
                 );
             }
@@ -5722,9 +11476,10 @@ PNTR_API void pntr_draw_image_rotated_rec(pntr_image* dst, pntr_image* src, pntr
                     continue;
                 }
 
-                pntr_draw_point_unsafe(dst,
+                _pntr_draw_sample_unsafe(dst,
                     destX,
                     destY,
+                    src,
                     pntr_color_bilinear_interpolate(
                         PNTR_PIXEL(src, srcXint, srcYint),
                         PNTR_PIXEL(src, srcXint, srcYint + 1),
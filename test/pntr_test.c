@@ -15,6 +15,13 @@
 #define RECTEQUALS PNTR_ASSERT_RECT_EQUALS
 #include "../pntr_assert.h"
 
+// Without PNTR_IMAGE_ALIGNMENT, rows are only aligned to the size of a pixel.
+#ifdef PNTR_IMAGE_ALIGNMENT
+    #define PNTR_TEST_ALIGNMENT PNTR_IMAGE_ALIGNMENT
+#else
+    #define PNTR_TEST_ALIGNMENT 4
+#endif
+
 bool pntr_utf8() {
     #ifdef PNTR_ENABLE_UTF8
         return true;
@@ -53,6 +60,12 @@ MODULE(pntr_math, {
         EQUALS((int)PNTR_FLOORF(0.0f), 0);
     });
 
+    IT("PNTR_SQRTF", {
+        EQUALS((int)PNTR_SQRTF(16.0f), 4);
+        EQUALS((int)(PNTR_SQRTF(2.0f) * 1000.0f), 1414);
+        EQUALS((int)PNTR_SQRTF(0.0f), 0);
+    });
+
     IT("PNTR_FMODF", {
         EQUALS((int)PNTR_FMODF(10.0f, 3.0f), 1);
         EQUALS((int)PNTR_FMODF(9.0f, 3.0f), 0);
@@ -133,6 +146,45 @@ MODULE(pntr, {
         pntr_unload_image(image);
     });
 
+    IT("pntr_new_image(), PNTR_IMAGE_ALIGNMENT", {
+        pntr_image* image = pntr_gen_image_color(33, 5, PNTR_RED);
+        NEQUALS(image, NULL);
+        EQUALS(image->pitch % PNTR_TEST_ALIGNMENT, 0);
+        EQUALS((int)((uintptr_t)image->data % PNTR_TEST_ALIGNMENT), 0);
+        EQUALS(image->pitch, (33 * 4 + PNTR_TEST_ALIGNMENT - 1) / PNTR_TEST_ALIGNMENT * PNTR_TEST_ALIGNMENT);
+
+        // Rows are independent of the padding after them
+        pntr_draw_line_vertical(image, 32, 0, 5, PNTR_BLUE);
+        COLOREQUALS(pntr_image_get_color(image, 32, 4), PNTR_BLUE);
+        COLOREQUALS(pntr_image_get_color(image, 0, 1), PNTR_RED);
+
+        pntr_image* copy = pntr_image_copy(image);
+        NEQUALS(copy, NULL);
+        IMAGEEQUALS(copy, image);
+        pntr_unload_image(copy);
+
+        pntr_image* section = pntr_image_from_image(image, 30, 1, 3, 3);
+        NEQUALS(section, NULL);
+        EQUALS((int)((uintptr_t)section->data % PNTR_TEST_ALIGNMENT), 0);
+        COLOREQUALS(pntr_image_get_color(section, 2, 2), PNTR_BLUE);
+        COLOREQUALS(pntr_image_get_color(section, 0, 0), PNTR_RED);
+        pntr_unload_image(section);
+
+        // Cropping in place keeps the data aligned
+        pntr_image_crop(image, 31, 0, 2, 5);
+        EQUALS(image->width, 2);
+        EQUALS((int)((uintptr_t)image->data % PNTR_TEST_ALIGNMENT), 0);
+        COLOREQUALS(pntr_image_get_color(image, 1, 4), PNTR_BLUE);
+
+        unsigned int dataSize;
+        unsigned char* pixels = (unsigned char*)pntr_image_to_pixelformat(image, &dataSize, PNTR_PIXELFORMAT_RGB888);
+        NEQUALS(pixels, NULL);
+        EQUALS(dataSize, 2 * 5 * 3);
+        pntr_unload_memory(pixels);
+
+        pntr_unload_image(image);
+    });
+
     IT("pntr_clear_background(), pntr_draw_rectangle_fill()", {
         pntr_image* image = pntr_new_image(100, 100);
         NEQUALS(image, NULL);
@@ -179,6 +231,993 @@ MODULE(pntr, {
         pntr_unload_image(image);
     });
 
+    IT("pntr_draw_line_thick(), pntr_draw_line_thick_cap()", {
+        pntr_color translucent = pntr_new_color(0, 0, 255, 100);
+        pntr_image* image = pntr_gen_image_color(50, 50, PNTR_WHITE);
+        pntr_image* expected = pntr_gen_image_color(50, 50, PNTR_WHITE);
+
+        // Butt ends cover the length of the line, with the thickness centered on it.
+        pntr_draw_line_thick_cap(image, 10, 10, 30, 10, 4, PNTR_LINE_CAP_BUTT, translucent);
+        pntr_draw_rectangle_fill(expected, 10, 8, 20, 4, translucent);
+        IMAGEEQUALS(image, expected);
+
+        // Square ends reach half of the thickness past each end.
+        pntr_draw_line_thick_cap(image, 20, 30, 20, 40, 3, PNTR_LINE_CAP_SQUARE, PNTR_RED);
+        pntr_draw_rectangle_fill(expected, 19, 29, 3, 13, PNTR_RED);
+        IMAGEEQUALS(image, expected);
+
+        // A translucent line blends each pixel only once, round ends included.
+        pntr_clear_background(image, PNTR_WHITE);
+        pntr_draw_line_thick(image, 5, 40, 40, 8, 9, translucent);
+        pntr_color blended = pntr_color_alpha_blend(PNTR_WHITE, translucent);
+        int drawn = 0;
+        int other = 0;
+        for (int y = 0; y < image->height; y++) {
+            for (int x = 0; x < image->width; x++) {
+                pntr_color pixel = pntr_image_get_color(image, x, y);
+                if (pixel.value == blended.value) {
+                    drawn++;
+                }
+                else if (pixel.value != PNTR_WHITE_VALUE) {
+                    other++;
+                }
+            }
+        }
+        EQUALS(other, 0);
+        NEQUALS(drawn, 0);
+        COLOREQUALS(pntr_image_get_color(image, 5, 40), blended);
+        COLOREQUALS(pntr_image_get_color(image, 0, 40), PNTR_WHITE);
+
+        pntr_unload_image(expected);
+        pntr_unload_image(image);
+    });
+
+    IT("pntr_draw_polyline_thick_ex(), pntr_draw_polygon_thick_ex()", {
+        pntr_color translucent = pntr_new_color(0, 0, 255, 100);
+        pntr_image* image = pntr_gen_image_color(50, 50, PNTR_WHITE);
+        pntr_image* expected = pntr_gen_image_color(50, 50, PNTR_WHITE);
+
+        // Mitered corners of a square outline meet like a rectangle's frame, with each pixel blended once.
+        pntr_vector square[] = {{10, 10}, {40, 10}, {40, 40}, {10, 40}};
+        pntr_draw_polygon_thick_ex(image, square, 4, 4, PNTR_LINE_JOIN_MITER, translucent);
+        pntr_draw_rectangle_fill(expected, 8, 8, 34, 4, translucent);
+        pntr_draw_rectangle_fill(expected, 8, 38, 34, 4, translucent);
+        pntr_draw_rectangle_fill(expected, 8, 12, 4, 26, translucent);
+        pntr_draw_rectangle_fill(expected, 38, 12, 4, 26, translucent);
+        IMAGEEQUALS(image, expected);
+
+        // Bevel and round joins cut the outer corner
+        pntr_vector corner[] = {{10, 10}, {30, 10}, {30, 30}};
+        pntr_clear_background(image, PNTR_WHITE);
+        pntr_draw_polyline_thick_ex(image, corner, 3, 4, PNTR_LINE_JOIN_BEVEL, PNTR_LINE_CAP_BUTT, PNTR_RED);
+        COLOREQUALS(pntr_image_get_color(image, 31, 8), PNTR_WHITE);
+        COLOREQUALS(pntr_image_get_color(image, 31, 9), PNTR_WHITE);
+        COLOREQUALS(pntr_image_get_color(image, 31, 10), PNTR_RED);
+        COLOREQUALS(pntr_image_get_color(image, 9, 10), PNTR_WHITE);
+        pntr_clear_background(image, PNTR_WHITE);
+        pntr_draw_polyline_thick_ex(image, corner, 3, 4, PNTR_LINE_JOIN_ROUND, PNTR_LINE_CAP_SQUARE, PNTR_RED);
+        COLOREQUALS(pntr_image_get_color(image, 31, 8), PNTR_WHITE);
+        COLOREQUALS(pntr_image_get_color(image, 31, 9), PNTR_RED);
+        COLOREQUALS(pntr_image_get_color(image, 9, 10), PNTR_RED);
+
+        // A translucent zigzag blends each pixel once, even where its segments overlap.
+        pntr_vector zigzag[] = {{5, 45}, {15, 5}, {25, 45}, {35, 5}, {45, 45}, {5, 25}};
+        pntr_clear_background(image, PNTR_WHITE);
+        pntr_draw_polyline_thick(image, zigzag, 6, 7, translucent);
+        pntr_color blended = pntr_color_alpha_blend(PNTR_WHITE, translucent);
+        int other = 0;
+        for (int y = 0; y < image->height; y++) {
+            for (int x = 0; x < image->width; x++) {
+                pntr_color pixel = pntr_image_get_color(image, x, y);
+                if (pixel.value != blended.value && pixel.value != PNTR_WHITE_VALUE) {
+                    other++;
+                }
+            }
+        }
+        EQUALS(other, 0);
+        COLOREQUALS(pntr_image_get_color(image, 15, 5), blended);
+        COLOREQUALS(pntr_image_get_color(image, 25, 35), blended);
+
+        // Outlines crossing the right of the clip are filled up to it.
+        pntr_vector across[] = {{10, 25}, {100, 25}};
+        pntr_clear_background(image, PNTR_WHITE);
+        pntr_draw_polyline_thick(image, across, 2, 3, PNTR_RED);
+        COLOREQUALS(pntr_image_get_color(image, 10, 25), PNTR_RED);
+        COLOREQUALS(pntr_image_get_color(image, 49, 24), PNTR_RED);
+        COLOREQUALS(pntr_image_get_color(image, 49, 26), PNTR_RED);
+        COLOREQUALS(pntr_image_get_color(image, 49, 28), PNTR_WHITE);
+        pntr_vector wide[] = {{20, 10}, {80, 10}, {80, 40}, {20, 40}};
+        pntr_clear_background(image, PNTR_WHITE);
+        pntr_image_set_clip(image, 0, 0, 40, 50);
+        pntr_draw_polygon_thick(image, wide, 4, 4, PNTR_RED);
+        COLOREQUALS(pntr_image_get_color(image, 39, 10), PNTR_RED);
+        COLOREQUALS(pntr_image_get_color(image, 39, 40), PNTR_RED);
+        COLOREQUALS(pntr_image_get_color(image, 20, 25), PNTR_RED);
+        COLOREQUALS(pntr_image_get_color(image, 30, 25), PNTR_WHITE);
+        COLOREQUALS(pntr_image_get_color(image, 40, 10), PNTR_WHITE);
+        pntr_image_reset_clip(image);
+
+        pntr_unload_image(expected);
+        pntr_unload_image(image);
+    });
+
+    IT("pntr_draw_line_aa(), pntr_draw_circle_aa(), pntr_draw_polygon_fill_aa()", {
+        pntr_image* image = pntr_gen_image_color(50, 50, PNTR_WHITE);
+        pntr_image* expected = pntr_gen_image_color(50, 50, PNTR_WHITE);
+
+        // A straight line covers whole pixels, from one end to the other.
+        pntr_draw_line_aa(image, 5, 10, 40, 10, PNTR_RED);
+        pntr_draw_rectangle_fill(expected, 5, 10, 36, 1, PNTR_RED);
+        IMAGEEQUALS(image, expected);
+
+        // Edges through the centers of pixels cover half of them, and corners a quarter.
+        pntr_vector square[] = {{10, 10}, {20, 10}, {20, 20}, {10, 20}};
+        pntr_clear_background(image, PNTR_BLANK);
+        pntr_draw_polygon_fill_aa(image, square, 4, PNTR_RED);
+        pntr_color half = pntr_color_alpha_blend(PNTR_BLANK, pntr_new_color(255, 0, 0, 128));
+        pntr_color quarter = pntr_color_alpha_blend(PNTR_BLANK, pntr_new_color(255, 0, 0, 64));
+        COLOREQUALS(pntr_image_get_color(image, 15, 15), PNTR_RED);
+        EQUALS(pntr_image_get_color(image, 10, 15).rgba.a, half.rgba.a);
+        EQUALS(pntr_image_get_color(image, 15, 20).rgba.a, half.rgba.a);
+        EQUALS(pntr_image_get_color(image, 10, 10).rgba.a, quarter.rgba.a);
+        EQUALS(pntr_image_get_color(image, 9, 15).rgba.a, 0);
+        EQUALS(pntr_image_get_color(image, 21, 15).rgba.a, 0);
+
+        // The coverage of a filled circle adds up to its area.
+        pntr_clear_background(image, PNTR_BLANK);
+        pntr_draw_circle_fill_aa(image, 25, 25, 10, PNTR_RED);
+        int total = 0;
+        for (int y = 0; y < image->height; y++) {
+            for (int x = 0; x < image->width; x++) {
+                total += pntr_image_get_color(image, x, y).rgba.a;
+            }
+        }
+        EQUALS(total / 255, 345);
+        EQUALS(pntr_image_get_color(image, 25, 25).rgba.a, 255);
+        EQUALS(pntr_image_get_color(image, 25, 35).rgba.a, 252);
+        EQUALS(pntr_image_get_color(image, 25, 36).rgba.a, 0);
+        EQUALS(pntr_image_get_color(image, 0, 0).rgba.a, 0);
+
+        // The outline is a pixel wide ring along the radius.
+        pntr_clear_background(image, PNTR_BLANK);
+        pntr_draw_circle_aa(image, 25, 25, 10, PNTR_RED);
+        EQUALS(pntr_image_get_color(image, 25, 25).rgba.a, 0);
+        EQUALS(pntr_image_get_color(image, 35, 25).rgba.a, 252);
+        EQUALS(pntr_image_get_color(image, 34, 25).rgba.a, 5);
+        EQUALS(pntr_image_get_color(image, 37, 25).rgba.a, 0);
+
+        // A diagonal line partially covers the pixels along its sides.
+        pntr_clear_background(image, PNTR_BLANK);
+        pntr_draw_line_aa(image, 0, 0, 49, 30, PNTR_RED);
+        EQUALS(pntr_image_get_color(image, 0, 2).rgba.a, 0);
+        unsigned char partial = pntr_image_get_color(image, 10, 7).rgba.a;
+        NEQUALS(partial, 0);
+        NEQUALS(partial, 255);
+
+        // Shapes off the edges of the image are clipped.
+        pntr_clear_background(image, PNTR_BLANK);
+        pntr_draw_ellipse_fill_aa(image, 0, 49, 20, 10, PNTR_RED);
+        EQUALS(pntr_image_get_color(image, 0, 49).rgba.a, 255);
+        EQUALS(pntr_image_get_color(image, 49, 0).rgba.a, 0);
+
+        // Shapes crossing the right of the clip are covered up to it.
+        pntr_vector wide[] = {{10, 10}, {80, 10}, {80, 40}, {10, 40}};
+        pntr_clear_background(image, PNTR_BLANK);
+        pntr_draw_polygon_fill_aa(image, wide, 4, PNTR_RED);
+        EQUALS(pntr_image_get_color(image, 11, 25).rgba.a, 255);
+        EQUALS(pntr_image_get_color(image, 49, 25).rgba.a, 255);
+        EQUALS(pntr_image_get_color(image, 49, 45).rgba.a, 0);
+        pntr_clear_background(image, PNTR_BLANK);
+        pntr_draw_line_aa(image, 10, 25, 200, 25, PNTR_RED);
+        EQUALS(pntr_image_get_color(image, 49, 25).rgba.a, 255);
+        pntr_clear_background(image, PNTR_BLANK);
+        pntr_image_set_clip(image, 0, 0, 40, 50);
+        pntr_draw_circle_fill_aa(image, 45, 25, 20, PNTR_RED);
+        EQUALS(pntr_image_get_color(image, 39, 25).rgba.a, 255);
+        EQUALS(pntr_image_get_color(image, 30, 25).rgba.a, 255);
+        EQUALS(pntr_image_get_color(image, 40, 25).rgba.a, 0);
+        pntr_image_reset_clip(image);
+
+        pntr_unload_image(expected);
+        pntr_unload_image(image);
+    });
+
+    IT("pntr_draw_circle_fill(), pntr_draw_ellipse_fill()", {
+        pntr_color translucent = pntr_new_color(0, 0, 255, 100);
+        pntr_color blended = pntr_color_alpha_blend(PNTR_WHITE, translucent);
+        pntr_image* image = pntr_gen_image_color(50, 50, PNTR_WHITE);
+
+        // A translucent circle blends each of its pixels once, including the center row.
+        pntr_draw_circle_fill(image, 25, 25, 10, translucent);
+        COLOREQUALS(pntr_image_get_color(image, 25, 25), blended);
+        COLOREQUALS(pntr_image_get_color(image, 15, 25), blended);
+        COLOREQUALS(pntr_image_get_color(image, 34, 25), blended);
+        COLOREQUALS(pntr_image_get_color(image, 35, 25), PNTR_WHITE);
+        COLOREQUALS(pntr_image_get_color(image, 25, 16), blended);
+        COLOREQUALS(pntr_image_get_color(image, 25, 15), PNTR_WHITE);
+
+        // So does an ellipse, even on rows the midpoint steps widen more than once.
+        pntr_clear_background(image, PNTR_WHITE);
+        pntr_draw_ellipse_fill(image, 25, 25, 20, 5, translucent);
+        int other = 0;
+        for (int y = 0; y < image->height; y++) {
+            for (int x = 0; x < image->width; x++) {
+                pntr_color pixel = pntr_image_get_color(image, x, y);
+                if (pixel.value != blended.value && pixel.value != PNTR_WHITE_VALUE) {
+                    other++;
+                }
+            }
+        }
+        EQUALS(other, 0);
+        COLOREQUALS(pntr_image_get_color(image, 25, 25), blended);
+        COLOREQUALS(pntr_image_get_color(image, 7, 25), blended);
+        COLOREQUALS(pntr_image_get_color(image, 25, 20), blended);
+        COLOREQUALS(pntr_image_get_color(image, 25, 19), PNTR_WHITE);
+
+        // Rows outside of the clip are skipped.
+        pntr_clear_background(image, PNTR_WHITE);
+        pntr_draw_circle_fill(image, 0, 49, 30, PNTR_RED);
+        COLOREQUALS(pntr_image_get_color(image, 0, 49), PNTR_RED);
+        COLOREQUALS(pntr_image_get_color(image, 0, 20), PNTR_RED);
+        COLOREQUALS(pntr_image_get_color(image, 49, 0), PNTR_WHITE);
+
+        pntr_unload_image(image);
+    });
+
+    IT("pntr_draw_circle_thick(), pntr_draw_ellipse_thick(), pntr_draw_rectangle_thick_rounded()", {
+        pntr_color translucent = pntr_new_color(0, 0, 255, 100);
+        pntr_color blended = pntr_color_alpha_blend(PNTR_WHITE, translucent);
+        pntr_image* image = pntr_gen_image_color(50, 50, PNTR_WHITE);
+
+        // The ring is as wide as the thickness, centered on the radius.
+        pntr_draw_circle_thick(image, 25, 25, 10, 4, translucent);
+        COLOREQUALS(pntr_image_get_color(image, 25, 25), PNTR_WHITE);
+        COLOREQUALS(pntr_image_get_color(image, 32, 25), PNTR_WHITE);
+        COLOREQUALS(pntr_image_get_color(image, 33, 25), blended);
+        COLOREQUALS(pntr_image_get_color(image, 36, 25), blended);
+        COLOREQUALS(pntr_image_get_color(image, 37, 25), PNTR_WHITE);
+        COLOREQUALS(pntr_image_get_color(image, 14, 25), blended);
+        COLOREQUALS(pntr_image_get_color(image, 25, 14), blended);
+        COLOREQUALS(pntr_image_get_color(image, 25, 36), blended);
+
+        // Each pixel is blended once.
+        pntr_clear_background(image, PNTR_WHITE);
+        pntr_draw_ellipse_thick(image, 25, 25, 20, 10, 5, translucent);
+        int other = 0;
+        int count = 0;
+        for (int y = 0; y < image->height; y++) {
+            for (int x = 0; x < image->width; x++) {
+                pntr_color pixel = pntr_image_get_color(image, x, y);
+                if (pixel.value == blended.value) {
+                    count++;
+                }
+                else if (pixel.value != PNTR_WHITE_VALUE) {
+                    other++;
+                }
+            }
+        }
+        EQUALS(other, 0);
+        NEQUALS(count, 0);
+        COLOREQUALS(pntr_image_get_color(image, 25, 25), PNTR_WHITE);
+        COLOREQUALS(pntr_image_get_color(image, 5, 25), blended);
+
+        // The line stays inside of the rectangle, following its corners.
+        pntr_clear_background(image, PNTR_WHITE);
+        pntr_draw_rectangle_thick_rounded(image, 5, 5, 40, 30, 10, 0, 0, 10, 3, translucent);
+        COLOREQUALS(pntr_image_get_color(image, 5, 20), blended);
+        COLOREQUALS(pntr_image_get_color(image, 7, 20), blended);
+        COLOREQUALS(pntr_image_get_color(image, 8, 20), PNTR_WHITE);
+        COLOREQUALS(pntr_image_get_color(image, 4, 20), PNTR_WHITE);
+        COLOREQUALS(pntr_image_get_color(image, 44, 5), blended);
+        COLOREQUALS(pntr_image_get_color(image, 5, 34), blended);
+        COLOREQUALS(pntr_image_get_color(image, 5, 5), PNTR_WHITE);
+        COLOREQUALS(pntr_image_get_color(image, 44, 34), PNTR_WHITE);
+        COLOREQUALS(pntr_image_get_color(image, 25, 35), PNTR_WHITE);
+
+        pntr_unload_image(image);
+    });
+
+    IT("pntr_draw_rectangle_rounded_fill(), pntr_draw_rectangle_rounded_fill_ex()", {
+        pntr_color translucent = pntr_new_color(0, 0, 255, 100);
+        pntr_color blended = pntr_color_alpha_blend(PNTR_WHITE, translucent);
+        pntr_image* image = pntr_gen_image_color(50, 50, PNTR_WHITE);
+        pntr_image* solid = pntr_gen_image_color(50, 50, PNTR_WHITE);
+
+        // Each pixel of a translucent panel is blended once, with only the rounded corners cut.
+        pntr_draw_rectangle_rounded_fill(image, 5, 10, 40, 30, 8, translucent);
+        int other = 0;
+        int count = 0;
+        for (int y = 0; y < image->height; y++) {
+            for (int x = 0; x < image->width; x++) {
+                pntr_color pixel = pntr_image_get_color(image, x, y);
+                if (pixel.value == blended.value) {
+                    count++;
+                }
+                else if (pixel.value != PNTR_WHITE_VALUE) {
+                    other++;
+                }
+            }
+        }
+        EQUALS(other, 0);
+        COLOREQUALS(pntr_image_get_color(image, 5, 10), PNTR_WHITE);
+        COLOREQUALS(pntr_image_get_color(image, 44, 39), PNTR_WHITE);
+        COLOREQUALS(pntr_image_get_color(image, 5, 25), blended);
+        COLOREQUALS(pntr_image_get_color(image, 25, 10), blended);
+        COLOREQUALS(pntr_image_get_color(image, 25, 39), blended);
+        COLOREQUALS(pntr_image_get_color(image, 25, 40), PNTR_WHITE);
+        COLOREQUALS(pntr_image_get_color(image, 45, 25), PNTR_WHITE);
+
+        // A solid panel covers the same pixels.
+        pntr_draw_rectangle_rounded_fill(solid, 5, 10, 40, 30, 8, PNTR_RED);
+        int solidCount = 0;
+        for (int y = 0; y < solid->height; y++) {
+            for (int x = 0; x < solid->width; x++) {
+                if (pntr_image_get_color(solid, x, y).value == PNTR_RED.value) {
+                    solidCount++;
+                }
+            }
+        }
+        EQUALS(solidCount, count);
+
+        // Each corner can have its own radius, and square ones are filled.
+        pntr_clear_background(image, PNTR_WHITE);
+        pntr_draw_rectangle_rounded_fill_ex(image, 5, 10, 40, 30, 0, 10, 4, 0, PNTR_RED);
+        COLOREQUALS(pntr_image_get_color(image, 5, 10), PNTR_RED);
+        COLOREQUALS(pntr_image_get_color(image, 44, 39), PNTR_RED);
+        COLOREQUALS(pntr_image_get_color(image, 42, 12), PNTR_WHITE);
+        COLOREQUALS(pntr_image_get_color(image, 5, 39), PNTR_WHITE);
+        COLOREQUALS(pntr_image_get_color(image, 6, 38), PNTR_RED);
+
+        // Without any radius, it is a plain rectangle.
+        pntr_clear_background(image, PNTR_WHITE);
+        pntr_clear_background(solid, PNTR_WHITE);
+        pntr_draw_rectangle_rounded_fill(image, 5, 10, 40, 30, 0, PNTR_RED);
+        pntr_draw_rectangle_fill(solid, 5, 10, 40, 30, PNTR_RED);
+        IMAGEEQUALS(image, solid);
+
+        pntr_unload_image(solid);
+        pntr_unload_image(image);
+    });
+
+    IT("pntr_draw_arc(), pntr_draw_arc_fill()", {
+        pntr_color translucent = pntr_new_color(0, 0, 255, 100);
+        pntr_color blended = pntr_color_alpha_blend(PNTR_WHITE, translucent);
+        pntr_image* image = pntr_gen_image_color(50, 50, PNTR_WHITE);
+        pntr_image* expected = pntr_gen_image_color(50, 50, PNTR_WHITE);
+
+        // A whole arc is the circle's outline.
+        pntr_draw_arc(image, 25, 25, 10.0f, 0.0f, 360.0f, 3, PNTR_RED);
+        pntr_draw_circle(expected, 25, 25, 10, PNTR_RED);
+        IMAGEEQUALS(image, expected);
+
+        // The segments don't change the result, and the angles can go either way.
+        pntr_clear_background(image, PNTR_WHITE);
+        pntr_clear_background(expected, PNTR_WHITE);
+        pntr_draw_arc_fill(image, 25, 25, 15.0f, 0.0f, -90.0f, 4, PNTR_RED);
+        pntr_draw_arc_fill(expected, 25, 25, 15.0f, 270.0f, 360.0f, 100, PNTR_RED);
+        IMAGEEQUALS(image, expected);
+        COLOREQUALS(pntr_image_get_color(image, 30, 20), PNTR_RED);
+        COLOREQUALS(pntr_image_get_color(image, 25, 10), PNTR_RED);
+        COLOREQUALS(pntr_image_get_color(image, 40, 25), PNTR_RED);
+        COLOREQUALS(pntr_image_get_color(image, 24, 20), PNTR_WHITE);
+        COLOREQUALS(pntr_image_get_color(image, 30, 26), PNTR_WHITE);
+
+        // A translucent pie slice wider than half of a turn blends each pixel once.
+        pntr_clear_background(image, PNTR_WHITE);
+        pntr_draw_arc_fill(image, 25, 25, 15.0f, 45.0f, 315.0f, 8, translucent);
+        int other = 0;
+        for (int y = 0; y < image->height; y++) {
+            for (int x = 0; x < image->width; x++) {
+                pntr_color pixel = pntr_image_get_color(image, x, y);
+                if (pixel.value != blended.value && pixel.value != PNTR_WHITE_VALUE) {
+                    other++;
+                }
+            }
+        }
+        EQUALS(other, 0);
+        COLOREQUALS(pntr_image_get_color(image, 25, 25), blended);
+        COLOREQUALS(pntr_image_get_color(image, 15, 25), blended);
+        COLOREQUALS(pntr_image_get_color(image, 30, 30), blended);
+        COLOREQUALS(pntr_image_get_color(image, 35, 25), PNTR_WHITE);
+        COLOREQUALS(pntr_image_get_color(image, 31, 30), PNTR_WHITE);
+
+        pntr_unload_image(expected);
+        pntr_unload_image(image);
+    });
+
+    IT("pntr_new_gradient_linear(), pntr_draw_rectangle_fill_gradient(), pntr_draw_polygon_fill_gradient()", {
+        pntr_image* image = pntr_gen_image_color(100, 100, PNTR_WHITE);
+        NEQUALS(image, NULL);
+
+        // Linear gradients reach their end colors at their end points, and pass through the middle stop.
+        pntr_color colors[] = {PNTR_RED, PNTR_GREEN, PNTR_BLUE};
+        pntr_gradient* gradient = pntr_new_gradient_linear(0.0f, 0.0f, 100.0f, 0.0f, colors, NULL, 3);
+        NEQUALS(gradient, NULL);
+        EQUALS(gradient->opaque, true);
+        COLOREQUALS(gradient->ramp[0], PNTR_RED);
+        COLOREQUALS(gradient->ramp[255], PNTR_BLUE);
+        pntr_draw_rectangle_fill_gradient(image, 0, 0, 100, 100, gradient);
+        COLOREQUALS(pntr_image_get_color(image, 0, 50), gradient->ramp[1]);
+        COLOREQUALS(pntr_image_get_color(image, 49, 0), gradient->ramp[126]);
+        COLOREQUALS(pntr_image_get_color(image, 99, 99), gradient->ramp[254]);
+        COLOREQUALS(pntr_image_get_color(image, 30, 10), pntr_image_get_color(image, 30, 90));
+        pntr_unload_gradient(gradient);
+
+        // Uneven stops
+        float stops[] = {0.0f, 0.8f, 1.0f};
+        gradient = pntr_new_gradient_linear(0.0f, 0.0f, 100.0f, 0.0f, colors, stops, 3);
+        NEQUALS(gradient, NULL);
+        COLOREQUALS(gradient->ramp[204], PNTR_GREEN);
+        pntr_unload_gradient(gradient);
+
+        // Radial gradients go from the center out to the radius, and stay at the last color past it.
+        pntr_color radialColors[] = {PNTR_BLACK, PNTR_WHITE};
+        gradient = pntr_new_gradient_radial(50.0f, 50.0f, 40.0f, radialColors, NULL, 2);
+        NEQUALS(gradient, NULL);
+        pntr_draw_rectangle_fill_gradient(image, 0, 0, 100, 100, gradient);
+        LESSER(pntr_image_get_color(image, 50, 50).rgba.r, 10);
+        COLOREQUALS(pntr_image_get_color(image, 95, 50), PNTR_WHITE);
+        COLOREQUALS(pntr_image_get_color(image, 0, 0), PNTR_WHITE);
+        pntr_color halfway = pntr_image_get_color(image, 70, 50);
+        bool halfwayGray = halfway.rgba.r > 120 && halfway.rgba.r < 135;
+        EQUALS(halfwayGray, true);
+        COLOREQUALS(pntr_image_get_color(image, 70, 50), pntr_image_get_color(image, 50, 70));
+        pntr_unload_gradient(gradient);
+
+        // Conic gradients sweep clockwise from their start angle, and wrap back around to the first color.
+        gradient = pntr_new_gradient_conic(50.0f, 50.0f, 0.0f, radialColors, NULL, 2);
+        NEQUALS(gradient, NULL);
+        pntr_draw_rectangle_fill_gradient(image, 0, 0, 100, 100, gradient);
+        LESSER(pntr_image_get_color(image, 90, 51).rgba.r, 10);
+        GREATER(pntr_image_get_color(image, 90, 49).rgba.r, 245);
+        pntr_color down = pntr_image_get_color(image, 50, 90);
+        bool downQuarter = down.rgba.r > 58 && down.rgba.r < 70;
+        EQUALS(downQuarter, true);
+        pntr_color left = pntr_image_get_color(image, 10, 50);
+        bool leftHalf = left.rgba.r > 120 && left.rgba.r < 135;
+        EQUALS(leftHalf, true);
+        pntr_unload_gradient(gradient);
+
+        // Polygons cover the same pixels as pntr_draw_polygon_fill().
+        pntr_vector points[] = {{10, 10}, {80, 20}, {60, 90}, {15, 70}};
+        pntr_color solid[] = {PNTR_RED};
+        gradient = pntr_new_gradient_linear(0.0f, 0.0f, 100.0f, 100.0f, solid, NULL, 1);
+        NEQUALS(gradient, NULL);
+        pntr_clear_background(image, PNTR_WHITE);
+        pntr_draw_polygon_fill_gradient(image, points, 4, gradient);
+        pntr_image* expected = pntr_gen_image_color(100, 100, PNTR_WHITE);
+        NEQUALS(expected, NULL);
+        pntr_draw_polygon_fill(expected, points, 4, PNTR_RED);
+        bool same = true;
+        for (int y = 0; y < 100; y++) {
+            for (int x = 0; x < 100; x++) {
+                if (pntr_image_get_color(image, x, y).value != pntr_image_get_color(expected, x, y).value) {
+                    same = false;
+                }
+            }
+        }
+        EQUALS(same, true);
+        pntr_unload_gradient(gradient);
+
+        // Translucent gradients blend onto the image.
+        pntr_color translucent[] = {pntr_new_color(0, 0, 255, 128)};
+        gradient = pntr_new_gradient_linear(0.0f, 0.0f, 10.0f, 0.0f, translucent, NULL, 1);
+        NEQUALS(gradient, NULL);
+        EQUALS(gradient->opaque, false);
+        pntr_clear_background(image, PNTR_WHITE);
+        pntr_draw_rectangle_fill_gradient(image, -10, -10, 30, 30, gradient);
+        COLOREQUALS(pntr_image_get_color(image, 5, 5), pntr_color_alpha_blend(PNTR_WHITE, translucent[0]));
+        COLOREQUALS(pntr_image_get_color(image, 25, 25), PNTR_WHITE);
+        pntr_unload_gradient(gradient);
+
+        // Invalid arguments
+        EQUALS(pntr_new_gradient_linear(0.0f, 0.0f, 1.0f, 1.0f, NULL, NULL, 2), NULL);
+        EQUALS(pntr_new_gradient_radial(0.0f, 0.0f, 1.0f, colors, NULL, 0), NULL);
+        pntr_draw_rectangle_fill_gradient(image, 0, 0, 10, 10, NULL);
+        pntr_draw_polygon_fill_gradient(image, points, 4, NULL);
+
+        // The four corner gradient still reaches its corners.
+        pntr_draw_rectangle_gradient(image, 0, 0, 100, 100, PNTR_RED, PNTR_GREEN, PNTR_BLUE, PNTR_BLACK);
+        COLOREQUALS(pntr_image_get_color(image, 0, 0), PNTR_RED);
+        GREATER(pntr_image_get_color(image, 99, 0).rgba.g, 220);
+        GREATER(pntr_image_get_color(image, 0, 99).rgba.b, 230);
+        LESSER(pntr_image_get_color(image, 99, 99).rgba.r, 10);
+
+        pntr_unload_image(expected);
+        pntr_unload_image(image);
+    });
+
+    IT("pntr_new_path(), pntr_draw_path_fill(), pntr_draw_path_thick()", {
+        pntr_image* image = pntr_gen_image_color(200, 200, PNTR_WHITE);
+        pntr_image* expected = pntr_gen_image_color(200, 200, PNTR_WHITE);
+        NEQUALS(image, NULL);
+        NEQUALS(expected, NULL);
+
+        // Straight lines fill the same pixels as a rectangle.
+        pntr_path* path = pntr_new_path();
+        NEQUALS(path, NULL);
+        pntr_path_move_to(path, 10.0f, 10.0f);
+        pntr_path_line_to(path, 50.0f, 10.0f);
+        pntr_path_line_to(path, 50.0f, 40.0f);
+        pntr_path_line_to(path, 10.0f, 40.0f);
+        pntr_path_close(path);
+        EQUALS(path->contoursCount, 1);
+        EQUALS(path->pointsCount, 4);
+        EQUALS(path->contours[0].closed, true);
+        pntr_draw_path_fill(image, path, PNTR_FILL_RULE_NON_ZERO, PNTR_RED);
+        pntr_draw_rectangle_fill(expected, 10, 10, 40, 30, PNTR_RED);
+        bool same = true;
+        for (int y = 0; y < 200; y++) {
+            for (int x = 0; x < 200; x++) {
+                if (pntr_image_get_color(image, x, y).value != pntr_image_get_color(expected, x, y).value) {
+                    same = false;
+                }
+            }
+        }
+        EQUALS(same, true);
+
+        // A second contour inside of the first leaves a hole with the even-odd rule.
+        pntr_path_move_to(path, 20.0f, 20.0f);
+        pntr_path_line_to(path, 40.0f, 20.0f);
+        pntr_path_line_to(path, 40.0f, 30.0f);
+        pntr_path_line_to(path, 20.0f, 30.0f);
+        pntr_path_close(path);
+        EQUALS(path->contoursCount, 2);
+        pntr_clear_background(image, PNTR_WHITE);
+        pntr_draw_path_fill(image, path, PNTR_FILL_RULE_EVEN_ODD, PNTR_RED);
+        COLOREQUALS(pntr_image_get_color(image, 15, 15), PNTR_RED);
+        COLOREQUALS(pntr_image_get_color(image, 30, 25), PNTR_WHITE);
+        pntr_draw_path_fill(image, path, PNTR_FILL_RULE_NON_ZERO, PNTR_RED);
+        COLOREQUALS(pntr_image_get_color(image, 30, 25), PNTR_RED);
+        pntr_unload_path(path);
+
+        // Curves are flattened to fit their size.
+        path = pntr_new_path();
+        NEQUALS(path, NULL);
+        pntr_path_move_to(path, 0.0f, 0.0f);
+        pntr_path_quad_to(path, 1.0f, 1.0f, 2.0f, 0.0f);
+        int smallCurve = path->pointsCount;
+        pntr_path_move_to(path, 0.0f, 0.0f);
+        pntr_path_quad_to(path, 100.0f, 100.0f, 200.0f, 0.0f);
+        int largeCurve = path->pointsCount - smallCurve;
+        LESSER(smallCurve, 4);
+        GREATER(largeCurve, 10);
+        EQUALS(path->points[path->pointsCount * 2 - 2], 200.0f);
+        pntr_unload_path(path);
+
+        // A circle made of cubic curves stays within a pixel of the true circle.
+        path = pntr_new_path();
+        NEQUALS(path, NULL);
+        float k = 0.5523f * 80.0f;
+        pntr_path_move_to(path, 180.0f, 100.0f);
+        pntr_path_cubic_to(path, 180.0f, 100.0f + k, 100.0f + k, 180.0f, 100.0f, 180.0f);
+        pntr_path_cubic_to(path, 100.0f - k, 180.0f, 20.0f, 100.0f + k, 20.0f, 100.0f);
+        pntr_path_cubic_to(path, 20.0f, 100.0f - k, 100.0f - k, 20.0f, 100.0f, 20.0f);
+        pntr_path_cubic_to(path, 100.0f + k, 20.0f, 180.0f, 100.0f - k, 180.0f, 100.0f);
+        pntr_path_close(path);
+        pntr_clear_background(image, PNTR_WHITE);
+        pntr_draw_path_fill(image, path, PNTR_FILL_RULE_NON_ZERO, PNTR_BLUE);
+        COLOREQUALS(pntr_image_get_color(image, 100, 100), PNTR_BLUE);
+        COLOREQUALS(pntr_image_get_color(image, 156, 156), PNTR_BLUE);
+        COLOREQUALS(pntr_image_get_color(image, 158, 158), PNTR_WHITE);
+        COLOREQUALS(pntr_image_get_color(image, 178, 100), PNTR_BLUE);
+        COLOREQUALS(pntr_image_get_color(image, 181, 100), PNTR_WHITE);
+
+        // Stroking draws each pixel once, even where the contours overlap.
+        pntr_color translucent = pntr_new_color(255, 0, 0, 128);
+        pntr_clear_background(image, PNTR_WHITE);
+        pntr_path_move_to(path, 100.0f, 0.0f);
+        pntr_path_line_to(path, 100.0f, 200.0f);
+        pntr_draw_path_thick(image, path, 6, PNTR_LINE_JOIN_ROUND, PNTR_LINE_CAP_BUTT, translucent);
+        COLOREQUALS(pntr_image_get_color(image, 100, 20), pntr_color_alpha_blend(PNTR_WHITE, translucent));
+        COLOREQUALS(pntr_image_get_color(image, 60, 100), PNTR_WHITE);
+        COLOREQUALS(pntr_image_get_color(image, 100, 50), pntr_color_alpha_blend(PNTR_WHITE, translucent));
+        COLOREQUALS(pntr_image_get_color(image, 180, 100), pntr_color_alpha_blend(PNTR_WHITE, translucent));
+        COLOREQUALS(pntr_image_get_color(image, 190, 100), PNTR_WHITE);
+        pntr_unload_path(path);
+
+        // Paths crossing the right of the clip are filled and stroked up to it.
+        path = pntr_new_path();
+        NEQUALS(path, NULL);
+        pntr_path_move_to(path, 150.0f, 10.0f);
+        pntr_path_line_to(path, 300.0f, 10.0f);
+        pntr_path_line_to(path, 300.0f, 40.0f);
+        pntr_path_line_to(path, 150.0f, 40.0f);
+        pntr_path_close(path);
+        pntr_clear_background(image, PNTR_WHITE);
+        pntr_draw_path_fill(image, path, PNTR_FILL_RULE_NON_ZERO, PNTR_RED);
+        COLOREQUALS(pntr_image_get_color(image, 150, 25), PNTR_RED);
+        COLOREQUALS(pntr_image_get_color(image, 199, 25), PNTR_RED);
+        COLOREQUALS(pntr_image_get_color(image, 199, 45), PNTR_WHITE);
+        pntr_clear_background(image, PNTR_WHITE);
+        pntr_draw_path_thick(image, path, 4, PNTR_LINE_JOIN_MITER, PNTR_LINE_CAP_BUTT, PNTR_RED);
+        COLOREQUALS(pntr_image_get_color(image, 199, 10), PNTR_RED);
+        COLOREQUALS(pntr_image_get_color(image, 199, 40), PNTR_RED);
+        COLOREQUALS(pntr_image_get_color(image, 150, 25), PNTR_RED);
+        COLOREQUALS(pntr_image_get_color(image, 175, 25), PNTR_WHITE);
+        pntr_unload_path(path);
+
+        // Invalid arguments
+        pntr_path_line_to(NULL, 1.0f, 1.0f);
+        pntr_path_close(NULL);
+        pntr_draw_path_fill(image, NULL, PNTR_FILL_RULE_NON_ZERO, PNTR_RED);
+        pntr_draw_path_thick(image, NULL, 2, PNTR_LINE_JOIN_MITER, PNTR_LINE_CAP_BUTT, PNTR_RED);
+        pntr_unload_path(NULL);
+
+        pntr_unload_image(expected);
+        pntr_unload_image(image);
+    });
+
+    IT("pntr_draw_lines()", {
+        pntr_image* image = pntr_gen_image_color(60, 60, PNTR_WHITE);
+        pntr_image* expected = pntr_gen_image_color(60, 60, PNTR_WHITE);
+        NEQUALS(image, NULL);
+        NEQUALS(expected, NULL);
+
+        // Lines that are clipped draw the same pixels as they do without the clip.
+        pntr_vector segments[] = {
+            {-30, -20}, {90, 70},
+            {55, -40}, {5, 100},
+            {10, 10}, {12, 50},
+            {70, 30}, {-10, 33},
+            {20, 5}, {20, 40},
+            {3, 50}, {40, 50},
+            {30, 30}, {31, 31}
+        };
+        int count = (int)(sizeof(segments) / sizeof(segments[0]) / 2);
+        for (int i = 0; i < count; i++) {
+            pntr_draw_line(expected, segments[i * 2].x, segments[i * 2].y, segments[i * 2 + 1].x, segments[i * 2 + 1].y, PNTR_RED);
+        }
+        pntr_draw_lines(image, segments, count, PNTR_RED);
+        bool same = true;
+        for (int y = 0; y < 60; y++) {
+            for (int x = 0; x < 60; x++) {
+                if (pntr_image_get_color(image, x, y).value != pntr_image_get_color(expected, x, y).value) {
+                    same = false;
+                }
+            }
+        }
+        EQUALS(same, true);
+
+        pntr_clear_background(image, PNTR_WHITE);
+        pntr_image_set_clip(image, 12, 17, 31, 23);
+        pntr_draw_lines(image, segments, count, PNTR_RED);
+        pntr_image_reset_clip(image);
+        for (int y = 0; y < 60; y++) {
+            for (int x = 0; x < 60; x++) {
+                bool inside = x >= 12 && x < 43 && y >= 17 && y < 40;
+                pntr_color want = inside ? pntr_image_get_color(expected, x, y) : PNTR_WHITE;
+                if (pntr_image_get_color(image, x, y).value != want.value) {
+                    same = false;
+                }
+            }
+        }
+        EQUALS(same, true);
+
+        // Both ends of a diagonal line are drawn, and translucent lines blend each pixel once.
+        pntr_color translucent = pntr_new_color(0, 0, 255, 128);
+        pntr_clear_background(image, PNTR_WHITE);
+        pntr_draw_line(image, 5, 5, 25, 15, translucent);
+        COLOREQUALS(pntr_image_get_color(image, 5, 5), pntr_color_alpha_blend(PNTR_WHITE, translucent));
+        COLOREQUALS(pntr_image_get_color(image, 25, 15), pntr_color_alpha_blend(PNTR_WHITE, translucent));
+        COLOREQUALS(pntr_image_get_color(image, 15, 10), pntr_color_alpha_blend(PNTR_WHITE, translucent));
+        COLOREQUALS(pntr_image_get_color(image, 26, 15), PNTR_WHITE);
+
+        // Lines entirely outside of the image
+        pntr_clear_background(image, PNTR_WHITE);
+        pntr_draw_line(image, -50, -10, -5, 70, PNTR_RED);
+        pntr_draw_line(image, 70, 10, 100, -30, PNTR_RED);
+        pntr_draw_line(image, -20, 30, 30, -20, PNTR_RED);
+        COLOREQUALS(pntr_image_get_color(image, 0, 0), PNTR_WHITE);
+        COLOREQUALS(pntr_image_get_color(image, 0, 10), PNTR_RED);
+
+        // Invalid arguments
+        pntr_draw_lines(NULL, segments, count, PNTR_RED);
+        pntr_draw_lines(image, NULL, count, PNTR_RED);
+        pntr_draw_lines(image, segments, 0, PNTR_RED);
+
+        pntr_unload_image(expected);
+        pntr_unload_image(image);
+    });
+
+    IT("pntr_draw_particles()", {
+        pntr_image* image = pntr_gen_image_color(40, 30, PNTR_BLACK);
+        pntr_image* expected = pntr_gen_image_color(40, 30, PNTR_BLACK);
+        NEQUALS(image, NULL);
+        NEQUALS(expected, NULL);
+
+        // Particles outside of the clip are skipped, in and out of the SIMD batches.
+        int x[37];
+        int y[37];
+        pntr_color colors[37];
+        for (int i = 0; i < 37; i++) {
+            x[i] = (i * 7) % 50 - 5;
+            y[i] = (i * 11) % 40 - 5;
+            colors[i] = (i % 3 == 0) ? pntr_new_color(255, 0, 0, 128) : PNTR_BLUE;
+        }
+        pntr_image_set_clip(image, 2, 3, 30, 20);
+        pntr_image_set_clip(expected, 2, 3, 30, 20);
+        pntr_draw_particles(image, x, y, colors, NULL, 37, PNTR_BLEND_ALPHA);
+        for (int i = 0; i < 37; i++) {
+            pntr_draw_point(expected, x[i], y[i], colors[i]);
+        }
+        bool same = true;
+        for (int j = 0; j < 30; j++) {
+            for (int i = 0; i < 40; i++) {
+                if (pntr_image_get_color(image, i, j).value != pntr_image_get_color(expected, i, j).value) {
+                    same = false;
+                }
+            }
+        }
+        EQUALS(same, true);
+        pntr_image_reset_clip(image);
+
+        // Additive blending brightens where particles overlap, up to white.
+        pntr_clear_background(image, PNTR_BLACK);
+        int addX[] = {5, 5, 5, 5};
+        int addY[] = {5, 5, 5, 5};
+        pntr_color glow = pntr_new_color(100, 40, 0, 255);
+        pntr_color addColors[] = {glow, glow, glow, glow};
+        pntr_draw_particles(image, addX, addY, addColors, NULL, 2, PNTR_BLEND_ADD);
+        COLOREQUALS(pntr_image_get_color(image, 5, 5), pntr_new_color(200, 80, 0, 255));
+        pntr_draw_particles(image, addX, addY, addColors, NULL, 4, PNTR_BLEND_ADD);
+        COLOREQUALS(pntr_image_get_color(image, 5, 5), pntr_new_color(255, 240, 0, 255));
+
+        // Adding onto translucent pixels looks the same on straight and premultiplied images.
+        pntr_color faded = pntr_new_color(PNTR_RED.rgba.r, PNTR_RED.rgba.g, PNTR_RED.rgba.b, 128);
+        pntr_color fadedColors[] = {faded};
+        pntr_image* premultiplied = pntr_gen_image_color(10, 10, PNTR_BLANK);
+        pntr_image_alpha_premultiply(premultiplied);
+        pntr_clear_background(image, PNTR_BLANK);
+        pntr_draw_particles(image, addX, addY, fadedColors, NULL, 1, PNTR_BLEND_ADD);
+        pntr_draw_particles(premultiplied, addX, addY, fadedColors, NULL, 1, PNTR_BLEND_ADD);
+        pntr_color straightAdded = pntr_image_get_color(image, 5, 5);
+        pntr_color premultipliedAdded = pntr_color_alpha_unpremultiply(pntr_image_get_color(premultiplied, 5, 5));
+        EQUALS(straightAdded.rgba.a, 128);
+        LESSER(abs(straightAdded.rgba.r - PNTR_RED.rgba.r), 2);
+        LESSER(abs(straightAdded.rgba.r - premultipliedAdded.rgba.r), 2);
+        LESSER(abs(straightAdded.rgba.g - premultipliedAdded.rgba.g), 2);
+        LESSER(abs(straightAdded.rgba.b - premultipliedAdded.rgba.b), 2);
+        EQUALS(straightAdded.rgba.a, premultipliedAdded.rgba.a);
+        pntr_unload_image(premultiplied);
+
+        // Sizes draw squares around each particle.
+        pntr_clear_background(image, PNTR_BLACK);
+        int sizes[] = {3, 0};
+        pntr_draw_particles(image, addX, addY, colors + 1, sizes, 2, PNTR_BLEND_ALPHA);
+        COLOREQUALS(pntr_image_get_color(image, 4, 4), PNTR_BLUE);
+        COLOREQUALS(pntr_image_get_color(image, 6, 6), PNTR_BLUE);
+        COLOREQUALS(pntr_image_get_color(image, 7, 5), PNTR_BLACK);
+        COLOREQUALS(pntr_image_get_color(image, 3, 5), PNTR_BLACK);
+
+        // Invalid arguments
+        pntr_draw_particles(NULL, x, y, colors, NULL, 37, PNTR_BLEND_ALPHA);
+        pntr_draw_particles(image, NULL, y, colors, NULL, 37, PNTR_BLEND_ALPHA);
+        pntr_draw_particles(image, x, y, NULL, NULL, 37, PNTR_BLEND_ALPHA);
+        pntr_draw_particles(image, x, y, colors, NULL, 0, PNTR_BLEND_ALPHA);
+
+        pntr_unload_image(expected);
+        pntr_unload_image(image);
+    });
+
+    IT("pntr_image_gen_mipmaps(), pntr_draw_image_scaled()", {
+        // A checkerboard averages to gray at every level.
+        pntr_image* image = pntr_new_image(64, 32);
+        for (int y = 0; y < image->height; y++) {
+            for (int x = 0; x < image->width; x++) {
+                pntr_draw_point(image, x, y, (x + y) % 2 == 0 ? PNTR_WHITE : PNTR_BLACK);
+            }
+        }
+        EQUALS(image->mipmap, NULL);
+        EQUALS(pntr_image_gen_mipmaps(image), true);
+
+        int levels = 0;
+        for (pntr_image* level = image->mipmap; level != NULL; level = level->mipmap) {
+            levels++;
+            EQUALS(level->width, PNTR_MAX(image->width >> levels, 1));
+            EQUALS(level->height, PNTR_MAX(image->height >> levels, 1));
+            COLOREQUALS(pntr_image_get_color(level, 0, 0), pntr_new_color(128, 128, 128, 255));
+        }
+        EQUALS(levels, 6);
+
+        // Without mipmaps, nearest neighbor picks single pixels of the checkerboard.
+        pntr_image* canvas = pntr_gen_image_color(32, 32, PNTR_RED);
+        pntr_image* plain = pntr_image_copy(image);
+        pntr_draw_image_scaled(canvas, plain, 0, 0, 0.25f, 0.25f, 0.0f, 0.0f, PNTR_FILTER_NEARESTNEIGHBOR);
+        bool picked = pntr_image_get_color(canvas, 1, 1).rgba.r == 0 || pntr_image_get_color(canvas, 1, 1).rgba.r == 255;
+        EQUALS(picked, true);
+        pntr_unload_image(plain);
+
+        // With mipmaps, the level that matches the scale is sampled.
+        pntr_draw_image_scaled(canvas, image, 0, 0, 0.25f, 0.25f, 0.0f, 0.0f, PNTR_FILTER_NEARESTNEIGHBOR);
+        COLOREQUALS(pntr_image_get_color(canvas, 1, 1), pntr_new_color(128, 128, 128, 255));
+        COLOREQUALS(pntr_image_get_color(canvas, 15, 7), pntr_new_color(128, 128, 128, 255));
+        COLOREQUALS(pntr_image_get_color(canvas, 16, 8), PNTR_RED);
+
+        // Bilinear filtering blends the two nearest levels.
+        pntr_clear_background(canvas, PNTR_RED);
+        pntr_draw_image_scaled(canvas, image, 0, 0, 0.375f, 0.375f, 0.0f, 0.0f, PNTR_FILTER_BILINEAR);
+        COLOREQUALS(pntr_image_get_color(canvas, 5, 5), pntr_new_color(128, 128, 128, 255));
+        COLOREQUALS(pntr_image_get_color(canvas, 23, 11), pntr_new_color(128, 128, 128, 255));
+        COLOREQUALS(pntr_image_get_color(canvas, 24, 12), PNTR_RED);
+
+        // Scaling one axis far more than the other stays within the smaller level.
+        pntr_image* tall = pntr_gen_image_color(256, 256, PNTR_BLUE);
+        pntr_image* wide = pntr_gen_image_color(1024, 4, PNTR_RED);
+        EQUALS(pntr_image_gen_mipmaps(tall), true);
+        pntr_draw_image_scaled(wide, tall, 0, 0, 4.0f, 0.01f, 0.0f, 0.0f, PNTR_FILTER_NEARESTNEIGHBOR);
+        COLOREQUALS(pntr_image_get_color(wide, 1023, 1), PNTR_BLUE);
+        COLOREQUALS(pntr_image_get_color(wide, 1023, 2), PNTR_RED);
+        pntr_clear_background(wide, PNTR_RED);
+        pntr_draw_image_scaled(wide, tall, 0, 0, 4.0f, 0.01f, 0.0f, 0.0f, PNTR_FILTER_BILINEAR);
+        COLOREQUALS(pntr_image_get_color(wide, 1023, 1), PNTR_BLUE);
+        COLOREQUALS(pntr_image_get_color(wide, 1023, 2), PNTR_RED);
+        pntr_unload_image(wide);
+        pntr_unload_image(tall);
+
+        // Drawing into the image unloads its mipmaps, which would be out of date.
+        pntr_draw_point(image, 0, 0, PNTR_BLUE);
+        EQUALS(image->mipmap, NULL);
+        pntr_unload_image(image);
+
+        // Transparent pixels do not darken straight alpha levels, and odd sizes round up.
+        image = pntr_gen_image_color(3, 3, PNTR_BLANK);
+        pntr_draw_point(image, 0, 0, PNTR_GREEN);
+        EQUALS(pntr_image_gen_mipmaps(image), true);
+        NEQUALS(image->mipmap, NULL);
+        EQUALS(image->mipmap->width, 2);
+        EQUALS(image->mipmap->height, 2);
+        COLOREQUALS(pntr_image_get_color(image->mipmap, 0, 0), pntr_new_color(PNTR_GREEN.rgba.r, PNTR_GREEN.rgba.g, PNTR_GREEN.rgba.b, 64));
+        COLOREQUALS(pntr_image_get_color(image->mipmap, 1, 1), PNTR_BLANK);
+        EQUALS(image->mipmap->mipmap->width, 1);
+        EQUALS(image->mipmap->mipmap->mipmap, NULL);
+
+        pntr_image_unload_mipmaps(image);
+        EQUALS(image->mipmap, NULL);
+        EQUALS(pntr_image_gen_mipmaps(NULL), false);
+
+        pntr_unload_image(canvas);
+        pntr_unload_image(image);
+    });
+
+    IT("pntr_draw_polygon_fill()", {
+        pntr_image* image = pntr_gen_image_color(50, 50, PNTR_WHITE);
+
+        // A concave U shape
+        pntr_vector points[] = {
+            {0, 0}, {30, 0}, {30, 30}, {20, 30},
+            {20, 10}, {10, 10}, {10, 30}, {0, 30}
+        };
+        pntr_draw_polygon_fill(image, points, 8, PNTR_RED);
+        COLOREQUALS(pntr_image_get_color(image, 0, 1), PNTR_RED);
+        COLOREQUALS(pntr_image_get_color(image, 15, 5), PNTR_RED);
+        COLOREQUALS(pntr_image_get_color(image, 5, 20), PNTR_RED);
+        COLOREQUALS(pntr_image_get_color(image, 29, 30), PNTR_RED);
+        COLOREQUALS(pntr_image_get_color(image, 15, 20), PNTR_WHITE);
+        COLOREQUALS(pntr_image_get_color(image, 30, 20), PNTR_WHITE);
+        COLOREQUALS(pntr_image_get_color(image, 5, 31), PNTR_WHITE);
+
+        // Clipping, and blending translucent colors
+        pntr_clear_background(image, PNTR_WHITE);
+        pntr_image_set_clip(image, 0, 0, 15, 50);
+        pntr_color translucent = pntr_new_color(0, 0, 255, 128);
+        pntr_draw_polygon_fill(image, points, 8, translucent);
+        COLOREQUALS(pntr_image_get_color(image, 5, 20), pntr_color_alpha_blend(PNTR_WHITE, translucent));
+        COLOREQUALS(pntr_image_get_color(image, 25, 20), PNTR_WHITE);
+        pntr_image_reset_clip(image);
+
+        // Polygons with many points
+        pntr_vector circle[100];
+        for (int i = 0; i < 100; i++) {
+            circle[i].x = 25 + (int)(PNTR_COSF((float)i * PNTR_PI * 2.0f / 100.0f) * 20.0f);
+            circle[i].y = 25 + (int)(PNTR_SINF((float)i * PNTR_PI * 2.0f / 100.0f) * 20.0f);
+        }
+        pntr_clear_background(image, PNTR_WHITE);
+        pntr_draw_polygon_fill(image, circle, 100, PNTR_RED);
+        COLOREQUALS(pntr_image_get_color(image, 25, 25), PNTR_RED);
+        COLOREQUALS(pntr_image_get_color(image, 10, 25), PNTR_RED);
+        COLOREQUALS(pntr_image_get_color(image, 8, 8), PNTR_WHITE);
+        COLOREQUALS(pntr_image_get_color(image, 46, 25), PNTR_WHITE);
+
+        pntr_unload_image(image);
+    });
+
+    IT("pntr_draw_triangle_fill(), pntr_draw_triangle_gradient(), pntr_draw_triangles()", {
+        pntr_image* image = pntr_gen_image_color(50, 50, PNTR_WHITE);
+
+        // Pixels on the top and left edges are filled, while the others are not.
+        pntr_draw_triangle_fill(image, 0, 0, 10, 0, 0, 10, PNTR_RED);
+        COLOREQUALS(pntr_image_get_color(image, 0, 0), PNTR_RED);
+        COLOREQUALS(pntr_image_get_color(image, 9, 0), PNTR_RED);
+        COLOREQUALS(pntr_image_get_color(image, 0, 9), PNTR_RED);
+        COLOREQUALS(pntr_image_get_color(image, 4, 4), PNTR_RED);
+        COLOREQUALS(pntr_image_get_color(image, 10, 0), PNTR_WHITE);
+        COLOREQUALS(pntr_image_get_color(image, 0, 10), PNTR_WHITE);
+        COLOREQUALS(pntr_image_get_color(image, 5, 5), PNTR_WHITE);
+
+        // The winding of the points doesn't matter
+        pntr_draw_triangle_fill(image, 40, 40, 20, 40, 40, 20, PNTR_BLUE);
+        COLOREQUALS(pntr_image_get_color(image, 39, 39), PNTR_BLUE);
+        COLOREQUALS(pntr_image_get_color(image, 20, 20), PNTR_WHITE);
+
+        // A translucent mesh of two triangles blends each pixel once, just like a rectangle.
+        pntr_color translucent = pntr_new_color(0, 0, 255, 100);
+        pntr_clear_background(image, PNTR_WHITE);
+        pntr_vector vertices[] = {{5, 5}, {35, 5}, {35, 25}, {5, 25}};
+        int indices[] = {0, 1, 2, 0, 2, 3};
+        pntr_draw_triangles(image, vertices, indices, 6, NULL, translucent);
+        pntr_image* expected = pntr_gen_image_color(50, 50, PNTR_WHITE);
+        pntr_draw_rectangle_fill(expected, 5, 5, 30, 20, translucent);
+        IMAGEEQUALS(image, expected);
+        pntr_unload_image(expected);
+
+        // Vertex colors are interpolated
+        pntr_clear_background(image, PNTR_BLANK);
+        pntr_color colors[] = {PNTR_RED, PNTR_GREEN, PNTR_BLUE, PNTR_BLUE};
+        pntr_draw_triangles(image, vertices, indices, 3, colors, PNTR_BLANK);
+        COLOREQUALS(pntr_image_get_color(image, 5, 5), PNTR_RED);
+        pntr_color middle = pntr_image_get_color(image, 26, 12);
+        EQUALS(middle.rgba.a, 255);
+        NEQUALS(middle.rgba.r, 0);
+        NEQUALS(middle.rgba.g, 0);
+        NEQUALS(middle.rgba.b, 0);
+        COLOREQUALS(pntr_image_get_color(image, 10, 20), PNTR_BLANK);
+
+        pntr_draw_triangle_gradient(image, 0, 30, 20, 30, 0, 49, PNTR_GREEN, PNTR_GREEN, PNTR_GREEN);
+        COLOREQUALS(pntr_image_get_color(image, 5, 35), PNTR_GREEN);
+
+        pntr_unload_image(image);
+    });
+
+    IT("pntr_draw_triangle_textured(), pntr_draw_quad_textured()", {
+        pntr_image* texture = pntr_gen_image_color(16, 8, PNTR_RED);
+        pntr_draw_rectangle_fill(texture, 8, 0, 8, 8, PNTR_BLUE);
+        pntr_draw_point(texture, 3, 3, PNTR_GREEN);
+        pntr_image* image = pntr_gen_image_color(50, 50, PNTR_WHITE);
+        pntr_image* expected = pntr_gen_image_color(50, 50, PNTR_WHITE);
+
+        // Mapping the texture onto its own size draws it just like pntr_draw_image()
+        pntr_vector topLeft = {10, 10};
+        pntr_vector topRight = {26, 10};
+        pntr_vector bottomRight = {26, 18};
+        pntr_vector bottomLeft = {10, 18};
+        pntr_draw_quad_textured(image, texture, PNTR_CLITERAL(pntr_rectangle) {0, 0, 0, 0}, topLeft, topRight, bottomRight, bottomLeft, PNTR_WHITE, PNTR_FILTER_NEARESTNEIGHBOR);
+        pntr_draw_image(expected, texture, 10, 10);
+        IMAGEEQUALS(image, expected);
+
+        // Tint
+        pntr_color tint = pntr_new_color(200, 100, 255, 150);
+        pntr_draw_quad_textured(image, texture, PNTR_CLITERAL(pntr_rectangle) {0, 0, 0, 0}, topLeft, topRight, bottomRight, bottomLeft, tint, PNTR_FILTER_NEARESTNEIGHBOR);
+        pntr_draw_image_tint(expected, texture, 10, 10, tint);
+        IMAGEEQUALS(image, expected);
+
+        // A single triangle, flipped horizontally through its texture coordinates
+        pntr_clear_background(image, PNTR_WHITE);
+        pntr_draw_triangle_textured(image, texture, topLeft, topRight, bottomLeft, PNTR_CLITERAL(pntr_vector) {16, 0}, PNTR_CLITERAL(pntr_vector) {0, 0}, PNTR_CLITERAL(pntr_vector) {16, 8}, PNTR_WHITE, PNTR_FILTER_NEARESTNEIGHBOR);
+        COLOREQUALS(pntr_image_get_color(image, 10, 10), PNTR_BLUE);
+        COLOREQUALS(pntr_image_get_color(image, 25, 10), PNTR_RED);
+        COLOREQUALS(pntr_image_get_color(image, 25, 17), PNTR_WHITE);
+
+        // Bilinear filtering blends neighboring pixels when stretched
+        pntr_clear_background(image, PNTR_WHITE);
+        pntr_draw_quad_textured(image, texture, PNTR_CLITERAL(pntr_rectangle) {7, 0, 2, 1}, PNTR_CLITERAL(pntr_vector) {0, 0}, PNTR_CLITERAL(pntr_vector) {4, 0}, PNTR_CLITERAL(pntr_vector) {4, 2}, PNTR_CLITERAL(pntr_vector) {0, 2}, PNTR_WHITE, PNTR_FILTER_BILINEAR);
+        COLOREQUALS(pntr_image_get_color(image, 0, 0), PNTR_RED);
+        pntr_color blended = pntr_image_get_color(image, 1, 0);
+        EQUALS(blended.rgba.r, (PNTR_RED.rgba.r + PNTR_BLUE.rgba.r) / 2);
+        EQUALS(blended.rgba.b, (PNTR_RED.rgba.b + PNTR_BLUE.rgba.b) / 2);
+        COLOREQUALS(pntr_image_get_color(image, 2, 0), PNTR_BLUE);
+
+        // Clipped to the destination
+        pntr_clear_background(image, PNTR_WHITE);
+        pntr_draw_quad_textured(image, texture, PNTR_CLITERAL(pntr_rectangle) {0, 0, 0, 0}, PNTR_CLITERAL(pntr_vector) {-40, -20}, PNTR_CLITERAL(pntr_vector) {80, -20}, PNTR_CLITERAL(pntr_vector) {80, 70}, PNTR_CLITERAL(pntr_vector) {-40, 70}, PNTR_WHITE, PNTR_FILTER_BILINEAR);
+        COLOREQUALS(pntr_image_get_color(image, 0, 0), PNTR_RED);
+        COLOREQUALS(pntr_image_get_color(image, 49, 49), PNTR_BLUE);
+
+        pntr_unload_image(expected);
+        pntr_unload_image(image);
+        pntr_unload_image(texture);
+    });
+
     IT("pntr_get_file_image_type()", {
         EQUALS(pntr_get_file_image_type("myimage.png"), PNTR_IMAGE_TYPE_PNG);
         EQUALS(pntr_get_file_image_type("my/path/ima.ge.png"), PNTR_IMAGE_TYPE_PNG);
@@ -284,6 +1323,71 @@ MODULE(pntr, {
             pntr_unload_image(resized);
         });
 
+        IT("pntr_image_resize(PNTR_FILTER_BOX), pntr_image_resize(PNTR_FILTER_LANCZOS3)", {
+            // Shrinking a checkerboard averages all of its pixels, rather than picking some of them.
+            pntr_image* checkers = pntr_gen_image_color(64, 64, PNTR_BLACK);
+            NEQUALS(checkers, NULL);
+            for (int y = 0; y < 64; y++) {
+                for (int x = (y % 2); x < 64; x += 2) {
+                    pntr_draw_point(checkers, x, y, PNTR_WHITE);
+                }
+            }
+            pntr_filter filters[] = {PNTR_FILTER_BILINEAR, PNTR_FILTER_BOX, PNTR_FILTER_TRIANGLE, PNTR_FILTER_MITCHELL, PNTR_FILTER_LANCZOS3};
+            for (int i = 0; i < 5; i++) {
+                pntr_image* resized = pntr_image_resize(checkers, 8, 8, filters[i]);
+                NEQUALS(resized, NULL);
+                pntr_color middle = pntr_image_get_color(resized, 4, 3);
+                bool gray = middle.rgba.r > 120 && middle.rgba.r < 136;
+                EQUALS(gray, true);
+                EQUALS(middle.rgba.a, 255);
+                pntr_unload_image(resized);
+            }
+            pntr_unload_image(checkers);
+
+            // Solid colors stay the same, even with filters that have negative weights.
+            pntr_image* solid = pntr_gen_image_color(30, 20, PNTR_SKYBLUE);
+            NEQUALS(solid, NULL);
+            for (int i = 0; i < 5; i++) {
+                pntr_image* resized = pntr_image_resize(solid, 13, 47, filters[i]);
+                NEQUALS(resized, NULL);
+                COLOREQUALS(pntr_image_get_color(resized, 0, 0), PNTR_SKYBLUE);
+                COLOREQUALS(pntr_image_get_color(resized, 6, 23), PNTR_SKYBLUE);
+                COLOREQUALS(pntr_image_get_color(resized, 12, 46), PNTR_SKYBLUE);
+                pntr_unload_image(resized);
+            }
+            pntr_unload_image(solid);
+
+            // Boxes average exactly the pixels they cover.
+            pntr_image* halves = pntr_gen_image_color(4, 2, PNTR_RED);
+            NEQUALS(halves, NULL);
+            pntr_draw_rectangle_fill(halves, 2, 0, 2, 2, PNTR_BLUE);
+            pntr_image* resized = pntr_image_resize(halves, 2, 1, PNTR_FILTER_BOX);
+            NEQUALS(resized, NULL);
+            COLOREQUALS(pntr_image_get_color(resized, 0, 0), PNTR_RED);
+            COLOREQUALS(pntr_image_get_color(resized, 1, 0), PNTR_BLUE);
+            pntr_unload_image(resized);
+
+            // Transparent pixels don't darken the colors next to them.
+            pntr_clear_background(halves, PNTR_BLANK);
+            pntr_draw_rectangle_fill(halves, 2, 0, 2, 2, PNTR_RED);
+            resized = pntr_image_resize(halves, 1, 1, PNTR_FILTER_BOX);
+            NEQUALS(resized, NULL);
+            pntr_color edge = pntr_image_get_color(resized, 0, 0);
+            bool halfAlpha = edge.rgba.a > 125 && edge.rgba.a < 130;
+            EQUALS(halfAlpha, true);
+            bool red = edge.rgba.r > PNTR_RED.rgba.r - 3 && edge.rgba.r < PNTR_RED.rgba.r + 3;
+            EQUALS(red, true);
+            pntr_unload_image(resized);
+
+            // Growing keeps the colors at the ends.
+            resized = pntr_image_resize(halves, 40, 20, PNTR_FILTER_TRIANGLE);
+            NEQUALS(resized, NULL);
+            COLOREQUALS(pntr_image_get_color(resized, 39, 19), PNTR_RED);
+            EQUALS(pntr_image_get_color(resized, 0, 0).rgba.a, 0);
+            pntr_unload_image(resized);
+            pntr_unload_image(halves);
+        });
+
         pntr_unload_image(image);
     });
 
@@ -320,6 +1424,258 @@ MODULE(pntr, {
         pntr_unload_image(image);
     });
 
+    IT("pntr_draw_image(), pntr_color_alpha_blend()", {
+        // Rows of opaque, transparent and mixed pixels, with an odd width to cover the remainders.
+        pntr_image* src = pntr_new_image(37, 8);
+        pntr_image* dst = pntr_new_image(37, 8);
+        unsigned int seed = 1234;
+        for (int y = 0; y < src->height; y++) {
+            for (int x = 0; x < src->width; x++) {
+                seed = seed * 1103515245 + 12345;
+                unsigned char value = (unsigned char)(seed >> 16);
+                unsigned char alpha = (y == 0) ? 255 : (y == 1) ? 0 : (value % 3 == 0) ? 255 : (value % 3 == 1) ? 0 : value;
+                PNTR_PIXEL(src, x, y) = pntr_new_color(value, (unsigned char)(value * 3), (unsigned char)(x * 7), alpha);
+                PNTR_PIXEL(dst, x, y) = pntr_new_color((unsigned char)(y * 30), (unsigned char)(x * 5), value, (y == 7) ? (unsigned char)(x * 6) : 255);
+            }
+        }
+
+        pntr_image* expected = pntr_image_copy(dst);
+        for (int y = 0; y < src->height; y++) {
+            for (int x = 0; x < src->width; x++) {
+                PNTR_PIXEL(expected, x, y) = pntr_color_alpha_blend(PNTR_PIXEL(dst, x, y), PNTR_PIXEL(src, x, y));
+            }
+        }
+
+        pntr_draw_image(dst, src, 0, 0);
+        IMAGEEQUALS(dst, expected);
+
+        pntr_unload_image(expected);
+        pntr_unload_image(dst);
+        pntr_unload_image(src);
+    });
+
+    IT("pntr_image_alpha_premultiply(), pntr_color_alpha_premultiply()", {
+        pntr_color color = pntr_new_color(200, 100, 50, 128);
+        pntr_color premultiplied = pntr_color_alpha_premultiply(color);
+        COLOREQUALS(premultiplied, pntr_new_color(100, 50, 25, 128));
+        COLOREQUALS(pntr_color_alpha_unpremultiply(premultiplied), pntr_new_color(199, 100, 50, 128));
+        COLOREQUALS(pntr_color_alpha_premultiply(pntr_new_color(10, 20, 30, 0)), pntr_new_color(0, 0, 0, 0));
+
+        // Blending premultiplied images stays within one step of the straight alpha blend.
+        pntr_image* dst = pntr_gen_image_color(20, 4, PNTR_BLUE);
+        pntr_image* src = pntr_gen_image_color(20, 4, color);
+        EQUALS(dst->premultiplied, false);
+        pntr_image_alpha_premultiply(dst);
+        pntr_image_alpha_premultiply(src);
+        EQUALS(dst->premultiplied, true);
+        EQUALS(src->premultiplied, true);
+
+        pntr_draw_image(dst, src, 0, 0);
+        pntr_color expected = pntr_color_alpha_blend(PNTR_BLUE, color);
+        pntr_color actual = pntr_image_get_color(dst, 19, 3);
+        LESSER(abs(actual.rgba.r - expected.rgba.r), 2);
+        LESSER(abs(actual.rgba.g - expected.rgba.g), 2);
+        LESSER(abs(actual.rgba.b - expected.rgba.b), 2);
+        EQUALS(actual.rgba.a, 255);
+
+        // Exporting converts back to straight alpha.
+        unsigned char* pixels = (unsigned char*)pntr_image_to_pixelformat(src, NULL, PNTR_PIXELFORMAT_RGBA8888);
+        NEQUALS(pixels, NULL);
+        EQUALS(pixels[0], 199);
+        EQUALS(pixels[1], 100);
+        EQUALS(pixels[2], 50);
+        EQUALS(pixels[3], 128);
+        pntr_unload_memory(pixels);
+
+        pntr_image_alpha_unpremultiply(src);
+        EQUALS(src->premultiplied, false);
+        COLOREQUALS(pntr_image_get_color(src, 0, 0), pntr_new_color(199, 100, 50, 128));
+
+        unsigned char straight[4] = {200, 100, 50, 128};
+        pntr_image* loaded = pntr_image_from_pixelformat_premultiplied(straight, 1, 1, PNTR_PIXELFORMAT_RGBA8888);
+        NEQUALS(loaded, NULL);
+        EQUALS(loaded->premultiplied, true);
+        COLOREQUALS(pntr_image_get_color(loaded, 0, 0), premultiplied);
+
+        pntr_unload_image(loaded);
+        pntr_unload_image(src);
+        pntr_unload_image(dst);
+    });
+
+    IT("pntr_image_get_opacity()", {
+        EQUALS(pntr_image_get_opacity(NULL), PNTR_OPACITY_UNKNOWN);
+
+        pntr_image* image = pntr_gen_image_color(10, 10, PNTR_RED);
+        EQUALS(image->opacity, PNTR_OPACITY_OPAQUE);
+        EQUALS(pntr_image_get_opacity(image), PNTR_OPACITY_OPAQUE);
+
+        // Blending onto opaque pixels keeps them opaque.
+        pntr_draw_point(image, 2, 2, pntr_new_color(0, 0, 0, 100));
+        EQUALS(image->opacity, PNTR_OPACITY_UNKNOWN);
+        EQUALS(pntr_image_get_opacity(image), PNTR_OPACITY_OPAQUE);
+
+        // Modifying the image invalidates the cached opacity.
+        pntr_image_color_fade(image, -0.5f);
+        EQUALS(image->opacity, PNTR_OPACITY_UNKNOWN);
+        EQUALS(pntr_image_get_opacity(image), PNTR_OPACITY_MIXED);
+        EQUALS(image->opacity, PNTR_OPACITY_MIXED);
+
+        pntr_clear_background(image, PNTR_BLANK);
+        EQUALS(pntr_image_get_opacity(image), PNTR_OPACITY_TRANSPARENT);
+
+        // Transparent images aren't drawn, and opaque ones are copied.
+        pntr_image* dst = pntr_gen_image_color(10, 10, PNTR_BLUE);
+        pntr_draw_image(dst, image, 0, 0);
+        COLOREQUALS(pntr_image_get_color(dst, 5, 5), PNTR_BLUE);
+        pntr_clear_background(image, PNTR_GREEN);
+        pntr_draw_image(dst, image, 3, 3);
+        COLOREQUALS(pntr_image_get_color(dst, 2, 2), PNTR_BLUE);
+        COLOREQUALS(pntr_image_get_color(dst, 3, 3), PNTR_GREEN);
+        COLOREQUALS(pntr_image_get_color(dst, 9, 9), PNTR_GREEN);
+
+        // Drawing into a subimage invalidates the image it references.
+        pntr_image* subimage = pntr_image_subimage(image, 2, 2, 4, 4);
+        NEQUALS(subimage, NULL);
+        EQUALS(pntr_image_get_opacity(subimage), PNTR_OPACITY_OPAQUE);
+        pntr_clear_background(subimage, PNTR_BLANK);
+        EQUALS(image->opacity, PNTR_OPACITY_UNKNOWN);
+        EQUALS(pntr_image_get_opacity(subimage), PNTR_OPACITY_TRANSPARENT);
+        EQUALS(pntr_image_get_opacity(image), PNTR_OPACITY_MIXED);
+
+        // Pixel data the image doesn't own can change at any time, so its opacity isn't cached.
+        pntr_color pixels[16] = {0};
+        pntr_image* wrapped = pntr_image_from_pixels(pixels, 4, 4, 0, false);
+        NEQUALS(wrapped, NULL);
+        EQUALS(pntr_image_get_opacity(wrapped), PNTR_OPACITY_UNKNOWN);
+        pntr_clear_background(dst, PNTR_BLUE);
+        pntr_draw_image(dst, wrapped, 0, 0);
+        COLOREQUALS(pntr_image_get_color(dst, 1, 1), PNTR_BLUE);
+        for (int i = 0; i < 16; i++) {
+            pixels[i] = PNTR_RED;
+        }
+        pntr_draw_image(dst, wrapped, 0, 0);
+        COLOREQUALS(pntr_image_get_color(dst, 1, 1), PNTR_RED);
+        pntr_clear_background(wrapped, PNTR_BLANK);
+        EQUALS(pntr_image_get_opacity(wrapped), PNTR_OPACITY_UNKNOWN);
+        pntr_unload_image(wrapped);
+
+        pntr_unload_image(subimage);
+        pntr_unload_image(dst);
+        pntr_unload_image(image);
+    });
+
+    IT("pntr_load_sprite_rle(), pntr_draw_sprite_rle()", {
+        pntr_image* image = pntr_gen_image_color(24, 6, PNTR_BLANK);
+        pntr_draw_rectangle_fill(image, 2, 0, 10, 6, PNTR_RED);
+        pntr_draw_rectangle_fill(image, 8, 1, 12, 3, pntr_new_color(0, 255, 0, 120));
+        pntr_draw_point(image, 23, 5, pntr_new_color(0, 0, 255, 200));
+
+        pntr_sprite_rle* sprite = pntr_load_sprite_rle(image);
+        NEQUALS(sprite, NULL);
+        EQUALS(sprite->width, 24);
+        EQUALS(sprite->height, 6);
+        EQUALS(sprite->rows[1] - sprite->rows[0], 1);
+        EQUALS(sprite->rows[2] - sprite->rows[1], 2);
+        EQUALS(sprite->runs[sprite->rows[1]].opaque, true);
+        EQUALS(sprite->runs[sprite->rows[1] + 1].x, 12);
+        EQUALS(sprite->runs[sprite->rows[1] + 1].opaque, false);
+
+        // The sprite draws the same as the image, including when clipped.
+        pntr_image* expected = pntr_gen_image_color(30, 20, PNTR_BLUE);
+        pntr_image* actual = pntr_gen_image_color(30, 20, PNTR_BLUE);
+        pntr_image_set_clip(expected, 3, 2, 20, 15);
+        pntr_image_set_clip(actual, 3, 2, 20, 15);
+        int positions[] = { 0, 0, -5, -2, 10, 14, 25, 3 };
+        for (int i = 0; i < 8; i += 2) {
+            pntr_draw_image(expected, image, positions[i], positions[i + 1]);
+            pntr_draw_sprite_rle(actual, sprite, positions[i], positions[i + 1]);
+        }
+        IMAGEEQUALS(actual, expected);
+
+        pntr_unload_image(actual);
+        pntr_unload_image(expected);
+        pntr_unload_sprite_rle(sprite);
+        pntr_unload_image(image);
+    });
+
+    IT("pntr_draw_image_tint(), pntr_image_color_tint()", {
+        // Large enough to tint through lookup tables.
+        pntr_image* src = pntr_new_image(40, 12);
+        unsigned int seed = 4321;
+        for (int y = 0; y < src->height; y++) {
+            for (int x = 0; x < src->width; x++) {
+                seed = seed * 1103515245 + 12345;
+                PNTR_PIXEL(src, x, y).value = seed;
+            }
+        }
+
+        pntr_color tint = pntr_new_color(200, 90, 255, 180);
+        pntr_image* dst = pntr_gen_image_color(40, 12, PNTR_DARKBLUE);
+        pntr_image* expected = pntr_gen_image_color(40, 12, PNTR_DARKBLUE);
+        for (int y = 0; y < src->height; y++) {
+            for (int x = 0; x < src->width; x++) {
+                PNTR_PIXEL(expected, x, y) = pntr_color_alpha_blend(PNTR_PIXEL(expected, x, y), pntr_color_tint(PNTR_PIXEL(src, x, y), tint));
+            }
+        }
+        pntr_draw_image_tint(dst, src, 0, 0, tint);
+        IMAGEEQUALS(dst, expected);
+
+        pntr_image* original = pntr_image_copy(src);
+        pntr_image* tinted = pntr_image_copy(src);
+        pntr_image_color_tint(tinted, tint);
+        for (int y = 0; y < src->height; y++) {
+            for (int x = 0; x < src->width; x++) {
+                COLOREQUALS(PNTR_PIXEL(tinted, x, y), pntr_color_tint(PNTR_PIXEL(original, x, y), tint));
+            }
+        }
+
+        pntr_unload_image(tinted);
+        pntr_unload_image(original);
+        pntr_unload_image(expected);
+        pntr_unload_image(dst);
+        pntr_unload_image(src);
+    });
+
+    IT("pntr_new_color_pipeline(), pntr_image_color_pipeline()", {
+        pntr_color_pipeline* pipeline = pntr_new_color_pipeline();
+        NEQUALS(pipeline, NULL);
+
+        // Channel adjustments give the same colors as applying them one by one.
+        pntr_color_pipeline_brightness(pipeline, 0.2f);
+        pntr_color_pipeline_contrast(pipeline, 0.3f);
+        pntr_color_pipeline_fade(pipeline, -0.25f);
+        pntr_color_pipeline_invert(pipeline);
+        EQUALS(pipeline->stagesCount, 1);
+        pntr_color color = pntr_new_color(30, 140, 220, 200);
+        pntr_color expected = pntr_color_invert(pntr_color_fade(pntr_color_contrast(pntr_color_brightness(color, 0.2f), 0.3f), -0.25f));
+        COLOREQUALS(pntr_color_pipeline_apply(pipeline, color), expected);
+
+        // Desaturating fully leaves a gray color.
+        pntr_color_pipeline_saturation(pipeline, -1.0f);
+        EQUALS(pipeline->stagesCount, 2);
+        pntr_color gray = pntr_color_pipeline_apply(pipeline, color);
+        EQUALS(gray.rgba.r, gray.rgba.g);
+        EQUALS(gray.rgba.g, gray.rgba.b);
+        EQUALS(gray.rgba.a, expected.rgba.a);
+
+        // Images apply the whole pipeline in one pass.
+        pntr_image* image = pntr_gen_image_color(8, 8, color);
+        pntr_image_color_pipeline(image, pipeline);
+        COLOREQUALS(pntr_image_get_color(image, 4, 4), gray);
+        pntr_unload_image(image);
+        pntr_unload_color_pipeline(pipeline);
+
+        // Rotating the hue all the way around keeps the color.
+        pipeline = pntr_new_color_pipeline();
+        pntr_color_pipeline_hue(pipeline, 120.0f);
+        pntr_color_pipeline_hue(pipeline, 240.0f);
+        pntr_color rotated = pntr_color_pipeline_apply(pipeline, color);
+        LESSER(abs(rotated.rgba.r - color.rgba.r), 2);
+        LESSER(abs(rotated.rgba.g - color.rgba.g), 2);
+        LESSER(abs(rotated.rgba.b - color.rgba.b), 2);
+        pntr_unload_color_pipeline(pipeline);
+    });
+
     IT("pntr_image_color_replace()", {
         pntr_image* image = pntr_gen_image_color(100, 100, PNTR_BLUE);
         NEQUALS(image, NULL);
@@ -328,9 +1684,49 @@ MODULE(pntr, {
         pntr_image_color_replace(image, PNTR_BLUE, PNTR_RED);
         COLOREQUALS(pntr_image_get_color(image, 10, 10), PNTR_RED);
 
+        // Premultiplied images compare and replace straight colors.
+        pntr_color translucent = pntr_new_color(200, 100, 50, 128);
+        pntr_clear_background(image, translucent);
+        pntr_image_alpha_premultiply(image);
+        pntr_image_color_replace(image, pntr_color_alpha_unpremultiply(pntr_color_alpha_premultiply(translucent)), PNTR_GREEN);
+        COLOREQUALS(pntr_image_get_color(image, 10, 10), PNTR_GREEN);
+        EQUALS(image->data[0].value, PNTR_GREEN.value);
+
         pntr_unload_image(image);
     });
 
+    IT("pntr_image_alpha_mask()", {
+        pntr_image* mask = pntr_gen_image_color(4, 4, pntr_new_color(0, 0, 0, 128));
+        pntr_image* dst = pntr_gen_image_color(4, 4, PNTR_BLUE);
+        pntr_color expected = pntr_color_alpha_blend(PNTR_BLUE, pntr_new_color(PNTR_RED.rgba.r, PNTR_RED.rgba.g, PNTR_RED.rgba.b, 128));
+
+        // The mask replaces the alpha of straight images.
+        pntr_image* image = pntr_gen_image_color(4, 4, PNTR_RED);
+        pntr_image_alpha_mask(image, mask, 0, 0);
+        EQUALS(image->data[0].rgba.a, 128);
+        pntr_draw_image(dst, image, 0, 0);
+        pntr_color straight = pntr_image_get_color(dst, 1, 1);
+        pntr_unload_image(image);
+
+        // Premultiplied images scale their color channels along with it, and blend the same way.
+        image = pntr_gen_image_color(4, 4, PNTR_RED);
+        pntr_image_alpha_premultiply(image);
+        pntr_image_alpha_mask(image, mask, 0, 0);
+        COLOREQUALS(image->data[0], pntr_color_alpha_premultiply(pntr_new_color(PNTR_RED.rgba.r, PNTR_RED.rgba.g, PNTR_RED.rgba.b, 128)));
+        pntr_clear_background(dst, PNTR_BLUE);
+        pntr_draw_image(dst, image, 0, 0);
+        pntr_color premultiplied = pntr_image_get_color(dst, 1, 1);
+        LESSER(abs(premultiplied.rgba.r - expected.rgba.r), 2);
+        LESSER(abs(premultiplied.rgba.g - expected.rgba.g), 2);
+        LESSER(abs(premultiplied.rgba.b - expected.rgba.b), 2);
+        LESSER(abs(straight.rgba.r - premultiplied.rgba.r), 2);
+        LESSER(abs(straight.rgba.b - premultiplied.rgba.b), 2);
+
+        pntr_unload_image(image);
+        pntr_unload_image(dst);
+        pntr_unload_image(mask);
+    });
+
     IT("pntr_color_invert()", {
         pntr_color color = pntr_new_color(21, 16, 171, 255);
         COLOREQUALS(pntr_color_invert(color), pntr_new_color(234, 239, 84, 255));
@@ -468,6 +1864,87 @@ MODULE(pntr, {
         EQUALS(pntr_get_pixel_data_size(2, 3, PNTR_PIXELFORMAT_RGBA8888), 24);
         EQUALS(pntr_get_pixel_data_size(3, 2, PNTR_PIXELFORMAT_ARGB8888), 24);
         EQUALS(pntr_get_pixel_data_size(4, 4, PNTR_PIXELFORMAT_GRAYSCALE), 16);
+        EQUALS(pntr_get_pixel_data_size(3, 2, PNTR_PIXELFORMAT_RGB565), 12);
+        EQUALS(pntr_get_pixel_data_size(3, 2, PNTR_PIXELFORMAT_RGB888), 18);
+        EQUALS(pntr_get_pixel_data_size(3, 2, PNTR_PIXELFORMAT_BGRA8888), 24);
+        EQUALS(pntr_get_pixel_data_size(3, 2, PNTR_PIXELFORMAT_A8), 6);
+    });
+
+    IT("pntr_image_to_pixelformat_buffer(), pntr_image_from_pixelformat_buffer()", {
+        // Wide enough to go through the vectorized rows and their remainders
+        pntr_image* image = pntr_gen_image_color(37, 3, PNTR_RED);
+        NEQUALS(image, NULL);
+        PNTR_PIXEL(image, 1, 0) = pntr_new_color(10, 20, 30, 40);
+        pntr_draw_point(image, 36, 2, PNTR_BLUE);
+
+        // BGRA
+        unsigned char* bgra = (unsigned char*)pntr_image_to_pixelformat(image, NULL, PNTR_PIXELFORMAT_BGRA8888);
+        NEQUALS(bgra, NULL);
+        EQUALS(bgra[0], 55);
+        EQUALS(bgra[1], 41);
+        EQUALS(bgra[2], 230);
+        EQUALS(bgra[3], 255);
+        EQUALS(bgra[4], 30);
+        EQUALS(bgra[5], 20);
+        EQUALS(bgra[6], 10);
+        EQUALS(bgra[7], 40);
+        pntr_unload_memory(bgra);
+
+        // RGB888
+        unsigned char* rgb = (unsigned char*)pntr_image_to_pixelformat(image, NULL, PNTR_PIXELFORMAT_RGB888);
+        NEQUALS(rgb, NULL);
+        EQUALS(rgb[0], 230);
+        EQUALS(rgb[1], 41);
+        EQUALS(rgb[2], 55);
+        pntr_unload_memory(rgb);
+
+        // RGB565, in little-endian order
+        unsigned char* rgb565 = (unsigned char*)pntr_image_to_pixelformat(image, NULL, PNTR_PIXELFORMAT_RGB565);
+        NEQUALS(rgb565, NULL);
+        int rgb565Value = rgb565[0] | (rgb565[1] << 8);
+        EQUALS(rgb565Value, ((230 >> 3) << 11 | (41 >> 2) << 5 | 55 >> 3));
+        pntr_unload_memory(rgb565);
+
+        // Round trips through every format with a padded stride
+        pntr_pixelformat formats[] = {
+            PNTR_PIXELFORMAT_RGBA8888,
+            PNTR_PIXELFORMAT_ARGB8888,
+            PNTR_PIXELFORMAT_BGRA8888,
+            PNTR_PIXELFORMAT_RGB888
+        };
+        unsigned char buffer[(37 * 4 + 8) * 3];
+        pntr_image* output = pntr_gen_image_color(37, 3, PNTR_BLANK);
+        NEQUALS(output, NULL);
+        for (int i = 0; i < (int)(sizeof(formats) / sizeof(formats[0])); i++) {
+            EQUALS(pntr_image_to_pixelformat_buffer(image, buffer, 37 * 4 + 8, formats[i]), true);
+            EQUALS(pntr_image_from_pixelformat_buffer(output, buffer, 37 * 4 + 8, formats[i]), true);
+            COLOREQUALS(pntr_image_get_color(output, 0, 0), PNTR_RED);
+            COLOREQUALS(pntr_image_get_color(output, 36, 2), PNTR_BLUE);
+            if (formats[i] != PNTR_PIXELFORMAT_RGB888) {
+                COLOREQUALS(pntr_image_get_color(output, 1, 0), pntr_new_color(10, 20, 30, 40));
+            }
+        }
+        EQUALS(pntr_image_get_opacity(output), PNTR_OPACITY_OPAQUE);
+
+        // RGB565 rows may start on odd addresses
+        EQUALS(pntr_image_to_pixelformat_buffer(image, buffer + 1, 37 * 2 + 1, PNTR_PIXELFORMAT_RGB565), true);
+        EQUALS(pntr_image_from_pixelformat_buffer(output, buffer + 1, 37 * 2 + 1, PNTR_PIXELFORMAT_RGB565), true);
+        COLOREQUALS(pntr_image_get_color(output, 0, 0), pntr_new_color((230 >> 3 << 3) | (230 >> 5), (41 >> 2 << 2) | (41 >> 6), (55 >> 3 << 3) | (55 >> 5), 255));
+        COLOREQUALS(pntr_image_get_color(output, 36, 2), pntr_new_color(0, (121 >> 2 << 2) | (121 >> 6), (241 >> 3 << 3) | (241 >> 5), 255));
+
+        // A8 loads as white
+        EQUALS(pntr_image_to_pixelformat_buffer(image, buffer, 0, PNTR_PIXELFORMAT_A8), true);
+        EQUALS(buffer[1], 40);
+        EQUALS(pntr_image_from_pixelformat_buffer(output, buffer, 0, PNTR_PIXELFORMAT_A8), true);
+        COLOREQUALS(pntr_image_get_color(output, 1, 0), pntr_new_color(255, 255, 255, 40));
+        EQUALS(pntr_image_get_opacity(output), PNTR_OPACITY_MIXED);
+
+        EQUALS(pntr_image_to_pixelformat_buffer(NULL, buffer, 0, PNTR_PIXELFORMAT_A8), false);
+        EQUALS(pntr_get_error_code(), PNTR_ERROR_INVALID_ARGS);
+        pntr_set_error(PNTR_ERROR_NONE);
+
+        pntr_unload_image(output);
+        pntr_unload_image(image);
     });
 
     IT("pntr_image_alpha_border(), pntr_image_alpha_crop()", {
@@ -656,6 +2133,51 @@ MODULE(pntr, {
         pntr_unload_image(image);
     });
 
+    IT("pntr_image_from_pixels()", {
+        // A framebuffer with two pixels of padding at the end of each row
+        pntr_color framebuffer[10 * 4];
+        for (int i = 0; i < 10 * 4; i++) {
+            framebuffer[i] = PNTR_GREEN;
+        }
+
+        pntr_image* image = pntr_image_from_pixels(framebuffer, 8, 4, 10 * (int)sizeof(pntr_color), false);
+        NEQUALS(image, NULL);
+        EQUALS(image->width, 8);
+        EQUALS(image->height, 4);
+        EQUALS(image->owned, false);
+
+        pntr_clear_background(image, PNTR_BLANK);
+        pntr_draw_rectangle_fill(image, 1, 1, 2, 2, PNTR_RED);
+        COLOREQUALS(framebuffer[0], PNTR_BLANK);
+        COLOREQUALS(framebuffer[10 + 1], PNTR_RED);
+        COLOREQUALS(framebuffer[8], PNTR_GREEN);
+        COLOREQUALS(framebuffer[10 * 3 + 9], PNTR_GREEN);
+
+        // Clearing a subimage leaves the rest of its rows alone
+        pntr_image* subimage = pntr_image_subimage(image, 1, 1, 2, 2);
+        pntr_clear_background(subimage, PNTR_BLUE);
+        COLOREQUALS(framebuffer[10 + 1], PNTR_BLUE);
+        COLOREQUALS(framebuffer[10 + 3], PNTR_BLANK);
+        pntr_unload_image(subimage);
+
+        pntr_unload_image(image);
+        COLOREQUALS(framebuffer[10 * 2 + 2], PNTR_BLUE);
+
+        // Owned pixel data is freed along with the image
+        pntr_color* pixels = (pntr_color*)pntr_load_memory(sizeof(pntr_color) * 4);
+        NEQUALS(pixels, NULL);
+        image = pntr_image_from_pixels(pixels, 2, 2, 0, true);
+        NEQUALS(image, NULL);
+        EQUALS(image->pitch, 2 * (int)sizeof(pntr_color));
+        pntr_clear_background(image, PNTR_RED);
+        COLOREQUALS(pntr_image_get_color(image, 1, 1), PNTR_RED);
+        pntr_unload_image(image);
+
+        EQUALS(pntr_image_from_pixels(framebuffer, 8, 4, 10, false), NULL);
+        EQUALS(pntr_get_error_code(), PNTR_ERROR_INVALID_ARGS);
+        pntr_set_error(PNTR_ERROR_NONE);
+    });
+
     IT("pntr_image_set_clip", {
         pntr_image* image = pntr_gen_image_color(300, 300, PNTR_RED);
         COLOREQUALS(pntr_image_get_color(image, 50, 50), PNTR_RED);